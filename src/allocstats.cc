@@ -0,0 +1,131 @@
+#include "allocstats.hh"
+
+#ifdef ALLOC_STATS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <atomic>
+#include <new>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t alignment, size_t size);
+void __libc_free(void *ptr);
+}
+
+// plain atomics: these are touched from SDL's threads as well
+static std::atomic<uint64_t> newCount(0);
+static std::atomic<uint64_t> mallocCount(0);
+
+static AllocCounts frameStart;
+static uint64_t frameAllocs = 0;
+static uint64_t frames = 0;
+static uint64_t framesAllocating = 0;
+static uint64_t maxFrameAllocs = 0;
+
+extern "C" {
+
+void *malloc(size_t size) {
+  mallocCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+  mallocCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+  mallocCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+  mallocCount.fetch_add(1, std::memory_order_relaxed);
+  void *ptr = __libc_memalign(alignment, size);
+  if (!ptr) return ENOMEM;
+  *result = ptr;
+  return 0;
+}
+
+}
+
+static inline void* countedNew(size_t size) {
+  newCount.fetch_add(1, std::memory_order_relaxed);
+  void *ptr = __libc_malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new(size_t size) {
+  return countedNew(size);
+}
+
+void* operator new[](size_t size) {
+  return countedNew(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  newCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  newCount.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size ? size : 1);
+}
+
+void operator delete(void *ptr) noexcept {
+  __libc_free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  __libc_free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  __libc_free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  __libc_free(ptr);
+}
+
+AllocCounts allocCounts() {
+  AllocCounts result;
+  result.news = newCount.load(std::memory_order_relaxed);
+  result.mallocs = mallocCount.load(std::memory_order_relaxed);
+  return result;
+}
+
+void beginFrameAllocs() {
+  frameStart = allocCounts();
+}
+
+uint64_t endFrameAllocs() {
+  frameAllocs = allocCounts().total() - frameStart.total();
+  ++frames;
+  if (frameAllocs) ++framesAllocating;
+  if (frameAllocs > maxFrameAllocs) maxFrameAllocs = frameAllocs;
+  return frameAllocs;
+}
+
+uint64_t lastFrameAllocs() {
+  return frameAllocs;
+}
+
+void printAllocStats() {
+  AllocCounts counts = allocCounts();
+  printf("Allocations: %llu new, %llu malloc\n",
+      static_cast<unsigned long long>(counts.news),
+      static_cast<unsigned long long>(counts.mallocs));
+  printf("Frames: %llu, %llu of them allocating, at most %llu allocations in one frame\n",
+      static_cast<unsigned long long>(frames),
+      static_cast<unsigned long long>(framesAllocating),
+      static_cast<unsigned long long>(maxFrameAllocs));
+}
+
+#endif
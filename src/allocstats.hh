@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+// Heap allocation counting for the ALLOC_STATS build: operator new and
+// the malloc family are replaced with counting wrappers around glibc.
+#ifdef ALLOC_STATS
+
+struct AllocCounts {
+  uint64_t news;
+  uint64_t mallocs;
+
+  inline uint64_t total() const {
+    return news + mallocs;
+  }
+};
+
+AllocCounts allocCounts();
+
+// brackets one repaint, the difference is kept as the last frame's count
+void beginFrameAllocs();
+uint64_t endFrameAllocs();
+uint64_t lastFrameAllocs();
+void printAllocStats();
+
+#endif
@@ -0,0 +1,57 @@
+#include "axishistogram.hh"
+
+#include <string.h>
+
+AxisHistogram::AxisHistogram(): dirtyBins(0), distinct(0), minSeen(32768), maxSeen(-32769) {
+  memset(presence, 0, sizeof(presence));
+  memset(counts, 0, sizeof(counts));
+  memset(codes, 0, sizeof(codes));
+}
+
+uint32_t AxisHistogram::missingCodes() {
+  return distinct ? maxSeen - minSeen + 1 - distinct : 0;
+}
+
+bool AxisHistogram::deadzone(int *low, int *high) {
+  const int center = 32768;
+  // highest code seen below the center
+  int below = -1;
+  for (int w = (center - 1) >> 6; w >= 0 && below < 0; --w) {
+    uint64_t word = presence[w];
+    if (w == (center - 1) >> 6) word &= ~0ULL >> (63 - ((center - 1) & 63));
+    if (word) below = (w << 6) + 63 - __builtin_clzll(word);
+  }
+  // lowest code seen above the center
+  int above = -1;
+  for (int w = (center + 1) >> 6; w < 65536 / 64 && above < 0; ++w) {
+    uint64_t word = presence[w];
+    if (w == (center + 1) >> 6) word &= ~0ULL << ((center + 1) & 63);
+    if (word) above = (w << 6) + __builtin_ctzll(word);
+  }
+  if (below < 0 || above < 0)
+    return false;
+  *low = below - center;
+  *high = above - center;
+  return true;
+}
+
+void AxisHistogram::renderStrip(VideoSurface *strip, uint32_t fg, uint32_t bg, bool all) {
+  uint64_t dirty = all ? ~0ULL : dirtyBins;
+  dirtyBins = 0;
+  if (!dirty)
+    return;
+  LockedSurface locked;
+  if (strip->lock(&locked))
+    return;
+  for (int x = 0; x < locked.w; ++x) {
+    int bin = x * NUM_BINS / locked.w;
+    if (!((dirty >> bin) & 1)) continue;
+    // bar height is the share of the bin's codes seen, any code shows
+    int height = (codes[bin] * locked.h + (1 << BIN_SHIFT) - 1) >> BIN_SHIFT;
+    for (int y = 0; y < locked.h; ++y) {
+      uint32_t *row = reinterpret_cast<uint32_t*>(locked.pixels + y * locked.pitch);
+      row[x] = y >= locked.h - height ? fg : bg;
+    }
+  }
+  strip->unlock();
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+
+// Every value an axis has reported, one bit per code, plus a coarse
+// histogram, both updated in O(1) per sample. Shows how many of the 65536
+// codes a stick really produces, which ones it skips and how wide the
+// gap around the center is.
+class AxisHistogram {
+public:
+  static const int BIN_SHIFT = 10;
+  static const int NUM_BINS = 65536 >> BIN_SHIFT;
+private:
+  uint64_t presence[65536 / 64];
+  uint32_t counts[NUM_BINS];
+  // distinct codes seen per bin, what the strip shows
+  uint16_t codes[NUM_BINS];
+  uint64_t dirtyBins;
+  uint32_t distinct;
+  int minSeen, maxSeen;
+public:
+  AxisHistogram();
+
+  inline void add(int value) {
+    if (value < -32768) value = -32768;
+    if (value > 32767) value = 32767;
+    unsigned code = value + 32768;
+    unsigned bin = code >> BIN_SHIFT;
+    ++counts[bin];
+    uint64_t bit = 1ULL << (code & 63);
+    uint64_t &word(presence[code >> 6]);
+    if (word & bit)
+      return;
+    word |= bit;
+    ++codes[bin];
+    ++distinct;
+    dirtyBins |= 1ULL << bin;
+    if (value < minSeen) minSeen = value;
+    if (value > maxSeen) maxSeen = value;
+  }
+
+  inline uint32_t distinctValues() { return distinct; }
+  // codes never seen between the lowest and highest value seen
+  uint32_t missingCodes();
+  // the unseen run around the center, exclusive bounds; false if the
+  // axis hasn't reported values on both sides yet
+  bool deadzone(int *low, int *high);
+  inline uint32_t binCount(int bin) { return counts[bin]; }
+
+  // redraws the columns of bins with new codes, or all of them
+  void renderStrip(VideoSurface *strip, uint32_t fg, uint32_t bg, bool all);
+};
@@ -0,0 +1,92 @@
+#include "axisnoise.hh"
+
+#include <math.h>
+#include <string.h>
+
+AxisNoise::AxisNoise(int numAxes): numAxes(numAxes), pending(false) {
+  window = new int16_t[WINDOW * numAxes];
+  sum = new int64_t[numAxes];
+  sumSq = new int64_t[numAxes];
+  filled = new int32_t[numAxes];
+  slot = new int32_t[numAxes];
+  fresh = new uint32_t[numAxes];
+  firstCenter = new int32_t[numAxes];
+  center = new int32_t[numAxes];
+  firstRestTime = new uint64_t[numAxes];
+  lastRestTime = new uint64_t[numAxes];
+  restVariance = new double[numAxes];
+  restSamples = new uint32_t[numAxes];
+  memset(window, 0, sizeof(int16_t) * WINDOW * numAxes);
+  memset(sum, 0, sizeof(int64_t) * numAxes);
+  memset(sumSq, 0, sizeof(int64_t) * numAxes);
+  memset(filled, 0, sizeof(int32_t) * numAxes);
+  memset(slot, 0, sizeof(int32_t) * numAxes);
+  memset(fresh, 0, sizeof(uint32_t) * numAxes);
+  memset(restVariance, 0, sizeof(double) * numAxes);
+  memset(restSamples, 0, sizeof(uint32_t) * numAxes);
+}
+
+AxisNoise::~AxisNoise() {
+  delete[] window;
+  delete[] sum;
+  delete[] sumSq;
+  delete[] filled;
+  delete[] slot;
+  delete[] fresh;
+  delete[] firstCenter;
+  delete[] center;
+  delete[] firstRestTime;
+  delete[] lastRestTime;
+  delete[] restVariance;
+  delete[] restSamples;
+}
+
+void AxisNoise::update(uint64_t nowMicros) {
+  pending = false;
+  // N * sumSq - sum^2 is N^2 times the variance, compared exactly
+  const int64_t restLimit = static_cast<int64_t>(WINDOW) * WINDOW * REST_DEVIATION * REST_DEVIATION;
+  for (int a = 0; a < numAxes; ++a) {
+    uint32_t count = fresh[a];
+    fresh[a] = 0;
+    if (!count || filled[a] < WINDOW) continue;
+    int64_t spread = WINDOW * sumSq[a] - sum[a] * sum[a];
+    if (spread >= restLimit) continue;
+    int32_t mean = static_cast<int32_t>(sum[a] / WINDOW);
+    if (!restSamples[a]) {
+      firstCenter[a] = mean;
+      firstRestTime[a] = nowMicros;
+    }
+    center[a] = mean;
+    lastRestTime[a] = nowMicros;
+    // weighted by the samples that arrived, not by the repaints
+    restVariance[a] += count * (static_cast<double>(spread) / (static_cast<double>(WINDOW) * WINDOW));
+    restSamples[a] += count;
+  }
+}
+
+bool AxisNoise::windowStats(int axis, double *mean, double *deviation) {
+  int n = filled[axis];
+  if (!n)
+    return false;
+  *mean = static_cast<double>(sum[axis]) / n;
+  double variance = static_cast<double>(sumSq[axis]) / n - *mean * *mean;
+  *deviation = variance > 0 ? sqrt(variance) : 0;
+  return true;
+}
+
+bool AxisNoise::restStats(int axis, int *restCenter, double *rmsNoise) {
+  if (!restSamples[axis])
+    return false;
+  *restCenter = center[axis];
+  *rmsNoise = sqrt(restVariance[axis] / restSamples[axis]);
+  return true;
+}
+
+bool AxisNoise::drift(int axis, int *change, double *perHour) {
+  if (!restSamples[axis])
+    return false;
+  *change = center[axis] - firstCenter[axis];
+  uint64_t span = lastRestTime[axis] - firstRestTime[axis];
+  *perHour = span ? *change * 3600e6 / span : 0;
+  return true;
+}
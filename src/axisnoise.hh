@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+// Noise, resting center and drift of all axes of a device. Every axis
+// event goes into the axis' sliding window of the last WINDOW samples as
+// it arrives; once per repaint update() folds the samples that came in
+// since into the resting statistics, with one pass over every axis. The
+// moments of the windows are kept as exact integer sums, which can't drift
+// however long the tool runs, and no memory is added after construction.
+class AxisNoise {
+public:
+  static const int WINDOW = 256;
+  // windowed standard deviation under which an axis counts as untouched
+  static const int REST_DEVIATION = 96;
+private:
+  int numAxes;
+  // WINDOW samples per axis, oldest overwritten first
+  int16_t *window;
+  int64_t *sum, *sumSq;
+  int32_t *filled, *slot;
+  // samples since the last update()
+  uint32_t *fresh;
+  bool pending;
+
+  int32_t *firstCenter, *center;
+  uint64_t *firstRestTime, *lastRestTime;
+  double *restVariance;
+  uint32_t *restSamples;
+public:
+  AxisNoise(int numAxes);
+  ~AxisNoise();
+
+  static_assert((WINDOW & (WINDOW - 1)) == 0, "WINDOW must be a power of two");
+
+  inline void set(int axis, int value) {
+    int16_t *w = window + axis * WINDOW;
+    int s = slot[axis];
+    int32_t old = w[s];
+    w[s] = value;
+    sum[axis] += value - old;
+    sumSq[axis] += static_cast<int64_t>(value) * value - static_cast<int64_t>(old) * old;
+    slot[axis] = (s + 1) & (WINDOW - 1);
+    if (filled[axis] < WINDOW) ++filled[axis];
+    ++fresh[axis];
+    pending = true;
+  }
+  inline bool isPending() { return pending; }
+  // folds the samples since the last call into the resting statistics
+  void update(uint64_t nowMicros);
+
+  inline uint32_t getRestSamples(int axis) { return restSamples[axis]; }
+  // windowed mean and standard deviation
+  bool windowStats(int axis, double *mean, double *deviation);
+  // center and RMS noise over the times the axis was at rest
+  bool restStats(int axis, int *restCenter, double *rmsNoise);
+  // change of the resting center since it was first seen, per hour
+  bool drift(int axis, int *change, double *perHour);
+};
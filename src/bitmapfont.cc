@@ -0,0 +1,176 @@
+#include "bitmapfont.hh"
+
+#include <string.h>
+
+#ifdef BAKED_FONT
+
+#include "bakedfont.h"
+
+Font::Font(int size): size(size), baked(nullptr) {
+}
+
+bool Font::load() {
+  for (size_t i = 0; i < sizeof(bakedFonts) / sizeof(*bakedFonts); ++i) {
+    if (bakedFonts[i]->size == size) {
+      baked = bakedFonts[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+void Font::warmUp() {
+  // touch every page of the atlas so the first frame doesn't fault them in
+  volatile uint8_t sink = 0;
+  size_t size = baked->atlasWidth * baked->atlasHeight;
+  for (size_t i = 0; i < size; i += 4096) {
+    sink += baked->atlas[i];
+  }
+  (void)sink;
+}
+
+void Font::close() {
+  baked = nullptr;
+}
+
+const BakedGlyph& Font::glyph(uint8_t c) {
+  int index = c - baked->firstChar;
+  if (index < 0 || index >= baked->numChars)
+    index = '?' - baked->firstChar;
+  return baked->glyphs[index];
+}
+
+int Font::kerning(uint8_t left, uint8_t right) {
+  int lo = 0, hi = baked->numKerning;
+  uint16_t key = (left << 8) | right;
+  while (lo < hi) {
+    int mid = (lo + hi) >> 1;
+    const BakedKerning &k(baked->kerning[mid]);
+    uint16_t midKey = (k.left << 8) | k.right;
+    if (midKey == key) return k.amount;
+    if (midKey < key) lo = mid + 1; else hi = mid;
+  }
+  return 0;
+}
+
+// returns the width of the text, minX is where the first glyph starts
+// relative to the pen (negative if it hangs to the left)
+int Font::layout(const char *text, int *minX) {
+  int pen = 0, left = 0, right = 0;
+  uint8_t prev = 0;
+  for (const uint8_t *p = reinterpret_cast<const uint8_t*>(text); *p; ++p) {
+    const BakedGlyph &g(glyph(*p));
+    if (prev) pen += kerning(prev, *p);
+    if (pen + g.left < left) left = pen + g.left;
+    if (pen + g.left + g.w > right) right = pen + g.left + g.w;
+    pen += g.advance;
+    if (pen > right) right = pen;
+    prev = *p;
+  }
+  *minX = left;
+  return right - left;
+}
+
+void Font::measure(const char *text, int *w, int *h) {
+  int minX;
+  *w = layout(text, &minX);
+  *h = baked->height;
+}
+
+VideoSurface* Font::render(Video &video, const char *text, SDL_Color color, bool *borrowed) {
+  if (borrowed) *borrowed = false;
+  int minX;
+  int w = layout(text, &minX);
+  int h = baked->height;
+  if (w <= 0)
+    return nullptr;
+
+  // glyphs are merged into a coverage buffer first so that overlapping
+  // glyphs keep the stronger coverage instead of overwriting each other
+  uint8_t *coverage = static_cast<uint8_t*>(video.frameAlloc(w * h));
+  memset(coverage, 0, w * h);
+  int pen = -minX;
+  uint8_t prev = 0;
+  for (const uint8_t *p = reinterpret_cast<const uint8_t*>(text); *p; ++p) {
+    const BakedGlyph &g(glyph(*p));
+    if (prev) pen += kerning(prev, *p);
+    for (int row = 0; row < g.h; ++row) {
+      int y = g.top + row;
+      if (y < 0 || y >= h) continue;
+      const uint8_t *src = baked->atlas + (g.y + row) * baked->atlasWidth + g.x;
+      uint8_t *dst = coverage + y * w + pen + g.left;
+      for (int x = 0; x < g.w; ++x) {
+        if (src[x] > dst[x]) dst[x] = src[x];
+      }
+    }
+    pen += g.advance;
+    prev = *p;
+  }
+
+  VideoSurface *surface = borrowed ? video.scratchSurface(w, h) : nullptr;
+  if (surface) {
+    *borrowed = true;
+  } else {
+    surface = video.createSurface(w, h);
+  }
+  uint32_t pixels[256];
+  for (int a = 0; a < 256; ++a) {
+    pixels[a] = surface->mapRGBA(color.r, color.g, color.b, a);
+  }
+  LockedSurface ls;
+  if (!surface->lock(&ls)) {
+    for (int y = 0; y < h; ++y) {
+      uint32_t *dst = reinterpret_cast<uint32_t*>(ls.pixels + y * ls.pitch);
+      const uint8_t *src = coverage + y * w;
+      for (int x = 0; x < w; ++x) {
+        dst[x] = pixels[src[x]];
+      }
+    }
+    surface->unlock();
+  }
+  return surface;
+}
+
+#else
+
+#include "font.h"
+
+Font::Font(int size): size(size), ttf(nullptr) {
+}
+
+bool Font::load() {
+  SDL_RWops *rw = SDL_RWFromConstMem(RussoOne_Regular_ttf, RussoOne_Regular_ttf_len);
+  // the second parameter value will tell to free the rwops instance
+  ttf = TTF_OpenFontRW(rw, 1, size);
+  return ttf != nullptr;
+}
+
+void Font::warmUp() {
+  // SDL_ttf caches the glyphs it has rendered, fill the cache with ASCII
+  char text[96];
+  for (int i = 0; i < 95; ++i) {
+    text[i] = ' ' + i;
+  }
+  text[95] = 0;
+  SDL_Color white = { 0xff, 0xff, 0xff, 0xff };
+  SDL_FreeSurface(TTF_RenderText_Blended(ttf, text, white));
+}
+
+void Font::close() {
+  if (ttf) TTF_CloseFont(ttf);
+  ttf = nullptr;
+}
+
+void Font::measure(const char *text, int *w, int *h) {
+  if (TTF_SizeText(ttf, text, w, h) < 0) {
+    *w = 0;
+    *h = 0;
+  }
+}
+
+VideoSurface* Font::render(Video &video, const char *text, SDL_Color color, bool *borrowed) {
+  if (borrowed) *borrowed = false;
+  return video.adapt(TTF_RenderText_Blended(ttf, text, color));
+}
+
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+
+// Layout of the atlases tools/fontbake writes into bakedfont.h
+struct BakedGlyph {
+  uint16_t x, y;
+  uint8_t w, h;
+  // offset of the bitmap from the pen position and the top of the line
+  int8_t left, top;
+  uint8_t advance;
+};
+
+struct BakedKerning {
+  uint8_t left, right;
+  int8_t amount;
+};
+
+struct BakedFont {
+  int size;
+  int ascent;
+  int height;
+  int atlasWidth, atlasHeight;
+  const uint8_t *atlas;
+  int firstChar, numChars;
+  const BakedGlyph *glyphs;
+  int numKerning;
+  // sorted by left, then right character
+  const BakedKerning *kerning;
+};
+
+// Text in one of the sizes intester uses. With BAKED_FONT the glyphs come
+// from the prebaked coverage atlas and SDL_ttf is not needed at all,
+// otherwise the embedded TrueType font is parsed when loading.
+class Font {
+  int size;
+#ifdef BAKED_FONT
+  const BakedFont *baked;
+
+  const BakedGlyph& glyph(uint8_t c);
+  int kerning(uint8_t left, uint8_t right);
+  int layout(const char *text, int *minX);
+#else
+  TTF_Font *ttf;
+#endif
+public:
+  Font(int size);
+
+  // thread safe as long as nothing else uses the font meanwhile
+  bool load();
+  // rasterizes (or with BAKED_FONT, faults in) every glyph ahead of use;
+  // SDL_ttf renders into SDL surfaces, so without BAKED_FONT only call it
+  // on the main thread once the video mode is set
+  void warmUp();
+  void close();
+
+  inline int getSize() { return size; }
+
+  void measure(const char *text, int *w, int *h);
+  // an alpha surface with the text, like TTF_RenderText_Blended; given
+  // borrowed, the text may be drawn on a Video::scratchSurface instead,
+  // *borrowed is then set and the result must not be deleted
+  VideoSurface* render(Video &video, const char *text, SDL_Color color, bool *borrowed = nullptr);
+};
@@ -0,0 +1,71 @@
+#include "bounce.hh"
+
+#include <stdio.h>
+#include <string.h>
+
+BounceDetector::BounceDetector(int thresholdMicros): numSlots(0),
+    threshold(thresholdMicros), totalBounces(0) {
+  memset(slotOf, 0, sizeof(slotOf));
+}
+
+void BounceDetector::transition(const char *device, int node, int code, bool down, uint64_t micros) {
+  if (node < 0 || node >= MAX_NODES || code < 0 || code >= MAX_CODES)
+    return;
+  uint16_t &index(slotOf[node][code]);
+  if (!index) {
+    if (numSlots == MAX_SLOTS)
+      return;
+    Slot &s(slots[numSlots]);
+    snprintf(s.device, sizeof(s.device), "%s", device);
+    s.node = node;
+    s.code = code;
+    s.down = !down;
+    s.head = s.count = 0;
+    s.transitions = s.bounces = 0;
+    s.minInterval = UINT64_MAX;
+    index = ++numSlots;
+  }
+  Slot &s(slots[index - 1]);
+  if (s.down == down)
+    return;
+  s.down = down;
+
+  if (s.count) {
+    uint64_t previous = s.times[s.head];
+    uint64_t interval = micros > previous ? micros - previous : 0;
+    if (interval < s.minInterval) s.minInterval = interval;
+    if (interval < threshold) {
+      ++s.bounces;
+      ++totalBounces;
+    }
+  }
+  s.head = (s.head + 1) % RING_SIZE;
+  s.times[s.head] = micros;
+  if (s.count < RING_SIZE) ++s.count;
+  ++s.transitions;
+}
+
+void BounceDetector::sink(void *context, const char *device, int node, int code, bool down, uint64_t micros) {
+  static_cast<BounceDetector*>(context)->transition(device, node, code, down, micros);
+}
+
+void BounceDetector::printStats() {
+  printf("Bounces (transitions closer than %.1f ms): %u\n", threshold / 1000.0, totalBounces);
+  for (int i = 0; i < numSlots; ++i) {
+    Slot &s(slots[i]);
+    if (s.transitions < 2) continue;
+    printf("  %s (event%d) code 0x%03x: %u transitions, %u bounces, shortest %.3f ms\n",
+        s.device, s.node, s.code, s.transitions, s.bounces, s.minInterval / 1000.0);
+    if (s.bounces) {
+      // the last few transitions, oldest first
+      printf("    recent intervals:");
+      for (int j = s.count - 1; j > 0; --j) {
+        uint64_t t0 = s.times[(s.head - j + RING_SIZE) % RING_SIZE];
+        uint64_t t1 = s.times[(s.head - j + 1 + RING_SIZE) % RING_SIZE];
+        printf(" %.3f", (t1 - t0) / 1000.0);
+      }
+      printf(" ms\n");
+    }
+  }
+  fflush(stdout);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+// Finds switch bounce and chatter from kernel timestamped transitions:
+// a button changing state again sooner than the threshold counts as a
+// bounce. All the state lives in a fixed pool of slots, one per button
+// seen, so transitions never allocate.
+class BounceDetector {
+public:
+  static const int MAX_NODES = 64;
+  static const int MAX_CODES = 0x300;
+  static const int MAX_SLOTS = 512;
+  static const int RING_SIZE = 8;
+private:
+  struct Slot {
+    char device[48];
+    int node;
+    int code;
+    bool down;
+    // recent transition times in microseconds, newest at head
+    uint64_t times[RING_SIZE];
+    int head, count;
+    uint32_t transitions, bounces;
+    uint64_t minInterval;
+  };
+
+  // slot index + 1 of each button, 0 if it has none yet
+  uint16_t slotOf[MAX_NODES][MAX_CODES];
+  Slot slots[MAX_SLOTS];
+  int numSlots;
+  uint64_t threshold;
+  uint32_t totalBounces;
+public:
+  BounceDetector(int thresholdMicros);
+
+  void transition(const char *device, int node, int code, bool down, uint64_t micros);
+  // InputProbe::KeySink
+  static void sink(void *context, const char *device, int node, int code, bool down, uint64_t micros);
+
+  inline uint32_t getTotalBounces() { return totalBounces; }
+  void printStats();
+};
@@ -0,0 +1,118 @@
+#include "eventstream.hh"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+EventStream::EventStream(): listenFd(-1), numClients(0), count(0), frame(0), droppedRecords(0) {
+}
+
+EventStream::~EventStream() {
+  close();
+}
+
+bool EventStream::open(const char *socketPath) {
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(socketPath) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, "Socket path too long: %s\n", socketPath);
+    return false;
+  }
+  strcpy(addr.sun_path, socketPath);
+  listenFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listenFd < 0) {
+    perror("Can't create the event socket");
+    return false;
+  }
+  // a previous run may have left the socket file behind
+  unlink(socketPath);
+  if (bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 ||
+      listen(listenFd, MAX_CLIENTS) < 0) {
+    perror("Can't listen on the event socket");
+    ::close(listenFd);
+    listenFd = -1;
+    return false;
+  }
+  snprintf(path, sizeof(path), "%s", socketPath);
+  return true;
+}
+
+void EventStream::close() {
+  if (listenFd < 0)
+    return;
+  while (numClients) {
+    dropClient(numClients - 1);
+  }
+  ::close(listenFd);
+  listenFd = -1;
+  unlink(path);
+}
+
+void EventStream::acceptClients() {
+  while (numClients < MAX_CLIENTS) {
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+      return;
+    dropped[numClients] = 0;
+    clients[numClients++] = fd;
+  }
+}
+
+void EventStream::dropClient(int index) {
+  ::close(clients[index]);
+  --numClients;
+  clients[index] = clients[numClients];
+  dropped[index] = dropped[numClients];
+}
+
+void EventStream::frameShown(uint64_t micros) {
+  if (listenFd < 0)
+    return;
+  // the frame record always fits, it replaces the last one if needed
+  if (count == MAX_RECORDS) {
+    --count;
+    ++droppedRecords;
+  }
+  StreamRecord &r(records[count++]);
+  r.micros = micros;
+  r.type = STREAM_FRAME;
+  r.device = 0;
+  r.code = frame & 0xffff;
+  r.value = 0;
+  acceptClients();
+
+  StreamBatchHeader header;
+  header.magic = STREAM_MAGIC;
+  header.version = 1;
+  header.recordSize = sizeof(StreamRecord);
+  header.count = count;
+  header.frame = frame;
+  header.droppedRecords = droppedRecords;
+  iovec parts[2] = {
+    { &header, sizeof(header) },
+    { records, count * sizeof(StreamRecord) },
+  };
+  msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = parts;
+  message.msg_iovlen = 2;
+
+  for (int i = 0; i < numClients; ) {
+    header.droppedBatches = dropped[i];
+    // sendmsg is writev with flags: never block, no SIGPIPE
+    if (sendmsg(clients[i], &message, MSG_DONTWAIT | MSG_NOSIGNAL) >= 0) {
+      ++i;
+    } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      ++dropped[i++];
+    } else {
+      dropClient(i);
+    }
+  }
+  count = 0;
+  ++frame;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+// Binary input stream for local tools (--socket PATH). The socket is
+// AF_UNIX SOCK_SEQPACKET: every repaint sends one message, a header and
+// the records gathered since the previous one, ending with a frame
+// record. A client that can't take the message right away loses it and
+// sees the count in droppedBatches of the next one it gets.
+enum StreamRecordType {
+  STREAM_KEY = 1,
+  STREAM_BUTTON,
+  STREAM_AXIS,
+  STREAM_HAT,
+  STREAM_MOUSE,
+  STREAM_FRAME,
+};
+
+struct StreamRecord {
+  // CLOCK_MONOTONIC when the input happened: the evdev timestamp if the
+  // event woke the loop, otherwise when SDL queued it (SDL2) or took it off
+  // the queue (SDL1)
+  uint64_t micros;
+  uint8_t type;
+  // panel slot of the joystick (0-3, 0xff if it isn't tracked), not the
+  // SDL id, which grows with every reconnect; 0 for the keyboard and mouse
+  uint8_t device;
+  // key, button or axis; for frames the low bits of the frame number
+  uint16_t code;
+  // pressed (1/0), axis or hat value, or mouse x in the high and y in the
+  // low 16 bits
+  int32_t value;
+};
+
+const uint32_t STREAM_MAGIC = 0x56454e49; // "INEV"
+
+struct StreamBatchHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t count;
+  uint32_t droppedBatches;
+  uint64_t frame;
+  // records that didn't fit the batch buffer, since the stream started
+  uint64_t droppedRecords;
+};
+
+class EventStream {
+public:
+  static const int MAX_CLIENTS = 8;
+  static const int MAX_RECORDS = 4096;
+private:
+  int listenFd;
+  char path[108];
+  int clients[MAX_CLIENTS];
+  uint32_t dropped[MAX_CLIENTS];
+  int numClients;
+  StreamRecord records[MAX_RECORDS];
+  int count;
+  uint64_t frame;
+  uint64_t droppedRecords;
+
+  void acceptClients();
+  void dropClient(int index);
+public:
+  EventStream();
+  ~EventStream();
+
+  bool open(const char *path);
+  void close();
+  inline bool isOpen() { return listenFd >= 0; }
+
+  inline void record(const StreamRecord &r) {
+    if (count == MAX_RECORDS) {
+      ++droppedRecords;
+      return;
+    }
+    records[count++] = r;
+  }
+  // adds the frame record and sends the batch to every client
+  void frameShown(uint64_t micros);
+};
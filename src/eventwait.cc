@@ -0,0 +1,218 @@
+#include "eventwait.hh"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "timing.hh"
+
+static const char *strategyNames[] = { "block", "timeout", "poll", "epoll" };
+
+InputProbe::InputProbe(): numFds(0), overruns(0), keySink(nullptr), keySinkContext(nullptr) {
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  if (epollFd < 0) perror("epoll_create1");
+  rescan();
+}
+
+InputProbe::~InputProbe() {
+  for (int i = 0; i < numFds; ++i) {
+    close(fds[i]);
+  }
+  if (epollFd >= 0) close(epollFd);
+}
+
+void InputProbe::rescan() {
+  for (int i = 0; i < numFds; ++i) {
+    close(fds[i]);
+  }
+  numFds = 0;
+  if (epollFd < 0)
+    return;
+
+  DIR *dir = opendir("/dev/input");
+  if (!dir)
+    return;
+  char path[288];
+  while (dirent *entry = readdir(dir)) {
+    if (strncmp(entry->d_name, "event", 5) || numFds >= MAX_NODES)
+      continue;
+    snprintf(path, sizeof(path), "/dev/input/%s", entry->d_name);
+    int fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+      continue;
+    // timestamps on the clock monotonicNanos() reads
+    int clock = CLOCK_MONOTONIC;
+    ioctl(fd, EVIOCSCLOCKID, &clock);
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+      close(fd);
+      continue;
+    }
+    nodes[numFds] = atoi(entry->d_name + 5);
+    resyncing[numFds] = false;
+    if (ioctl(fd, EVIOCGNAME(sizeof(names[numFds])), names[numFds]) < 0)
+      snprintf(names[numFds], sizeof(names[numFds]), "%s", entry->d_name);
+    fds[numFds++] = fd;
+  }
+  closedir(dir);
+}
+
+uint64_t InputProbe::drain() {
+  uint64_t oldest = 0;
+  input_event events[64];
+  for (int i = 0; i < numFds; ++i) {
+    ssize_t len;
+    while ((len = read(fds[i], events, sizeof(events))) > 0) {
+      int count = len / sizeof(input_event);
+      for (int j = 0; j < count; ++j) {
+        const input_event &e(events[j]);
+        if (e.type == EV_SYN) {
+          // evdev(4): drop everything up to and including the next report
+          if (e.code == SYN_DROPPED) {
+            resyncing[i] = true;
+            ++overruns;
+          } else if (e.code == SYN_REPORT) {
+            resyncing[i] = false;
+          }
+          continue;
+        }
+        if (resyncing[i]) continue;
+        uint64_t t = static_cast<uint64_t>(e.input_event_sec) * 1000000 + e.input_event_usec;
+        if (!oldest || t < oldest) oldest = t;
+        // value 2 is autorepeat, not a transition
+        if (e.type == EV_KEY && e.value < 2 && keySink)
+          keySink(keySinkContext, names[i], nodes[i], e.code, e.value, t);
+      }
+    }
+    // an unplugged node stays readable (EPOLLHUP) until the next rescan
+    if (len < 0 && errno == ENODEV)
+      epoll_ctl(epollFd, EPOLL_CTL_DEL, fds[i], nullptr);
+  }
+  return oldest;
+}
+
+EventWaiter::EventWaiter(WaitStrategy strategy, int period, InputProbe &probe):
+    strategy(strategy), period(period), probe(probe), epollKernelTime(0), eventKernelTime(0),
+    wakeups(0), delayed(0), delaySum(0), delayMax(0) {
+  if (strategy == WAIT_EPOLL && !probe.isAvailable()) {
+    fprintf(stderr, "No readable evdev nodes for epoll, blocking in SDL instead\n");
+    this->strategy = WAIT_BLOCK;
+  }
+  startTime = monotonicMicros();
+  getrusage(RUSAGE_THREAD, &startUsage);
+}
+
+bool EventWaiter::parse(const char *arg, WaitStrategy *strategy, int *period) {
+  for (int i = 0; i < 4; ++i) {
+    size_t len = strlen(strategyNames[i]);
+    if (strncmp(arg, strategyNames[i], len) || (arg[len] && arg[len] != '='))
+      continue;
+    *strategy = static_cast<WaitStrategy>(i);
+    *period = arg[len] ? atoi(arg + len + 1) : (i == WAIT_TIMEOUT ? 1 : 0);
+    return true;
+  }
+  return false;
+}
+
+bool EventWaiter::waitEpoll(SDL_Event *event) {
+  epoll_event ready[8];
+  for (;;) {
+    // SDL's own events (quit, hotplug) still come through the period
+    if (SDL_PollEvent(event))
+      return true;
+    if (epoll_wait(probe.getEpollFd(), ready, 8, period) > 0) {
+      // the set is level triggered, input SDL never reports (EV_SYN,
+      // MSC_SCAN, filtered axes) would keep it readable and spin the loop
+      epollKernelTime = probe.drain();
+      // the kernel has input, SDL may need a moment to pass it on
+      uint64_t until = monotonicMicros() + 2000;
+      while (!SDL_PollEvent(event)) {
+        if (monotonicMicros() > until) {
+          // nothing came of it, the timestamp belongs to no event
+          epollKernelTime = 0;
+          return false;
+        }
+        sched_yield();
+      }
+      return true;
+    }
+  }
+}
+
+int EventWaiter::wait(SDL_Event *event) {
+  // the timestamps in the probe now belong to events already handled
+  probe.drain();
+
+  int result = 1;
+  switch (strategy) {
+  case WAIT_BLOCK:
+    result = SDL_WaitEvent(event);
+    break;
+  case WAIT_TIMEOUT:
+    while (!waitEventTimeout(event, period));
+    break;
+  case WAIT_POLL:
+    while (!SDL_PollEvent(event));
+    break;
+  case WAIT_EPOLL:
+    while (!waitEpoll(event));
+    break;
+  }
+
+  ++wakeups;
+  uint64_t kernelTime = probe.drain();
+  if (epollKernelTime && (!kernelTime || epollKernelTime < kernelTime))
+    kernelTime = epollKernelTime;
+  epollKernelTime = 0;
+  eventKernelTime = kernelTime;
+  if (kernelTime) {
+    uint64_t now = monotonicMicros();
+    uint64_t delay = now > kernelTime ? now - kernelTime : 0;
+    ++delayed;
+    delaySum += delay;
+    if (delay > delayMax) delayMax = delay;
+  }
+  return result;
+}
+
+static uint64_t cpuMicros(const rusage &usage) {
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL +
+      usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+void EventWaiter::printStats() {
+  rusage usage;
+  getrusage(RUSAGE_THREAD, &usage);
+  uint64_t wall = monotonicMicros() - startTime;
+  uint64_t cpu = cpuMicros(usage) - cpuMicros(startUsage);
+  printf("Wait strategy %s", strategyNames[strategy]);
+  if (strategy == WAIT_TIMEOUT || strategy == WAIT_EPOLL)
+    printf(" (%d ms)", period);
+  printf(": %llu wake-ups, CPU %.1f%% of %.1f s\n",
+      static_cast<unsigned long long>(wakeups),
+      wall ? cpu * 100.0 / wall : 0.0, wall / 1e6);
+  if (delayed) {
+    printf("Wake-up delay: %.3f ms average, %.3f ms max over %llu input events\n",
+        delaySum / 1000.0 / delayed, delayMax / 1000.0,
+        static_cast<unsigned long long>(delayed));
+  } else {
+    printf("Wake-up delay: no evdev timestamps (is /dev/input readable?)\n");
+  }
+  if (probe.getOverruns()) {
+    printf("Evdev buffers overflowed %llu times, the events lost are missing from"
+        " the delay and bounce figures\n", static_cast<unsigned long long>(probe.getOverruns()));
+  }
+  fflush(stdout);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/resource.h>
+
+#include "sdlcompat.hh"
+
+// Reads the evdev nodes under /dev/input alongside SDL (without grabbing
+// them) for the kernel timestamps of the input events, and to have an fd
+// that wakes up exactly when the kernel has input for us.
+class InputProbe {
+public:
+  // receives every key and button transition with its kernel timestamp;
+  // node is the N of /dev/input/eventN
+  typedef void (*KeySink)(void *context, const char *device, int node,
+      int code, bool down, uint64_t micros);
+private:
+  static const int MAX_NODES = 32;
+
+  int epollFd;
+  int fds[MAX_NODES];
+  int nodes[MAX_NODES];
+  char names[MAX_NODES][64];
+  // after a SYN_DROPPED, until the next SYN_REPORT
+  bool resyncing[MAX_NODES];
+  int numFds;
+  uint64_t overruns;
+  KeySink keySink;
+  void *keySinkContext;
+public:
+  InputProbe();
+  ~InputProbe();
+
+  // reopens the nodes, call after devices come or go
+  void rescan();
+  inline bool isAvailable() { return numFds > 0; }
+  inline int getEpollFd() { return epollFd; }
+  inline void setKeySink(KeySink sink, void *context) {
+    keySink = sink;
+    keySinkContext = context;
+  }
+
+  // reads everything pending, returns the CLOCK_MONOTONIC timestamp of the
+  // oldest event in microseconds, or 0 when there was none
+  uint64_t drain();
+  // times a node's buffer overflowed (SYN_DROPPED) before it was drained,
+  // the events lost with it are missing from the delay and bounce figures
+  inline uint64_t getOverruns() { return overruns; }
+};
+
+enum WaitStrategy {
+  WAIT_BLOCK,
+  WAIT_TIMEOUT,
+  WAIT_POLL,
+  WAIT_EPOLL,
+};
+
+// Replaces SDL_WaitEvent in the event loop, waiting in the chosen way and
+// keeping track of the wake-up delay (kernel timestamp to the event coming
+// out of wait()) and of the CPU time the thread used meanwhile.
+class EventWaiter {
+  WaitStrategy strategy;
+  int period;
+  InputProbe &probe;
+  // oldest evdev timestamp drained by waitEpoll for the event it returns
+  uint64_t epollKernelTime;
+  // the same for the event wait() last returned, 0 if none was drained
+  uint64_t eventKernelTime;
+
+  uint64_t wakeups, delayed;
+  uint64_t delaySum, delayMax;
+  uint64_t startTime;
+  rusage startUsage;
+
+  bool waitEpoll(SDL_Event *event);
+public:
+  // period: milliseconds for WAIT_TIMEOUT and WAIT_EPOLL, 0 spins
+  EventWaiter(WaitStrategy strategy, int period, InputProbe &probe);
+
+  static bool parse(const char *arg, WaitStrategy *strategy, int *period);
+
+  // blocks until there's an event like SDL_WaitEvent
+  int wait(SDL_Event *event);
+  // CLOCK_MONOTONIC microseconds the kernel saw the input that woke the
+  // last wait(), 0 when it was already queued or evdev isn't readable
+  inline uint64_t getEventKernelTime() { return eventKernelTime; }
+  void printStats();
+};
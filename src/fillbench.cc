@@ -0,0 +1,89 @@
+#include "fillbench.hh"
+#include "timing.hh"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static const int NUM_RECTS = 256;
+static const int ROUNDS = 200;
+
+static void layoutButtons(VideoSurface *surface, SurfaceRect *rects) {
+  // the renderDevice grid of 16 columns, sized to the surface
+  int rw = (surface->getWidth() - 16) / 16;
+  int rh = (surface->getHeight() - 16) / (NUM_RECTS / 16);
+  for (int i = 0; i < NUM_RECTS; ++i) {
+    rects[i].x = 8 + rw * (i & 15);
+    rects[i].y = 8 + rh * (i >> 4);
+    rects[i].w = rw * 7 / 8;
+    rects[i].h = rh * 7 / 8;
+  }
+}
+
+static void strokeWithFill(VideoSurface *s, const SurfaceRect &r, uint32_t color) {
+  s->fill(r.x, r.y, 1, r.h, color);
+  s->fill(r.x, r.y, r.w, 1, color);
+  s->fill(r.x + r.w - 1, r.y, 1, r.h, color);
+  s->fill(r.x, r.y + r.h - 1, r.w, 1, color);
+}
+
+static std::vector<uint32_t> grab(VideoSurface *surface) {
+  std::vector<uint32_t> pixels(surface->getWidth() * surface->getHeight());
+  LockedSurface ls;
+  if (!surface->lock(&ls)) {
+    for (int y = 0; y < ls.h; ++y) {
+      memcpy(&pixels[y * ls.w], ls.pixels + y * ls.pitch, ls.w * 4);
+    }
+    surface->unlock();
+  }
+  return pixels;
+}
+
+static double nanosPerRect(uint64_t start) {
+  return static_cast<double>(monotonicNanos() - start) / (ROUNDS * NUM_RECTS);
+}
+
+void benchmarkFills(VideoSurface *surface) {
+  SurfaceRect rects[NUM_RECTS];
+  layoutButtons(surface, rects);
+  uint32_t color = surface->mapRGBA(255, 200, 64, 255);
+  uint32_t clear = surface->mapRGBA(0, 0, 0, 255);
+
+  surface->fill(clear);
+  uint64_t start = monotonicNanos();
+  for (int round = 0; round < ROUNDS; ++round) {
+    for (int i = 0; i < NUM_RECTS; ++i) strokeWithFill(surface, rects[i], color);
+  }
+  double sdlStroke = nanosPerRect(start);
+  std::vector<uint32_t> expected = grab(surface);
+
+  surface->fill(clear);
+  start = monotonicNanos();
+  for (int round = 0; round < ROUNDS; ++round) {
+    surface->strokeRects(rects, NUM_RECTS, color);
+  }
+  double nativeStroke = nanosPerRect(start);
+  bool strokeMatch = grab(surface) == expected;
+
+  surface->fill(clear);
+  start = monotonicNanos();
+  for (int round = 0; round < ROUNDS; ++round) {
+    for (int i = 0; i < NUM_RECTS; ++i) surface->fill(rects[i].x, rects[i].y, rects[i].w, rects[i].h, color);
+  }
+  double sdlFill = nanosPerRect(start);
+  expected = grab(surface);
+
+  surface->fill(clear);
+  start = monotonicNanos();
+  for (int round = 0; round < ROUNDS; ++round) {
+    surface->fillRects(rects, NUM_RECTS, color);
+  }
+  double nativeFill = nanosPerRect(start);
+  bool fillMatch = grab(surface) == expected;
+
+  printf("%d rects of %dx%d, %d rounds, ns per rect:\n", NUM_RECTS, rects[0].w, rects[0].h, ROUNDS);
+  printf("  outline  4x SDL_FillRect %8.1f  strokeRects %8.1f  (%.1fx, %s)\n",
+    sdlStroke, nativeStroke, sdlStroke / nativeStroke, strokeMatch ? "identical" : "MISMATCH");
+  printf("  filled     SDL_FillRect %8.1f  fillRects   %8.1f  (%.1fx, %s)\n",
+    sdlFill, nativeFill, sdlFill / nativeFill, fillMatch ? "identical" : "MISMATCH");
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "sdlcompat.hh"
+
+// --bench-fill: the button grid drawn with SDL_FillRect based fill() calls
+// and with the direct primitives, timed and checked for identical pixels
+void benchmarkFills(VideoSurface *surface);
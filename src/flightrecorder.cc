@@ -0,0 +1,161 @@
+#include "flightrecorder.hh"
+#include "timing.hh"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static FlightRecorder *signalTarget = nullptr;
+
+static const char *triggerNames[] = { "key", "latency", "SIGUSR1" };
+static const char *recordNames[] = { "?", "key", "button", "axis", "hat", "mouse", "frame" };
+
+// a latency spike tends to come in bursts, one dump covers them
+static const uint64_t LATENCY_QUIET_MICROS = 5000000;
+
+FlightRecorder::FlightRecorder(): ring(nullptr), head(0), snapshot(nullptr),
+    pending(TRIGGER_NONE), triggerMicros(0), quit(false), numDumps(0), numIgnored(0),
+    started(false), dir("."), latencyThreshold(0), quietUntil(0) {
+}
+
+FlightRecorder::~FlightRecorder() {
+  stop();
+}
+
+void FlightRecorder::onSignal(int) {
+  if (signalTarget)
+    signalTarget->trigger(TRIGGER_SIGNAL);
+}
+
+bool FlightRecorder::start(const char *outputDir, int latencyMs) {
+  ring = static_cast<StreamRecord*>(calloc(CAPACITY, sizeof(StreamRecord)));
+  snapshot = static_cast<StreamRecord*>(malloc(CAPACITY * sizeof(StreamRecord)));
+  if (!ring || !snapshot) {
+    perror("Can't allocate the flight recorder");
+    free(ring);
+    free(snapshot);
+    ring = snapshot = nullptr;
+    return false;
+  }
+  dir = outputDir;
+  latencyThreshold = latencyMs * 1000;
+  sem_init(&wake, 0, 0);
+  dumper = std::thread(&FlightRecorder::run, this);
+  started = true;
+
+  signalTarget = this;
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGUSR1, &action, nullptr);
+  return true;
+}
+
+void FlightRecorder::stop() {
+  if (!started)
+    return;
+  signal(SIGUSR1, SIG_DFL);
+  signalTarget = nullptr;
+  quit = true;
+  sem_post(&wake);
+  dumper.join();
+  sem_destroy(&wake);
+  free(ring);
+  free(snapshot);
+  ring = snapshot = nullptr;
+  started = false;
+}
+
+void FlightRecorder::frameShown(uint64_t micros, uint64_t renderMicros, uint64_t latencyMicros) {
+  StreamRecord r;
+  r.micros = micros;
+  r.type = STREAM_FRAME;
+  r.device = 0;
+  r.code = renderMicros < 0xffff ? renderMicros : 0xffff;
+  r.value = latencyMicros < 0x7fffffff ? latencyMicros : 0x7fffffff;
+  record(r);
+  if (latencyThreshold && latencyMicros >= static_cast<uint64_t>(latencyThreshold) &&
+      micros >= quietUntil) {
+    quietUntil = micros + LATENCY_QUIET_MICROS;
+    trigger(TRIGGER_LATENCY);
+  }
+}
+
+void FlightRecorder::trigger(Trigger why) {
+  if (!started)
+    return;
+  int expected = TRIGGER_NONE;
+  if (pending.compare_exchange_strong(expected, why)) {
+    triggerMicros = monotonicMicros();
+    sem_post(&wake);
+  } else {
+    ++numIgnored;
+  }
+}
+
+void FlightRecorder::run() {
+  while (true) {
+    sem_wait(&wake);
+    int why = pending;
+    if (why != TRIGGER_NONE) {
+      dump(why, triggerMicros);
+      pending = TRIGGER_NONE;
+    }
+    if (quit)
+      break;
+  }
+}
+
+void FlightRecorder::dump(int why, uint64_t when) {
+  // records the writer overwrites while we copy are thrown away: after the
+  // copy only the indices still in the ring at the second read are valid,
+  // minus the oldest one, whose slot the writer may be filling right now
+  uint64_t end = head.load(std::memory_order_acquire);
+  memcpy(snapshot, ring, CAPACITY * sizeof(StreamRecord));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint64_t after = head.load(std::memory_order_relaxed);
+  uint64_t begin = after >= CAPACITY ? after - CAPACITY + 1 : 0;
+  if (begin >= end)
+    return;
+
+  char stamp[32];
+  char path[1024];
+  time_t now = time(nullptr);
+  struct tm local;
+  localtime_r(&now, &local);
+  strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+  snprintf(path, sizeof(path), "%s/flight-%s-%d.txt", dir, stamp, numDumps.load());
+  FILE *out = fopen(path, "w");
+  if (!out) {
+    perror("Can't write the flight recorder dump");
+    return;
+  }
+  fprintf(out, "# trigger: %s, %llu records, times in ms relative to the trigger\n",
+    triggerNames[why], static_cast<unsigned long long>(end - begin));
+  for (uint64_t i = begin; i < end; ++i) {
+    const StreamRecord &r(snapshot[i & (CAPACITY - 1)]);
+    double t = (static_cast<int64_t>(r.micros) - static_cast<int64_t>(when)) / 1000.0;
+    const char *name = r.type < sizeof(recordNames) / sizeof(*recordNames) ? recordNames[r.type] : "?";
+    if (r.type == STREAM_FRAME) {
+      fprintf(out, "%12.3f frame render %u us latency %d us\n", t, r.code, r.value);
+    } else {
+      fprintf(out, "%12.3f %-6s device %u code 0x%03x value %d\n", t, name, r.device, r.code, r.value);
+    }
+  }
+  if (fclose(out)) {
+    perror("Can't write the flight recorder dump");
+    return;
+  }
+  ++numDumps;
+  printf("Flight recorder (%s) dumped to %s\n", triggerNames[why], path);
+}
+
+void FlightRecorder::printStats() {
+  if (numDumps || numIgnored)
+    printf("Flight recorder: %d dumps, %d triggers during a dump ignored\n",
+      numDumps.load(), numIgnored.load());
+}
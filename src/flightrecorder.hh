@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <semaphore.h>
+
+#include "eventstream.hh"
+
+// Keeps the most recent input events and frames in memory at all times and
+// writes them out as text when something goes wrong: a frame over the
+// --flight-latency threshold, SIGUSR1 or, with --flight-key, the Pause key. Recording is a store into
+// the ring, the dump thread takes a snapshot without stopping the writer.
+//
+// Records use the --socket layout, except that frames carry the render time
+// in code (µs, saturated) and the input to present latency in value (µs).
+class FlightRecorder {
+public:
+  static const int CAPACITY = 1 << 16;
+  enum Trigger {
+    TRIGGER_NONE = -1,
+    TRIGGER_KEY,
+    TRIGGER_LATENCY,
+    TRIGGER_SIGNAL,
+  };
+private:
+  StreamRecord *ring;
+  // written by the event loop only
+  std::atomic<uint64_t> head;
+  StreamRecord *snapshot;
+  std::atomic<int> pending;
+  std::atomic<uint64_t> triggerMicros;
+  std::atomic<bool> quit;
+  std::atomic<int> numDumps, numIgnored;
+  sem_t wake;
+  bool started;
+  std::thread dumper;
+  const char *dir;
+  int latencyThreshold;
+  uint64_t quietUntil;
+
+  void run();
+  void dump(int why, uint64_t when);
+  static void onSignal(int sig);
+public:
+  FlightRecorder();
+  ~FlightRecorder();
+
+  // latencyMs 0 disables the latency trigger
+  bool start(const char *dir, int latencyMs);
+  void stop();
+
+  inline void record(const StreamRecord &r) {
+    if (!ring)
+      return;
+    uint64_t h = head.load(std::memory_order_relaxed);
+    ring[h & (CAPACITY - 1)] = r;
+    head.store(h + 1, std::memory_order_release);
+  }
+  void frameShown(uint64_t micros, uint64_t renderMicros, uint64_t latencyMicros);
+  // async-signal-safe, ignored while a dump is in progress
+  void trigger(Trigger why);
+  void printStats();
+};
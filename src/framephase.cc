@@ -0,0 +1,5 @@
+#include "framephase.hh"
+
+const char *framePhaseNames[NUM_FRAME_PHASES] = {
+  "background", "buttons", "hats", "axes", "overlay", "text", "present"
+};
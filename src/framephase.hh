@@ -0,0 +1,18 @@
+#pragma once
+
+// Parts of a repaint, in the order KeyDisplay::displayString goes through
+// them. Device panels are composed in the background phase; redrawing a
+// dirty panel switches to the buttons, hats and axes phases and back.
+enum FramePhase {
+  PHASE_NONE = -1,
+  PHASE_BACKGROUND,
+  PHASE_BUTTONS,
+  PHASE_HATS,
+  PHASE_AXES,
+  PHASE_OVERLAY,
+  PHASE_TEXT,
+  PHASE_PRESENT,
+  NUM_FRAME_PHASES
+};
+
+extern const char *framePhaseNames[NUM_FRAME_PHASES];
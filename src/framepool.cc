@@ -0,0 +1,148 @@
+#include "framepool.hh"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+SurfacePool::SurfacePool(Video *video):
+    video(video), inUse(0), highWater(0), requests(0), misses(0) {
+  memset(stats, 0, sizeof(stats));
+}
+
+SurfacePool::~SurfacePool() {
+  for (size_t i = 0; i < entries.size(); ++i) {
+    delete entries[i].surface;
+  }
+}
+
+int SurfacePool::bucketShift(int size) {
+  int shift = MIN_BUCKET_SHIFT;
+  while ((1 << shift) < size && shift < MIN_BUCKET_SHIFT + NUM_BUCKET_SHIFTS - 1)
+    ++shift;
+  return shift;
+}
+
+VideoSurface* SurfacePool::acquire(int w, int h) {
+  int ws = bucketShift(w);
+  int hs = bucketShift(h);
+  ++requests;
+  if (w > (1 << ws) || h > (1 << hs)) {
+    // larger than the largest bucket, nothing sensible to pool
+    return nullptr;
+  }
+  int bucket = (ws - MIN_BUCKET_SHIFT) * NUM_BUCKET_SHIFTS + hs - MIN_BUCKET_SHIFT;
+  Entry *entry = nullptr;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (!entries[i].inUse && entries[i].bucket == bucket) {
+      entry = &entries[i];
+      break;
+    }
+  }
+  if (!entry) {
+    ++misses;
+    Entry created { video->createSurface(1 << ws, 1 << hs), bucket, false };
+    entries.push_back(created);
+    entry = &entries.back();
+    ++stats[bucket].created;
+  }
+  entry->inUse = true;
+  entry->surface->resize(w, h);
+  BucketStats &bs(stats[bucket]);
+  if (++bs.inUse > bs.highWater) bs.highWater = bs.inUse;
+  if (++inUse > highWater) highWater = inUse;
+  return entry->surface;
+}
+
+void SurfacePool::reserve(int w, int h, int count) {
+  for (int i = 0; i < count; ++i) {
+    acquire(w, h);
+  }
+  endFrame();
+}
+
+void SurfacePool::endFrame() {
+  if (!inUse)
+    return;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    if (entries[i].inUse) {
+      entries[i].inUse = false;
+      --stats[entries[i].bucket].inUse;
+    }
+  }
+  inUse = 0;
+}
+
+void SurfacePool::printStats() {
+  if (!requests)
+    return;
+  printf("Surface pool: %llu requests, %llu created, at most %d in use\n",
+      static_cast<unsigned long long>(requests),
+      static_cast<unsigned long long>(misses), highWater);
+  for (int ws = 0; ws < NUM_BUCKET_SHIFTS; ++ws) {
+    for (int hs = 0; hs < NUM_BUCKET_SHIFTS; ++hs) {
+      const BucketStats &bs(stats[ws * NUM_BUCKET_SHIFTS + hs]);
+      if (bs.created) {
+        printf("  %dx%d: %d created, high-water %d\n",
+            1 << (ws + MIN_BUCKET_SHIFT), 1 << (hs + MIN_BUCKET_SHIFT), bs.created, bs.highWater);
+      }
+    }
+  }
+}
+
+FrameArena::FrameArena(size_t capacity):
+    block(static_cast<uint8_t*>(malloc(capacity))), capacity(capacity),
+    used(0), frameTotal(0), highWater(0), overflows(0) {
+}
+
+FrameArena::~FrameArena() {
+  reset();
+  free(block);
+}
+
+void* FrameArena::allocate(size_t size, size_t align) {
+  size_t start = (used + align - 1) & ~(align - 1);
+  frameTotal += size + (start - used);
+  if (frameTotal > highWater) highWater = frameTotal;
+  if (start + size <= capacity) {
+    used = start + size;
+    return block + start;
+  }
+  ++overflows;
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, align < sizeof(void*) ? sizeof(void*) : align, size))
+    return nullptr;
+  overflow.push_back(ptr);
+  return ptr;
+}
+
+void FrameArena::reset() {
+  if (!overflow.empty()) {
+    for (size_t i = 0; i < overflow.size(); ++i) {
+      free(overflow[i]);
+    }
+    overflow.clear();
+    if (highWater > capacity) {
+      // grow so the heaviest frame so far fits in the block
+      free(block);
+      capacity = highWater;
+      block = static_cast<uint8_t*>(malloc(capacity));
+    }
+  }
+  used = 0;
+  frameTotal = 0;
+}
+
+void FrameArena::printStats() {
+  if (!highWater)
+    return;
+  printf("Frame arena: %zu bytes capacity, high-water %zu bytes, %llu overflowing allocations\n",
+      capacity, highWater, static_cast<unsigned long long>(overflows));
+}
+
+VideoSurface* Video::scratchSurface(int w, int h) {
+  return pool->acquire(w, h);
+}
+
+void* Video::frameAlloc(size_t size) {
+  return arena->allocate(size);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "sdlcompat.hh"
+
+// Scratch surfaces for drawing that only lives until the frame is shown.
+// Sizes are rounded up to powers of two per dimension so a handful of
+// surfaces can serve every request; the borrowed surface is clipped to
+// the requested size. Video::present() returns everything to the pool.
+class SurfacePool {
+public:
+  static const int MIN_BUCKET_SHIFT = 4;
+  static const int NUM_BUCKET_SHIFTS = 8;
+
+  struct BucketStats {
+    int created;
+    int inUse;
+    int highWater;
+  };
+private:
+  struct Entry {
+    VideoSurface *surface;
+    int bucket;
+    bool inUse;
+  };
+
+  Video *video;
+  std::vector<Entry> entries;
+  BucketStats stats[NUM_BUCKET_SHIFTS * NUM_BUCKET_SHIFTS];
+  int inUse, highWater;
+  uint64_t requests, misses;
+
+  static int bucketShift(int size);
+public:
+  SurfacePool(Video *video);
+  ~SurfacePool();
+
+  VideoSurface* acquire(int w, int h);
+  // creates surfaces ahead of time so the first frames don't allocate
+  void reserve(int w, int h, int count);
+  void endFrame();
+
+  inline const BucketStats& bucketStats(int wShift, int hShift) {
+    return stats[(wShift - MIN_BUCKET_SHIFT) * NUM_BUCKET_SHIFTS + hShift - MIN_BUCKET_SHIFT];
+  }
+  void printStats();
+};
+
+// Bump allocator for other per-frame temporaries, reset by present().
+// When a frame needs more than the block holds, the excess comes from the
+// heap and the block is grown to the high-water mark at the next reset.
+class FrameArena {
+  uint8_t *block;
+  size_t capacity;
+  size_t used;
+  size_t frameTotal;
+  size_t highWater;
+  std::vector<void*> overflow;
+  uint64_t overflows;
+public:
+  FrameArena(size_t capacity = 64 * 1024);
+  ~FrameArena();
+
+  void* allocate(size_t size, size_t align = 16);
+  template<typename T>
+  inline T* allocate(size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+  void reset();
+
+  inline size_t getHighWater() { return highWater; }
+  void printStats();
+};
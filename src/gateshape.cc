@@ -0,0 +1,105 @@
+#include "gateshape.hh"
+
+#include <math.h>
+#include <string.h>
+
+// atan(i / 64) in binary angle units
+static const uint8_t octantAngles[65] = {
+  0, 1, 1, 2, 3, 3, 4, 4, 5, 6, 6, 7, 8, 8, 9, 9, 10, 11, 11, 12, 12, 13,
+  13, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20, 20, 21, 21, 22, 22,
+  23, 23, 24, 24, 25, 25, 25, 26, 26, 27, 27, 27, 28, 28, 29, 29, 29, 30,
+  30, 30, 31, 31, 31, 32, 32
+};
+
+// cos and sin of each direction in 1.14 fixed point, for drawing
+static int16_t binCos[GateShape::NUM_BINS], binSin[GateShape::NUM_BINS];
+
+int angleBin(int x, int y) {
+  int ax = x < 0 ? -x : x;
+  int ay = y < 0 ? -y : y;
+  int a;
+  if (ax >= ay) {
+    a = ax ? octantAngles[(ay << 6) / ax] : 0;
+  } else {
+    a = 64 - octantAngles[(ax << 6) / ay];
+  }
+  if (x < 0) a = 128 - a;
+  if (y < 0) a = 256 - a;
+  return a & 255;
+}
+
+GateShape::GateShape() {
+  memset(maxRadius2, 0, sizeof(maxRadius2));
+  memset(dirty, 0, sizeof(dirty));
+  memset(drawnX, 0xff, sizeof(drawnX));
+  memset(drawnY, 0xff, sizeof(drawnY));
+  if (!binCos[0]) {
+    for (int i = 0; i < NUM_BINS; ++i) {
+      binCos[i] = lround(cos(i * M_PI / 128) * 16384);
+      binSin[i] = lround(sin(i * M_PI / 128) * 16384);
+    }
+  }
+}
+
+double GateShape::circularityError(int *directions) {
+  double radii[NUM_BINS];
+  double sum = 0;
+  int count = 0;
+  for (int i = 0; i < NUM_BINS; ++i) {
+    if (!maxRadius2[i]) continue;
+    radii[count] = sqrt(static_cast<double>(maxRadius2[i]));
+    sum += radii[count++];
+  }
+  *directions = count;
+  if (!count)
+    return -1;
+  double mean = sum / count;
+  double error = 0;
+  for (int i = 0; i < count; ++i) {
+    error += fabs(radii[i] - mean);
+  }
+  return error / count / mean * 100;
+}
+
+void GateShape::plotBin(LockedSurface &locked, int bin, uint32_t color) {
+  int r = static_cast<int>(sqrt(static_cast<double>(maxRadius2[bin])));
+  // same mapping as the axis trail: -32768..32767 across the box
+  int x = ((binCos[bin] * r / 16384 + 32768) * (locked.w - 1)) >> 16;
+  int y = ((binSin[bin] * r / 16384 + 32768) * (locked.h - 1)) >> 16;
+  if (x < 0 || y < 0 || x >= locked.w || y >= locked.h)
+    return;
+  reinterpret_cast<uint32_t*>(locked.pixels + y * locked.pitch)[x] = color;
+  drawnX[bin] = x;
+  drawnY[bin] = y;
+}
+
+void GateShape::renderOverlay(VideoSurface *overlay, uint32_t color, uint32_t clear, bool all) {
+  if (all) {
+    memset(dirty, 0xff, sizeof(dirty));
+    overlay->fill(clear);
+    memset(drawnX, 0xff, sizeof(drawnX));
+  }
+  if (!(dirty[0] | dirty[1] | dirty[2] | dirty[3]))
+    return;
+  LockedSurface locked;
+  if (overlay->lock(&locked))
+    return;
+  for (int w = 0; w < NUM_BINS / 64; ++w) {
+    while (dirty[w]) {
+      int bin = (w << 6) + __builtin_ctzll(dirty[w]);
+      dirty[w] &= dirty[w] - 1;
+      if (!maxRadius2[bin]) continue;
+      if (drawnX[bin] >= 0) {
+        reinterpret_cast<uint32_t*>(locked.pixels + drawnY[bin] * locked.pitch)[drawnX[bin]] = clear;
+        // neighbours may have shared the pixel
+        for (int n = bin - 1; n <= bin + 1; n += 2) {
+          int nb = n & (NUM_BINS - 1);
+          if (drawnX[nb] == drawnX[bin] && drawnY[nb] == drawnY[bin])
+            plotBin(locked, nb, color);
+        }
+      }
+      plotBin(locked, bin, color);
+    }
+  }
+  overlay->unlock();
+}
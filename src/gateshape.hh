@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+
+// Binary angle (256 to a turn, 0 along +x, 64 along +y) of a stick
+// position, from a table of the first octant instead of atan2.
+int angleBin(int x, int y);
+
+// The outline of a stick's gate: the farthest it has been pushed in each
+// of 256 directions. Samples only cost an angle lookup and a compare;
+// directions that moved out are redrawn on the next overlay render.
+class GateShape {
+public:
+  static const int NUM_BINS = 256;
+private:
+  uint32_t maxRadius2[NUM_BINS];
+  uint64_t dirty[NUM_BINS / 64];
+  // overlay pixel of each direction, -1 if none is drawn
+  int16_t drawnX[NUM_BINS], drawnY[NUM_BINS];
+
+  void plotBin(LockedSurface &locked, int bin, uint32_t color);
+public:
+  GateShape();
+
+  inline void add(int x, int y) {
+    uint32_t r2 = static_cast<uint32_t>(x * x) + static_cast<uint32_t>(y * y);
+    int bin = angleBin(x, y);
+    if (r2 <= maxRadius2[bin])
+      return;
+    maxRadius2[bin] = r2;
+    dirty[bin >> 6] |= 1ULL << (bin & 63);
+  }
+
+  // mean deviation of the outline from its average radius in percent,
+  // over the directions seen; -1 before there are any
+  double circularityError(int *directions);
+  // moves the points of changed directions, or draws all of them
+  void renderOverlay(VideoSurface *overlay, uint32_t color, uint32_t clear, bool all);
+};
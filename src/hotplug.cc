@@ -0,0 +1,62 @@
+#include "hotplug.hh"
+
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+static int watchFd = -1;
+static int pushType = 0;
+static bool changePending = false;
+static SDL_TimerID watchTimer;
+
+static Uint32 pollWatcher(Uint32 interval, void *param) {
+  if (changePending) {
+    // the change was seen on the previous tick, report it now
+    changePending = false;
+    SDL_Event event;
+    memset(&event, 0, sizeof(event));
+    event.type = pushType;
+    SDL_PushEvent(&event);
+  }
+
+  alignas(inotify_event) char buffer[1024];
+  ssize_t len;
+  while ((len = read(watchFd, buffer, sizeof(buffer))) > 0) {
+    for (char *p = buffer; p < buffer + len; ) {
+      inotify_event *ev = reinterpret_cast<inotify_event*>(p);
+      if (ev->len && (!strncmp(ev->name, "js", 2) || !strncmp(ev->name, "event", 5)))
+        changePending = true;
+      p += sizeof(inotify_event) + ev->len;
+    }
+  }
+  return interval;
+}
+
+bool startJoystickWatcher(int eventType) {
+  if (watchFd >= 0)
+    return true;
+  watchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (watchFd < 0) {
+    perror("Cannot watch for joystick changes");
+    return false;
+  }
+  if (inotify_add_watch(watchFd, "/dev/input", IN_CREATE | IN_DELETE) < 0) {
+    perror("Cannot watch /dev/input");
+    close(watchFd);
+    watchFd = -1;
+    return false;
+  }
+  pushType = eventType;
+  watchTimer = SDL_AddTimer(500, pollWatcher, nullptr);
+  return true;
+}
+
+void stopJoystickWatcher() {
+  if (watchFd < 0)
+    return;
+  SDL_RemoveTimer(watchTimer);
+  close(watchFd);
+  watchFd = -1;
+}
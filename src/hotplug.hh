@@ -0,0 +1,10 @@
+#pragma once
+
+#include "sdlcompat.hh"
+
+// SDL1 has no joystick hotplug events: this watches /dev/input and pushes
+// an event of the given type (a short while after the change settles, so
+// udev had time to fix up permissions) whenever an input node comes or goes.
+// The receiver is expected to reinitialize the joystick subsystem.
+bool startJoystickWatcher(int eventType);
+void stopJoystickWatcher();
@@ -1,30 +1,45 @@
-#include <sstream>
+#include <atomic>
 #include <iostream>
 #include <cstring>
+#include <cstdlib>
+#include <thread>
 
 #include "sdlcompat.hh"
-#include "font.h"
+#include "hotplug.hh"
+#include "keystate.hh"
+#include "labels.hh"
+#include "allocstats.hh"
+#include "framepool.hh"
+#include "bitmapfont.hh"
+#include "sdftext.hh"
+#include "timing.hh"
+#include "realtime.hh"
+#include "eventwait.hh"
+#include "perfcounters.hh"
+#include "trace.hh"
+#include "scopestats.hh"
+#include "trail.hh"
+#include "axishistogram.hh"
+#include "gateshape.hh"
+#include "axisnoise.hh"
+#include "bounce.hh"
+#include "rollover.hh"
+#include "sharedexport.hh"
+#include "eventstream.hh"
+#include "screenshot.hh"
+#include "recorder.hh"
+#include "flightrecorder.hh"
+#include "fillbench.hh"
 
 SDL_Color color = {0xb5, 0x7e, 0xdc}; // Lavender color
 
 VideoSurface* screen;
-TTF_Font* font;
-TTF_Font* smallFont;
+Font font(32);
 
 const int TYPE_KEY = 0 << 16;
 const int TYPE_BUTTON = 1 << 16;
 const int TYPE_HAT = 2 << 16;
 
-inline uint32_t ablend(uint32_t col, uint8_t alpha) {
-	uint64_t v = 
-		(((col & 0xff0000ULL) << 16) |
-		((col & 0xff00ULL) << 8) |
-		col & 0xffULL) * alpha;
-	return ((v >> 24) & 0xff0000) |
-		((v >> 16) & 0xff00) |
-		((v >> 8) & 0xff);
-}
-
 uint64_t nextSeed(uint64_t seed) {
   return (seed * 0x5DEECE66DLL + 0xBLL) & ((1LL << 48) - 1);
 }
@@ -172,50 +187,240 @@ struct AxisInfo {
   }
 };
 
-class KeyDisplay {
-  Video &video;
-  const char **keys;
-  int numKeys;
-  bool *buttons;
-  int numButtons, maxButtons;
-  AxisInfo axes[256];
+
+const int MAX_DEVICES = 4;
+const int MAX_BUTTONS = 256;
+const int MAX_AXES = 256;
+
+struct DeviceLayout {
+  // the cell of the device grid on the screen
+  int x, y, w, h;
+  // button and axis box sizes within the cell
+  int rw, rh;
+  int aw, ah;
+  int arw, arh;
+  int numRows, numCols;
+  // pixel size of the axis statistics
+  int numberSize;
+  // height of the code coverage strips under the axis boxes
+  int stripHeight;
+};
+
+class JoyDevice {
+public:
+  SDL_Joystick *joystick;
+  int id;
+  char name[64];
+  bool buttons[MAX_BUTTONS];
+  int maxButtons;
+  AxisInfo axes[MAX_AXES];
+  AxisHistogram *histograms;
+  AxisNoise *noise;
+  // one per axis pair
+  GateShape *gates;
   int numAxes;
-  int mouseX, mouseY;
   int numHats;
+  int hat;
+
+  DeviceLayout layout;
+  VideoSurface *panel;
+  // one per axis pair
   VideoSurface **axisMaps;
+  TrailBuffer **trails;
+  VideoSurface **gateOverlays;
+  // one per axis
+  VideoSurface **strips;
+  // the surfaces above were just made and have to be drawn in full
+  bool freshCaches;
+  bool dirty;
+  bool fading;
+
+  JoyDevice(SDL_Joystick *joystick, int id, const char *deviceName):
+      joystick(joystick), id(id), maxButtons(SDL_JoystickNumButtons(joystick)),
+      numAxes(SDL_JoystickNumAxes(joystick)), numHats(SDL_JoystickNumHats(joystick)), hat(0),
+      panel(nullptr), axisMaps(nullptr), trails(nullptr), gateOverlays(nullptr), strips(nullptr),
+      dirty(true), fading(false) {
+    snprintf(name, sizeof(name), "%s", deviceName ? deviceName : "");
+    memset(buttons, 0, sizeof(buttons));
+    if (maxButtons > MAX_BUTTONS) maxButtons = MAX_BUTTONS;
+    if (numAxes > MAX_AXES) numAxes = MAX_AXES;
+    histograms = new AxisHistogram[numAxes];
+    noise = new AxisNoise(numAxes);
+    for (int i = 0; i < numAxes; ++i) {
+      noise->set(i, SDL_JoystickGetAxis(joystick, i));
+    }
+    gates = new GateShape[(numAxes + 1) >> 1];
+  }
 
-  void drawText(const char *text, int offset);
-  VideoSurface *renderText(TTF_Font *font, const char *text, SDL_Color color) {
-    return video.adapt(TTF_RenderText_Blended(font, text, color));
+  ~JoyDevice() {
+    releaseCaches();
+    delete[] histograms;
+    delete noise;
+    delete[] gates;
+    if (joystick) SDL_JoystickClose(joystick);
   }
-  VideoSurface *rotateLeft(VideoSurface *input, bool disposeInput = false);
+
+  void releaseCaches() {
+    if (axisMaps) {
+      for (int i = 0; i < numAxes; i += 2) {
+        delete axisMaps[i >> 1];
+        delete trails[i >> 1];
+        delete gateOverlays[i >> 1];
+      }
+      delete[] axisMaps;
+      delete[] trails;
+      delete[] gateOverlays;
+      axisMaps = nullptr;
+      trails = nullptr;
+      gateOverlays = nullptr;
+    }
+    if (strips) {
+      for (int i = 0; i < numAxes; ++i) {
+        delete strips[i];
+      }
+      delete[] strips;
+      strips = nullptr;
+    }
+    delete panel;
+    panel = nullptr;
+  }
+};
+
+class KeyDisplay {
+  Video &video;
+  const PressedKeys &keys;
+  JoyDevice *devices[MAX_DEVICES];
+  int numDevices;
+  int gridCols, gridRows;
+  int mouseX, mouseY;
+  VideoSurface *background;
+  // size of the main text, labels are prerendered only in the font's size
+  int textSize;
+  PhaseCounters *counters;
+  FramePhase tracedPhase;
+  uint64_t phaseStart, frameStart;
+  // axis trail levels to pixels, made with the first axis map
+  uint32_t trailPalette[256];
+  uint32_t gateColor, gateClear;
+  bool trailPaletteReady;
+  int trailHalfLife;
+  BounceDetector *bounces;
+  // set in rollover test mode, held keys are shown as a grid
+  RolloverAnalyzer *rollover;
+
+  inline void phase(FramePhase p) {
+    if (counters) counters->enter(p);
+    if (traceEnabled) tracePhase(p);
+  }
+  void tracePhase(FramePhase p);
+  void endFrame();
+
+  void drawText(int labelId, int offset);
+  void drawHeldGrid();
+  void measureNumber(unsigned value, int size, bool rotated, int *w, int *h);
+  void drawNumber(VideoSurface *target, unsigned value, int x, int y, int size, bool rotated);
+  VideoSurface *renderText(Font &font, const char *text, SDL_Color color, bool *borrowed = nullptr) {
+    return font.render(video, text, color, borrowed);
+  }
+  VideoSurface *rotate180(VideoSurface *input, bool disposeInput = false);
+  void renderBackground();
+  void layoutDevices();
+  void layoutDevice(JoyDevice *dev, int cell);
+  void renderDevice(JoyDevice *dev);
 public:
-  inline KeyDisplay(Video &video, const char **keys, int numKeys, bool *buttons, int numButtons, int numAxes, int numHats):
+  inline KeyDisplay(Video &video, const PressedKeys &keys):
       video(video),
-      keys(keys), numKeys(numKeys),
-      buttons(buttons), numButtons(numButtons), maxButtons(0), numAxes(numAxes), numHats(numHats),
-      axisMaps(nullptr) {
+      keys(keys),
+      numDevices(0), gridCols(1), gridRows(1),
+      background(nullptr), counters(nullptr), tracedPhase(PHASE_NONE),
+      trailPaletteReady(false), trailHalfLife(1000), bounces(nullptr),
+      rollover(nullptr) {
+    textSize = 32 * video.getScreen()->getHeight() / 480;
     mouseX = video.getScreen()->getWidth() * 2;
     mouseY = video.getScreen()->getHeight() * 2;
   }
   ~KeyDisplay() {
-    if (axisMaps) {
-      for (int i = 0; i < numAxes; i += 2) {
-        int index = i >> 1;
-        if (axisMaps[index]) {
-          delete axisMaps[index];
-          axisMaps[index] = nullptr;
-        }
-      }
-      delete axisMaps;
+    for (int i = 0; i < numDevices; ++i) {
+      delete devices[i];
     }
+    delete background;
+  }
+  void displayString(int textLabel, float progress);
+  void warmUp();
+  // before the first frame, creates the scratch surfaces flipped labels
+  // are drawn on
+  void reserveLabelSurfaces();
+  inline void setCounters(PhaseCounters *c) {
+    counters = c;
+  }
+  inline void setTrailHalfLife(int ms) {
+    trailHalfLife = ms;
+  }
+  inline void setBounceDetector(BounceDetector *b) {
+    bounces = b;
   }
-  void displayString(const char *text, float progress, int hat);
-  inline void setMaxButtons(int val) {
-    maxButtons = val;
+  inline void setRollover(RolloverAnalyzer *r) {
+    rollover = r;
   }
-  inline void setAxis(int index, int value) {
-    axes[index] = value;
+  void printAxisSummary();
+  void exportState(SharedState *state);
+  // true while some axis trail still has to fade out
+  bool isFading();
+  // marks the devices with fading trails for a repaint
+  void advanceFading();
+
+  inline int getNumDevices() {
+    return numDevices;
+  }
+  // gives a detached device of the same name its joystick back
+  JoyDevice* reattachDevice(SDL_Joystick *joystick, int id, const char *name);
+  JoyDevice* addDevice(SDL_Joystick *joystick, int id, const char *name);
+  void removeDevice(int id);
+  void detachDevices();
+  void dropDetachedDevices();
+  // the panel position (0 to MAX_DEVICES - 1) of the device with the
+  // given SDL id, -1 when it isn't tracked; SDL2 instance ids keep growing
+  // with every reconnect, anything narrower than an int uses the slot
+  inline int deviceSlot(int id) {
+    for (int i = 0; i < numDevices; ++i) {
+      if (devices[i]->id == id) return i;
+    }
+    return -1;
+  }
+  inline JoyDevice* device(int id) {
+    int slot = deviceSlot(id);
+    return slot < 0 ? nullptr : devices[slot];
+  }
+
+  inline void setAxis(JoyDevice *dev, int index, int value) {
+    if (index >= dev->numAxes) return;
+    dev->axes[index] = value;
+    dev->histograms[index].add(value);
+    dev->noise->set(index, value);
+    dev->dirty = true;
+    // every sample counts, not just the one a frame shows
+    int pair = index & ~1;
+    int x = dev->axes[pair], y = dev->axes[pair + 1];
+    if (x == INT32_MAX) x = 0;
+    if (y == INT32_MAX) y = 0;
+    dev->gates[pair >> 1].add(x, y);
+    if (dev->trails) {
+      dev->trails[pair >> 1]->plot(((x + 32768) * (dev->layout.aw - 1)) >> 8,
+          ((y + 32768) * (dev->layout.ah - 1)) >> 8, 0x6000);
+    }
+  }
+  inline bool setButton(JoyDevice *dev, int button, bool down) {
+    if (dev->buttons[button] == down) return false;
+    dev->buttons[button] = down;
+    if (button >= dev->maxButtons) dev->maxButtons = button + 1;
+    dev->dirty = true;
+    return true;
+  }
+  inline bool setHat(JoyDevice *dev, int value) {
+    if (dev->hat == value) return false;
+    dev->hat = value;
+    dev->dirty = true;
+    return true;
   }
   inline void setMouseMovement(int x, int y) {
     mouseX = x;
@@ -223,71 +428,100 @@ public:
   }
 };
 
-void KeyDisplay::drawText(const char *text, int offset) {
-  VideoSurface *textSurface = renderText(font, text, color);
-
-  if (textSurface) {
-    VideoSurface* rotatedSurface = NULL;
-    
+void KeyDisplay::drawText(int labelId, int offset) {
+  SCOPE_STAT("drawText", "call", 1);
+  Label &l(label(labelId));
 #ifdef FLIP
-    // Create a new surface for the rotated text
-    rotatedSurface = video.createSurface(textSurface->w, textSurface->h);
-
-    if (rotatedSurface) {
-      LockedSurface ts;
-      textSurface->lock(&ts);
-      LockedSurface rs;
-      rotatedSurface->lock(&rs);
-      // Rotate the text 180 degrees
-      for (int y = 0; y < ts.h; ++y) {
-        Uint32 *src = ((Uint32*)ts.pixels) + (y * ts.pitch / 4);
-        Uint32 *dst = ((Uint32*)rs.pixels) + ((ts.h - y - 1) * rs.pitch / 4 + ts.w);
-        for (int x = 0; x < ts.w; ++x) {
-          *--dst = *src++;
-        }
-      }
-      textSurface->unlock();
-      rotatedSurface->unlock();
-    }
+  const int nominator = 1;
+  const int rotation = 2;
+#else
+  const int nominator = 3;
+  const int rotation = 0;
+#endif
+
+  if (textSize != font.getSize()) {
+    // no prerendered glyphs in this size, draw from the distance field
+    int w, h;
+    measureSdfText(l.text, textSize, &w, &h);
+    drawSdfText(screen, l.text,
+        (screen->getWidth() * nominator / 2 - w) / 2,
+        (screen->getHeight() * nominator / 2 - h) / 2 + offset,
+        textSize, rotation, color);
+    return;
+  }
 
-    const int nominator = 1;
+  if (!l.surface && *l.text) {
+#ifdef FLIP
+    // the upright text only lives until it's rotated, borrow it
+    bool borrowed;
+    l.surface = renderText(font, l.text, color, &borrowed);
+    if (l.surface) l.surface = rotate180(l.surface, !borrowed);
 #else
-    const int nominator = 3;
+    l.surface = renderText(font, l.text, color);
 #endif
+  }
+  VideoSurface *textSurface = l.surface;
 
+  if (textSurface) {
     int textLocation[2] = {
       (screen->getWidth() * nominator / 2 - textSurface->getWidth()) / 2,
       (screen->getHeight() * nominator / 2 - textSurface->getHeight()) / 2 + offset,
     };
 
-    if (rotatedSurface) {
-      rotatedSurface->blitOn(screen, textLocation[0], textLocation[1]);
-      delete rotatedSurface;
-    } else {
-      textSurface->blitOn(screen, textLocation[0], textLocation[1]);
-    }
-
-    delete textSurface;
+    textSurface->blitOn(screen, textLocation[0], textLocation[1]);
   }
 }
 
-VideoSurface* KeyDisplay::rotateLeft(VideoSurface *input, bool disposeInput) {
-  VideoSurface *output = video.createSurface(input->getHeight(), input->getWidth());
-  LockedSurface is, os;
-  input->lock(&is);
-  output->lock(&os);
+void KeyDisplay::drawHeldGrid() {
+  const int columns = 8;
+  int size = 12 * screen->getHeight() / 480;
+  if (size < 8) size = 8;
+  int cellW = screen->getWidth() / columns;
+  int cellH = size * 2;
+  uint32_t mainColor = (255u << 24)|color.b|(color.g << 8)|(color.r << 16);
 
-  int pp = os.pitch >> 2;
+  char header[64];
+  snprintf(header, sizeof(header), "held %d/%d  best %d  ghosts %u",
+      rollover->countTargetHeld(keys), rollover->getNumTarget(),
+      rollover->getBestHeld(), rollover->getTotalGhosts());
+  drawSdfText(screen, header, 8, 8, size, 0, color);
+
+  // the prescribed keys still to press
+  char waiting[256] = "hold:";
+  size_t length = strlen(waiting);
+  for (int t = 0; t < rollover->getNumTarget(); ++t) {
+    int code = rollover->getTargetKey(t);
+    if (keys.isDown(code) || length >= sizeof(waiting)) continue;
+    const char *name = keyNameFromCode(code);
+    length += snprintf(waiting + length, sizeof(waiting) - length, " %s", name ? name : "?");
+  }
+  drawSdfText(screen, waiting, 8, 8 + cellH, size, 0, color);
+
+  // newest first, walking only the keys that are down
+  int i = 0;
+  for (int k = keys.first(); k >= 0; k = keys.next(k), ++i) {
+    int x = cellW * (i % columns);
+    int y = 8 + cellH * (2 + i / columns);
+    if (y + cellH > screen->getHeight()) break;
+    screen->strokeRect(x + 1, y + 1, cellW - 2, cellH - 2, mainColor);
+    drawSdfText(screen, label(keys.label(k)).text, x + 4, y + (cellH - size) / 2, size, 0, color);
+  }
+}
 
-  for (int y = 0; y < is.h; ++y) {
-    uint32_t *ip = reinterpret_cast<uint32_t*>(is.pixels + y * is.pitch);
-    uint32_t *op = reinterpret_cast<uint32_t*>(os.pixels) + y + pp * os.h;
-    for (int x = 0; x < is.w; ++x) {
-      op -= pp;
-      *op = *ip++;
+VideoSurface* KeyDisplay::rotate180(VideoSurface *input, bool disposeInput) {
+  SCOPE_STAT("rotate180", "px", input->getWidth() * input->getHeight());
+  VideoSurface *output = video.createSurface(input->getWidth(), input->getHeight());
+  LockedSurface ts;
+  input->lock(&ts);
+  LockedSurface rs;
+  output->lock(&rs);
+  for (int y = 0; y < ts.h; ++y) {
+    Uint32 *src = ((Uint32*)ts.pixels) + (y * ts.pitch / 4);
+    Uint32 *dst = ((Uint32*)rs.pixels) + ((ts.h - y - 1) * rs.pitch / 4 + ts.w);
+    for (int x = 0; x < ts.w; ++x) {
+      *--dst = *src++;
     }
   }
-
   input->unlock();
   output->unlock();
   if (disposeInput)
@@ -295,37 +529,305 @@ VideoSurface* KeyDisplay::rotateLeft(VideoSurface *input, bool disposeInput) {
   return output;
 }
 
+void KeyDisplay::measureNumber(unsigned value, int size, bool rotated, int *w, int *h) {
+  char text[16];
+  snprintf(text, sizeof(text), "%u", value);
+  measureSdfText(text, size, rotated ? h : w, rotated ? w : h);
+}
+
+void KeyDisplay::drawNumber(VideoSurface *target, unsigned value, int x, int y, int size, bool rotated) {
+  char text[16];
+  snprintf(text, sizeof(text), "%u", value);
+  drawSdfText(target, text, x, y, size, rotated ? 1 : 0, color);
+}
+
+void KeyDisplay::renderBackground() {
+  background = video.createSurface(screen->getWidth(), screen->getHeight());
+  background->setBlending(false);
+  FixedGradient bgGrad(SDL_Color { 0, 0, 0 }, color, screen->getHeight() * 3);
+  for (int y = 0; y < screen->getHeight(); ++y) {
+    SDL_Color col(bgGrad.dithered());
+    bgGrad.stepNext();
+    background->hLine(0, y, screen->getWidth(), (255u << 24)|col.b|(col.g << 8)|(col.r << 16));
+  }
+}
+
+JoyDevice* KeyDisplay::reattachDevice(SDL_Joystick *joystick, int id, const char *name) {
+  // a device that went away during a rescan comes back with its state intact
+  for (int i = 0; i < numDevices; ++i) {
+    JoyDevice *dev = devices[i];
+    if (!dev->joystick && !strncmp(dev->name, name ? name : "", sizeof(dev->name) - 1)) {
+      dev->joystick = joystick;
+      dev->id = id;
+      return dev;
+    }
+  }
+  return nullptr;
+}
+
+JoyDevice* KeyDisplay::addDevice(SDL_Joystick *joystick, int id, const char *name) {
+  JoyDevice *dev = reattachDevice(joystick, id, name);
+  if (dev)
+    return dev;
+  if (numDevices >= MAX_DEVICES)
+    return nullptr;
+  dev = new JoyDevice(joystick, id, name);
+  devices[numDevices++] = dev;
+  layoutDevices();
+  return dev;
+}
 
-void KeyDisplay::displayString(const char *text, float progress, int hat) {
-  if (!text) text = "";
-  // if (*text) std::cout << text << std::endl;
-  if (!*text) {
-    for (int i = numKeys - 1; i >= 0; --i) {
-      if (keys[i]) {
-        text = keys[i];
-        break;
+void KeyDisplay::removeDevice(int id) {
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->id == id) {
+      delete devices[i];
+      for (int j = i + 1; j < numDevices; ++j) {
+        devices[j - 1] = devices[j];
       }
+      --numDevices;
+      layoutDevices();
+      return;
     }
   }
-  int lenChecked = strnlen(text, 255) + 1;
+}
 
-  for (int i = maxButtons; i < numButtons; ++i) {
-    if (buttons[i]) maxButtons = i + 1;
+void KeyDisplay::detachDevices() {
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->joystick) {
+      SDL_JoystickClose(devices[i]->joystick);
+      devices[i]->joystick = nullptr;
+    }
+    devices[i]->id = -1;
   }
+}
 
+void KeyDisplay::dropDetachedDevices() {
+  int kept = 0;
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->joystick) {
+      devices[kept++] = devices[i];
+    } else {
+      delete devices[i];
+    }
+  }
+  if (kept != numDevices) {
+    numDevices = kept;
+    layoutDevices();
+  }
+}
+
+void KeyDisplay::layoutDevices() {
+  int cols = numDevices > 1 ? 2 : 1;
+  int rows = numDevices > 2 ? 2 : 1;
+  bool gridChanged = cols != gridCols || rows != gridRows;
+  gridCols = cols;
+  gridRows = rows;
+  for (int i = 0; i < numDevices; ++i) {
+    // devices keep their cell unless the grid or their position changes
+    if (gridChanged || !devices[i]->panel || devices[i]->layout.x != screen->getWidth() / cols * (i % cols)
+        || devices[i]->layout.y != screen->getHeight() / rows * (i / cols)) {
+      layoutDevice(devices[i], i);
+    }
+  }
+}
+
+void KeyDisplay::layoutDevice(JoyDevice *dev, int cell) {
+  DeviceLayout &l(dev->layout);
+  l.w = screen->getWidth() / gridCols;
+  l.h = screen->getHeight() / gridRows;
+  l.x = l.w * (cell % gridCols);
+  l.y = l.h * (cell / gridCols);
+
+  l.rw = (l.w - 32) / 14;
+  l.rh = (l.h - 32) / 14;
+  if (l.rw < l.rh) {
+    l.rh = l.rw;
+  } else {
+    l.rw = l.rh;
+  }
+  l.aw = l.rw * 15 / 8;
+  l.ah = l.rh * 15 / 8;
+  l.arw = l.rw + 12;
+  l.arh = l.rh + 12;
+  l.numRows = (dev->numAxes + 7) / 8;
+  l.numCols = dev->numAxes < 8 ? dev->numAxes / 2 : 4;
+  l.numberSize = 11 * l.h / 480;
+  if (l.numberSize < 8) l.numberSize = 8;
+  l.stripHeight = l.h / 120;
+  if (l.stripHeight < 3) l.stripHeight = 3;
+
+  dev->releaseCaches();
+  dev->panel = video.createSurface(l.w, l.h);
+  dev->panel->setBlending(false);
+  if (dev->numAxes > 0) {
+    int numPairs = (dev->numAxes + 1) >> 1;
+    dev->axisMaps = new VideoSurface*[numPairs];
+    dev->trails = new TrailBuffer*[numPairs];
+    dev->gateOverlays = new VideoSurface*[numPairs];
+    for (int i = 0; i < numPairs; ++i) {
+      VideoSurface *map = video.createSurface(l.aw, l.ah);
+      if (!trailPaletteReady) {
+        for (int level = 0; level < 256; ++level) {
+          trailPalette[level] = map->mapRGBA(color.r * level / 255,
+              color.g * level / 255, color.b * level / 255, 0xff);
+        }
+        gateColor = map->mapRGBA(0xff, 0xff, 0xff, 0xff);
+        gateClear = map->mapRGBA(0, 0, 0, 0);
+        trailPaletteReady = true;
+      }
+      // the trail fades to black, no need to blend it
+      map->setBlending(false);
+      map->fill(trailPalette[0]);
+      dev->axisMaps[i] = map;
+      dev->trails[i] = new TrailBuffer(l.aw, l.ah);
+      dev->gateOverlays[i] = video.createSurface(l.aw, l.ah);
+      dev->gateOverlays[i]->setBlending(true);
+    }
+    dev->strips = new VideoSurface*[dev->numAxes];
+    for (int i = 0; i < dev->numAxes; ++i) {
+      dev->strips[i] = video.createSurface(l.aw, l.stripHeight);
+      dev->strips[i]->setBlending(false);
+    }
+    dev->freshCaches = true;
+  }
+  dev->dirty = true;
+}
+
+void KeyDisplay::renderDevice(JoyDevice *dev) {
+  const DeviceLayout &l(dev->layout);
+  VideoSurface *target = dev->panel;
+  uint32_t mainColor = (255u << 24)|color.b|(color.g << 8)|(color.r << 16);
   int directions[] = { 1, 5, 7, 3 };
+  int rw = l.rw, rh = l.rh;
+
+  background->blitOn(target, 0, 0, l.x, l.y, l.w, l.h);
+
+  phase(PHASE_BUTTONS);
+  // one batched call each for the pressed and the released buttons
+  SurfaceRect pressed[MAX_BUTTONS], released[MAX_BUTTONS];
+  int numPressed = 0, numReleased = 0;
+  for (int i = 0; i < dev->maxButtons; ++i) {
+    SurfaceRect &r(dev->buttons[i] ? pressed[numPressed++] : released[numReleased++]);
+    r.x = 8 + rw * (i & 15);
+    r.y = 8 + rh * (i >> 4);
+    r.w = rw * 7 / 8;
+    r.h = rh * 7 / 8;
+  }
+  target->fillRects(pressed, numPressed, mainColor);
+  target->strokeRects(released, numReleased, mainColor);
 
-  FixedGradient bgGrad(SDL_Color { 0, 0, 0 }, color, screen->getHeight() * 3);
-  for (int y = 0; y < screen->getHeight(); ++y) {
-    SDL_Color col(bgGrad.dithered());
-    bgGrad.stepNext();
-    screen->fill(0, y, screen->getWidth(), 1, (255u << 24)|col.b|(col.g << 8)|(col.r << 16));
+  phase(PHASE_HATS);
+  if (dev->numHats > 0) {
+    for (int i = 0; i < 4; ++i) {
+      int index = directions[i];
+      int x = rw * (index % 3) + l.w - rw * 3 - 8;
+      int y = 8 + rh * (index / 3);
+      int w = rw + 1;
+      int h = rh + 1;
+      if ((dev->hat >> i) & 1) {
+        target->fillRect(x, y, w, h, mainColor);
+      } else {
+        target->strokeRect(x, y, w, h, mainColor);
+      }
+    }
+  }
+
+  phase(PHASE_AXES);
+  int aw = l.aw;
+  int ah = l.ah;
+  AxisInfo *axes = dev->axes;
+  uint64_t now = monotonicMicros();
+  dev->fading = false;
+  for (int i = 0; i < dev->numAxes; i += 2) {
+    int x = (l.w / 2 - l.numCols * l.arw) / 2 + l.arw * (i & 7);
+    int y = (l.h * 3 / 4) - l.numRows * l.arh + 2 * l.arh * (i >> 3);
+    int dx = (axes[i] * aw / 32768 + aw) / 2;
+    int dy = (axes[i + 1] * ah / 32768 + ah) / 2;
+
+    TrailBuffer *trail = dev->trails[i >> 1];
+    trail->decay(now, trailHalfLife);
+    trail->render(dev->axisMaps[i >> 1], trailPalette);
+    if (!trail->isEmpty()) dev->fading = true;
+    dev->axisMaps[i >> 1]->blitOn(target, x, y);
+    VideoSurface *overlay = dev->gateOverlays[i >> 1];
+    dev->gates[i >> 1].renderOverlay(overlay, gateColor, gateClear, dev->freshCaches);
+    overlay->blitOn(target, x, y);
+
+    target->strokeRect(x, y, aw, ah, mainColor);
+    target->fillRect(x + dx - aw / 8, y + dy - ah / 8, aw / 4, ah / 4, mainColor);
+    for (int j = 0; j < 2 && i + j < dev->numAxes; ++j) {
+      // X and Y coverage strips below the numbers under the box
+      VideoSurface *strip = dev->strips[i + j];
+      dev->histograms[i + j].renderStrip(strip, trailPalette[255], trailPalette[0], dev->freshCaches);
+      strip->blitOn(target, x, y + ah + l.numberSize + 2 + j * (l.stripHeight + 1));
+
+      int restCenter;
+      double rmsNoise;
+      if (dev->noise->restStats(i + j, &restCenter, &rmsNoise)) {
+        // resting center and noise in the top left of the box
+        char text[24];
+        snprintf(text, sizeof(text), "%c%+d n%.1f", j ? 'Y' : 'X', restCenter, rmsNoise);
+        drawSdfText(target, text, x + 2, y + 2 + j * (l.numberSize + 1), l.numberSize, 0, color);
+      }
+
+      if (axes[i + j].statsAvailable()) {
+        int tw, th;
+        unsigned minValue = axes[i+j].minNonzeroAbsolute;
+        measureNumber(minValue, l.numberSize, j, &tw, &th);
+        drawNumber(target, minValue, j ? x - tw : x, y + (j ? 0 : ah), l.numberSize, j);
+
+        unsigned maxValue = axes[i+j].maxAbsolute;
+        measureNumber(maxValue, l.numberSize, j, &tw, &th);
+        drawNumber(target, maxValue, j
+            ? x - tw
+            : x + aw - tw, y + (j ? ah - th : ah), l.numberSize, j);
+      }
+    }
   }
 
+  dev->freshCaches = false;
+  dev->dirty = false;
+  phase(PHASE_BACKGROUND);
+}
+
+void KeyDisplay::displayString(int textLabel, float progress) {
+  if (textLabel == LABEL_NONE && keys.size()) {
+    textLabel = keys.label(keys.first());
+  }
+
+  if (traceEnabled) {
+    frameStart = monotonicNanos();
+    traceFrameShown(frameStart);
+  }
+  phase(PHASE_BACKGROUND);
+  // one noise pass per device for all the axis events since the last frame
+  uint64_t now = monotonicMicros();
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->noise->isPending()) devices[i]->noise->update(now);
+  }
+  if (!background) renderBackground();
+
+  // only devices that changed since the last frame are redrawn,
+  // the rest is composed from their cached panels
+  for (int i = 0; i < gridCols * gridRows; ++i) {
+    if (i < numDevices) {
+      JoyDevice *dev = devices[i];
+      if (dev->dirty) renderDevice(dev);
+      dev->panel->blitOn(screen, dev->layout.x, dev->layout.y);
+    } else {
+      int w = screen->getWidth() / gridCols;
+      int h = screen->getHeight() / gridRows;
+      int x = w * (i % gridCols);
+      int y = h * (i / gridCols);
+      background->blitOn(screen, x, y, x, y, w, h);
+    }
+  }
+
+  phase(PHASE_OVERLAY);
   uint32_t mainColor = (255u << 24)|color.b|(color.g << 8)|(color.r << 16);
 
   int width = progress * screen->getWidth();
-  screen->fill((screen->getWidth() - width) >> 1,
+  screen->fillRect((screen->getWidth() - width) >> 1,
 #ifdef FLIP
     0,
 #else
@@ -336,134 +838,418 @@ void KeyDisplay::displayString(const char *text, float progress, int hat) {
     mainColor
   );
 
-  int rw = (screen->getWidth() - 32) / 14;
-  int rh = (screen->getHeight() - 32) / 14;
-  if (rw < rh) {
-    rh = rw;
-  } else {
-    rw = rh;
+  int mx = screen->getWidth() / 2 + mouseX;
+  int my = screen->getHeight() / 2 + mouseY;
+  screen->hLine(mx - 4, my, 9, mainColor);
+  screen->vLine(mx, my - 4, 9, mainColor);
+
+#ifdef ALLOC_STATS
+  // heap allocations made by the previous repaint
+  int hw, hh;
+  measureNumber(lastFrameAllocs(), 11, false, &hw, &hh);
+  drawNumber(screen, lastFrameAllocs(), 4, screen->getHeight() - 12 - hh, 11, false);
+#endif
+
+  if (bounces && bounces->getTotalBounces()) {
+    // bounces seen so far in the bottom right corner
+    int bw, bh;
+    measureNumber(bounces->getTotalBounces(), 11, false, &bw, &bh);
+    drawNumber(screen, bounces->getTotalBounces(), screen->getWidth() - 4 - bw,
+        screen->getHeight() - 12 - bh, 11, false);
   }
 
-  for (int i = 0; i < maxButtons; ++i) {
-    int x = 8 + rw * (i & 15);
-    int y = 8 + rh * (i >> 4);
-    int w = rw * 7 / 8;
-    int h = rh * 7 / 8;
-    if (buttons[i]) {
-      screen->fill(x, y, w, h, mainColor);
-    } else {
-      screen->fill(x, y, 1, h, mainColor);
-      screen->fill(x, y, w, 1, mainColor);
-      screen->fill(x+w-1, y, 1, h, mainColor);
-      screen->fill(x, y+h-1, w, 1, mainColor);
+  phase(PHASE_TEXT);
+  if (rollover) {
+    drawHeldGrid();
+  } else {
+    // up to two other held keys stacked above the main text, newest lowest
+    int stack[2];
+    int keysDown = 0;
+    for (int k = keys.first(); k >= 0 && keysDown < 2; k = keys.next(k)) {
+      if (keys.label(k) != textLabel) {
+        stack[keysDown++] = keys.label(k);
+      }
     }
+    int y = (keysDown + 1) * -(textSize / 2);
+    while (keysDown > 0) {
+      drawText(stack[--keysDown], y);
+      y += textSize;
+    }
+    drawText(textLabel, y);
   }
 
-  if (numHats > 0) {
-    for (int i = 0; i < 4; ++i) {
-      int index = directions[i];
-      int x = rw * (index % 3) + screen->getWidth() - rw * 3 - 8;
-      int y = 8 + rh * (index / 3);
-      int w = rw + 1;
-      int h = rh + 1;
-      if ((hat >> i) & 1) {
-        screen->fill(x, y, w, h, mainColor);
-      } else {
-        screen->fill(x, y, 1, h, mainColor);
-        screen->fill(x, y, w, 1, mainColor);
-        screen->fill(x+w-1, y, 1, h, mainColor);
-        screen->fill(x, y+h-1, w, 1, mainColor);
-      }
+  phase(PHASE_PRESENT);
+  video.present();
+  endFrame();
+}
+
+void KeyDisplay::tracePhase(FramePhase p) {
+  uint64_t now = monotonicNanos();
+  if (tracedPhase != PHASE_NONE) {
+    traceSpan(framePhaseNames[tracedPhase], phaseStart, now);
+  }
+  tracedPhase = p;
+  phaseStart = now;
+}
+
+void KeyDisplay::endFrame() {
+  if (counters) counters->endFrame();
+  if (traceEnabled) {
+    tracePhase(PHASE_NONE);
+    traceSpan("frame", frameStart, phaseStart);
+  }
+}
+
+void KeyDisplay::exportState(SharedState *state) {
+  memset(state->keys, 0, sizeof(state->keys));
+  for (int k = keys.first(); k >= 0; k = keys.next(k)) {
+    if (k < SHARED_KEY_BITS) state->keys[k >> 6] |= 1ULL << (k & 63);
+  }
+  state->numDevices = numDevices;
+  for (int i = 0; i < numDevices; ++i) {
+    JoyDevice *dev = devices[i];
+    SharedDevice &d(state->devices[i]);
+    memcpy(d.name, dev->name, sizeof(d.name));
+    d.id = dev->id;
+    d.numButtons = dev->maxButtons;
+    d.numAxes = dev->numAxes;
+    d.numHats = dev->numHats;
+    d.hat = dev->hat;
+    memset(d.buttons, 0, sizeof(d.buttons));
+    for (int b = 0; b < dev->maxButtons; ++b) {
+      if (dev->buttons[b]) d.buttons[b >> 6] |= 1ULL << (b & 63);
+    }
+    for (int a = 0; a < dev->numAxes; ++a) {
+      AxisInfo &info(dev->axes[a]);
+      SharedAxis &axis(d.axes[a]);
+      axis.value = info.value == INT32_MAX ? 0 : info.value;
+      axis.minNonzeroAbsolute = info.minNonzeroAbsolute;
+      axis.maxAbsolute = info.maxAbsolute;
+      axis.distinctValues = dev->histograms[a].distinctValues();
+      axis.missingCodes = dev->histograms[a].missingCodes();
+      double rmsNoise = 0;
+      axis.restCenter = 0;
+      dev->noise->restStats(a, &axis.restCenter, &rmsNoise);
+      axis.rmsNoise = rmsNoise;
+      axis.restSamples = dev->noise->getRestSamples(a);
     }
   }
+}
 
-  int numRows = (numAxes + 7) / 8;
-  int numCols = numAxes < 8 ? numAxes / 2 : 4;
-  int aw = rw * 15 / 8;
-  int ah = rh * 15 / 8;
-  if (!axisMaps && numAxes > 0) {
-    axisMaps = new VideoSurface*[(numAxes + 1) >> 1];
-    for (int i = 0; i < numAxes; ++i) {
-      int index = i >> 1;
-      LockedSurface am;
-      axisMaps[index] = video.createSurface(aw, ah);
-      if (!axisMaps[index]->lock(&am)) {
-        memset(am.pixels, 0, am.pitch * am.h);
-        axisMaps[index]->unlock();
+void KeyDisplay::printAxisSummary() {
+  for (int i = 0; i < numDevices; ++i) {
+    JoyDevice *dev = devices[i];
+    if (!dev->numAxes) continue;
+    printf("%s:\n", dev->name);
+    for (int a = 0; a < dev->numAxes; ++a) {
+      AxisHistogram &h(dev->histograms[a]);
+      if (!h.distinctValues()) continue;
+      printf("  axis %d: %u distinct values, %u missing codes", a,
+          h.distinctValues(), h.missingCodes());
+      int low, high;
+      if (h.deadzone(&low, &high)) printf(", nothing seen between %d and %d", low, high);
+      printf("\n");
+      int restCenter, change;
+      double rmsNoise, perHour;
+      if (dev->noise->restStats(a, &restCenter, &rmsNoise) && dev->noise->drift(a, &change, &perHour)) {
+        printf("    at rest: center %d, RMS noise %.2f, drift %+d (%+.1f per hour)\n",
+            restCenter, rmsNoise, change, perHour);
       }
     }
+    for (int a = 0; a < dev->numAxes; a += 2) {
+      int directions;
+      double error = dev->gates[a >> 1].circularityError(&directions);
+      if (error < 0) continue;
+      printf("  axes %d/%d: gate circularity error %.1f%% over %d of %d directions\n",
+          a, a + 1, error, directions, GateShape::NUM_BINS);
+    }
   }
+  fflush(stdout);
+}
 
-  int arw = rw + 12;
-  int arh = rh + 12;
-  for (int i = 0; i < numAxes; i += 2) {
-    int x = (screen->getWidth() / 2 - numCols * arw) / 2 + arw * (i & 7);
-    int y = (screen->getHeight() * 3 / 4) - numRows * arh + 2 * arh * (i >> 3);
-    int dx = (axes[i] * aw / 32768 + aw) / 2;
-    int dy = (axes[i + 1] * ah / 32768 + ah) / 2;
+bool KeyDisplay::isFading() {
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->fading) return true;
+  }
+  return false;
+}
 
-    axisMaps[i >> 1]->fill(dx-1, dy-1, 3, 3, ablend(mainColor, 64));
-    axisMaps[i >> 1]->fill(dx, dy, 1, 1, ablend(mainColor, 96));
-    axisMaps[i >> 1]->blitOn(screen, x, y);
+void KeyDisplay::advanceFading() {
+  for (int i = 0; i < numDevices; ++i) {
+    if (devices[i]->fading) devices[i]->dirty = true;
+  }
+}
 
-    screen->fill(x, y, 1, ah, mainColor);
-    screen->fill(x, y, aw, 1, mainColor);
-    screen->fill(x+aw-1, y, 1, ah, mainColor);
-    screen->fill(x, y+ah-1, aw, 1, mainColor);
+void KeyDisplay::warmUp() {
+  // draw every label and panel once, so their surfaces exist and what they
+  // touch is paged in before the first measured event
+  for (int i = 0; i < numDevices; ++i) {
+    devices[i]->dirty = true;
+  }
+  for (int id = LABEL_NONE + 1; id < numLabels(); ++id) {
+    drawText(id, 0);
+  }
+  displayString(LABEL_NONE, 0.0f);
+}
 
-    screen->fill(x + dx - aw / 8, y + dy - ah / 8, aw / 4, ah / 4, mainColor);
-    for (int j = 0; j < 2; ++j) {
-      if (axes[i + j].statsAvailable()) {
-        char val[16];
-        snprintf(val, sizeof(val), "%d", axes[i+j].minNonzeroAbsolute);
-        VideoSurface *textSurface = renderText(smallFont, val, color);
-        if (j) textSurface = rotateLeft(textSurface, true);
-        textSurface->blitOn(screen, j ? x - textSurface->getWidth() : x, y + (j ? 0 : ah));
-        delete textSurface;
-
-        snprintf(val, sizeof(val), "%d", axes[i+j].maxAbsolute);
-        textSurface = renderText(smallFont, val, color);
-        if (j) textSurface = rotateLeft(textSurface, true);
-        textSurface->blitOn(screen, j
-            ? x - textSurface->getWidth()
-            : x + aw - textSurface->getWidth(), y + (j ? ah - textSurface->getHeight() : ah));
-        delete textSurface;
-      }
-    }
+void KeyDisplay::reserveLabelSurfaces() {
+#if defined(FLIP) && defined(BAKED_FONT)
+  if (textSize != font.getSize())
+    return;
+  // one per size bucket the upright labels fall into, so drawing a label
+  // for the first time doesn't create a temporary surface
+  for (int id = LABEL_NONE + 1; id < numLabels(); ++id) {
+    int w, h;
+    font.measure(label(id).text, &w, &h);
+    if (w > 0 && h > 0) video.getPool()->reserve(w, h, 1);
   }
+#endif
+}
 
-  int mx = screen->getWidth() / 2 + mouseX;
-  int my = screen->getHeight() / 2 + mouseY;
-  screen->fill(mx - 4, my, 9, 1, mainColor);
-  screen->fill(mx, my - 4, 1, 9, mainColor);
-
-  int keysDown = 0;
-  for (int i = 0; i < numKeys; ++i) {
-    if (keys[i] && strncmp(text, keys[i], lenChecked) != 0) {
-      ++keysDown;
-      if (keysDown >= 2) break;
-    }
+// the loop only repaints on events, so fading trails get a tick to show
+const int EVENT_TRAIL_TICK = SDL_USEREVENT + 1;
+static std::atomic<bool> trailsFading(false), trailTickPending(false);
+
+static Uint32 trailTick(Uint32 interval, void *param) {
+  if (trailsFading && !trailTickPending.exchange(true)) {
+    SDL_Event event;
+    memset(&event, 0, sizeof(event));
+    event.type = EVENT_TRAIL_TICK;
+    SDL_PushEvent(&event);
   }
-  int y = (keysDown + 1) * -16;
-  for (int i = 0; i < numKeys; ++i) {
-    if (keys[i] && strncmp(text, keys[i], lenChecked) != 0) {
-      drawText(keys[i], y);
-      y += 32;
-      --keysDown;
-      if (keysDown <= 0) break;
-    }
+  return interval;
+}
+
+// pushed by the screenshot worker on SIGUSR2
+const int EVENT_SCREENSHOT = SDL_USEREVENT + 2;
+
+#ifndef USE_SDL2
+const int EVENT_JOYSTICKS_CHANGED = SDL_USEREVENT;
+
+void rescanJoysticks(KeyDisplay &kd) {
+  // SDL1 only enumerates joysticks when the subsystem starts
+  kd.detachDevices();
+  SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
+  if (SDL_InitSubSystem(SDL_INIT_JOYSTICK) < 0) {
+    perror("Cannot reinitialize joysticks");
+  }
+  SDL_JoystickEventState(SDL_ENABLE);
+  int numJoysticks = SDL_NumJoysticks();
+  std::cout << "Number of joysticks: " << numJoysticks << std::endl;
+  // known pads first, the ones that didn't come back free their slots
+  // before any new pad needs one
+  int unmatched[MAX_DEVICES];
+  int numUnmatched = 0;
+  for (int i = 0; i < numJoysticks; ++i) {
+    SDL_Joystick *joy = SDL_JoystickOpen(i);
+    if (!joy || kd.reattachDevice(joy, joystickId(joy, i), joystickName(joy, i)))
+      continue;
+    if (numUnmatched < MAX_DEVICES) unmatched[numUnmatched++] = i;
+    SDL_JoystickClose(joy);
+  }
+  kd.dropDetachedDevices();
+  for (int i = 0; i < numUnmatched; ++i) {
+    SDL_Joystick *joy = SDL_JoystickOpen(unmatched[i]);
+    if (joy && !kd.addDevice(joy, joystickId(joy, unmatched[i]), joystickName(joy, unmatched[i])))
+      SDL_JoystickClose(joy);
+  }
+}
+#else
+// Opens the attached joysticks that have no panel yet, as long as there
+// are free slots. Called on every add and remove, so a pad that was over
+// the limit shows up once another one is unplugged.
+void addUntrackedJoysticks(KeyDisplay &kd) {
+  for (int i = 0; i < SDL_NumJoysticks() && kd.getNumDevices() < MAX_DEVICES; ++i) {
+    if (kd.device(joystickIdAt(i)))
+      continue;
+    SDL_Joystick *joy = SDL_JoystickOpen(i);
+    if (joy && !kd.addDevice(joy, joystickId(joy, i), joystickName(joy, i)))
+      SDL_JoystickClose(joy);
   }
-  drawText(text, y);
+}
+#endif
 
-  video.present();
+static const char* traceEventName(const SDL_Event &event, int *code) {
+  *code = 0;
+  switch (event.type) {
+  case SDL_KEYDOWN:
+    *code = keyCodeFromEvent(event);
+    return "key down";
+  case SDL_KEYUP:
+    *code = keyCodeFromEvent(event);
+    return "key up";
+  case SDL_JOYBUTTONDOWN:
+    *code = event.jbutton.button;
+    return "button down";
+  case SDL_JOYBUTTONUP:
+    *code = event.jbutton.button;
+    return "button up";
+  case SDL_JOYAXISMOTION:
+    *code = event.jaxis.axis;
+    return "axis";
+  case SDL_JOYHATMOTION:
+    *code = event.jhat.value;
+    return "hat";
+  case SDL_MOUSEMOTION:
+    return "mouse";
+  default:
+    *code = event.type;
+    return "event";
+  }
+}
+
+// input events in the --socket record layout, false for anything else
+static bool describeEvent(KeyDisplay &kd, const SDL_Event &event, uint64_t micros, StreamRecord *r) {
+  r->micros = micros;
+  r->device = 0;
+  r->code = 0;
+  switch (event.type) {
+  case SDL_KEYDOWN:
+  case SDL_KEYUP:
+    r->type = STREAM_KEY;
+    r->code = keyCodeFromEvent(event);
+    r->value = event.type == SDL_KEYDOWN;
+    return true;
+  case SDL_JOYBUTTONDOWN:
+  case SDL_JOYBUTTONUP:
+    r->type = STREAM_BUTTON;
+    r->device = kd.deviceSlot(event.jbutton.which);
+    r->code = event.jbutton.button;
+    r->value = event.type == SDL_JOYBUTTONDOWN;
+    return true;
+  case SDL_JOYAXISMOTION:
+    r->type = STREAM_AXIS;
+    r->device = kd.deviceSlot(event.jaxis.which);
+    r->code = event.jaxis.axis;
+    r->value = event.jaxis.value;
+    return true;
+  case SDL_JOYHATMOTION:
+    r->type = STREAM_HAT;
+    r->device = kd.deviceSlot(event.jhat.which);
+    r->code = event.jhat.hat;
+    r->value = event.jhat.value;
+    return true;
+  case SDL_MOUSEMOTION:
+    r->type = STREAM_MOUSE;
+    r->value = static_cast<int32_t>(static_cast<uint32_t>(event.motion.xrel) << 16 |
+      static_cast<uint16_t>(event.motion.yrel));
+    return true;
+  default:
+    return false;
+  }
 }
 
 int main(int argc, char* argv[]) {
+  RealtimeConfig realtime;
+  WaitStrategy waitStrategy = WAIT_BLOCK;
+  int waitPeriod = 0;
+  int trailHalfLife = 1000;
+  double bounceMs = 5;
+  bool nkro = false;
+  const char *nkroKeys = RolloverAnalyzer::DEFAULT_TARGET;
+  const char *shmName = nullptr;
+  const char *socketPath = nullptr;
+  const char *screenshotDir = nullptr;
+  const char *recordPath = nullptr;
+  const char *flightDir = ".";
+  int flightLatency = 0;
+  bool flightKey = false;
+  bool benchFill = false;
+  bool perfCounters = false;
+  const char *tracePath = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--realtime")) {
+      realtime.enabled = true;
+    } else if (!strcmp(argv[i], "--fifo") && i + 1 < argc) {
+      realtime.priority = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--cpu") && i + 1 < argc) {
+      realtime.cpu = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (!strcmp(argv[i], "--trail-half-life") && i + 1 < argc) {
+      trailHalfLife = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--bounce-ms") && i + 1 < argc) {
+      bounceMs = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--shm") && i + 1 < argc) {
+      shmName = argv[++i];
+    } else if (!strcmp(argv[i], "--socket") && i + 1 < argc) {
+      socketPath = argv[++i];
+    } else if (!strcmp(argv[i], "--screenshot-dir") && i + 1 < argc) {
+      screenshotDir = argv[++i];
+    } else if (!strcmp(argv[i], "--record") && i + 1 < argc) {
+      recordPath = argv[++i];
+    } else if (!strcmp(argv[i], "--flight-dir") && i + 1 < argc) {
+      flightDir = argv[++i];
+    } else if (!strcmp(argv[i], "--flight-latency") && i + 1 < argc) {
+      flightLatency = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "--flight-key")) {
+      flightKey = true;
+    } else if (!strcmp(argv[i], "--nkro")) {
+      nkro = true;
+    } else if (!strcmp(argv[i], "--nkro-keys") && i + 1 < argc) {
+      nkro = true;
+      nkroKeys = argv[++i];
+    } else if (!strcmp(argv[i], "--bench-fill")) {
+      benchFill = true;
+    } else if (!strcmp(argv[i], "--perf")) {
+      perfCounters = true;
+    } else if (!strcmp(argv[i], "--wait") && i + 1 < argc &&
+        EventWaiter::parse(argv[i + 1], &waitStrategy, &waitPeriod)) {
+      ++i;
+    } else {
+      std::cerr << "Usage: " << argv[0] << " [--realtime [--fifo PRIORITY] [--cpu CORE]]"
+          " [--wait block|timeout[=MS]|poll|epoll[=MS]] [--perf] [--trace FILE]"
+          " [--trail-half-life MS] [--bounce-ms MS] [--nkro] [--nkro-keys KEY,...]"
+          " [--shm NAME] [--socket PATH] [--screenshot-dir DIR] [--record FILE]"
+          " [--flight-dir DIR] [--flight-latency MS] [--flight-key] [--bench-fill]" << std::endl;
+      return 2;
+    }
+  }
+
+  if (tracePath && !openTrace(tracePath)) return 2;
+  StartupProfile startup;
+
+  // Parsing the font doesn't depend on SDL, do it on a worker while the
+  // video mode and the joysticks are set up. SDL_ttf renders into SDL
+  // surfaces, which SDL1 can't create while SDL_SetVideoMode runs, so its
+  // glyph warm-up waits for the main thread.
+  bool fontLoaded = false;
+  uint64_t fontStart = 0, fontEnd = 0;
+  std::thread fontLoader([&]() {
+    fontStart = monotonicNanos();
+#ifndef BAKED_FONT
+    if (TTF_Init() < 0) {
+      perror("Can't initialize SDL_TTF");
+      fontEnd = monotonicNanos();
+      return;
+    }
+#endif
+    fontLoaded = font.load();
+#ifdef BAKED_FONT
+    if (fontLoaded) font.warmUp();
+#endif
+    warmUpSdfText();
+    fontEnd = monotonicNanos();
+  });
+
   // Initialize SDL video and joystick
   if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK | SDL_INIT_TIMER) < 0) {
     perror("Cannot initialize SDL");
+    fontLoader.join();
     return 1;
   }
+  startup.mark("SDL_Init");
+
+  // SDL1 only knows the key names once the video subsystem is up
+  RolloverAnalyzer rollover;
+  if (nkro && !rollover.setTarget(nkroKeys)) {
+    fontLoader.join();
+#ifndef BAKED_FONT
+    TTF_Quit();
+#endif
+    SDL_Quit();
+    return 2;
+  }
 
   SDL_ShowCursor(false);
 #ifdef USE_SDL2
@@ -474,13 +1260,6 @@ int main(int argc, char* argv[]) {
   
   SDL_JoystickEventState(SDL_ENABLE);
   std::cout << "Number of joysticks: " << SDL_NumJoysticks() << std::endl;
-  SDL_Joystick *joy = SDL_JoystickOpen(0);
-
-  if (TTF_Init() < 0) {
-    perror("Can't initialize SDL_TTF");
-    SDL_Quit();
-    return 2;
-  }
 
   // Set video mode
 #ifdef PORTRAIT
@@ -491,122 +1270,202 @@ int main(int argc, char* argv[]) {
   screen = video.getScreen();
   if (!screen) {
     perror("Can't set video mode");
+    fontLoader.join();
+#ifndef BAKED_FONT
     TTF_Quit();
+#endif
     SDL_Quit();
     return 3;
   }
-
-  SDL_RWops *ttf = SDL_RWFromConstMem(RussoOne_Regular_ttf, RussoOne_Regular_ttf_len);
-  // Load font (the second parameter value will tell to free the rwops instance)
-  font = TTF_OpenFontRW(ttf, 1, 32);
-  if (!font) {
-    perror("Can't load font");
-    SDL_Quit();
+  startup.mark("video mode");
+  if (benchFill) {
+    benchmarkFills(screen);
+    fontLoader.join();
+#ifndef BAKED_FONT
     TTF_Quit();
-    return 4;
-  }
-  ttf = SDL_RWFromConstMem(RussoOne_Regular_ttf, RussoOne_Regular_ttf_len);
-  smallFont = TTF_OpenFontRW(ttf, 1, 11);
-  if (!smallFont) {
-    perror("Can't load small font");
+#endif
     SDL_Quit();
-    TTF_Quit();
-    return 5;
+    return 0;
   }
+  initLabels();
+  startup.mark("labels");
 
   SDL_Event event;
   bool running = true;
-  bool joyButtons[256];
-  const char* keys[NUM_SCANCODES];
-  int lastHat = 0;
-  memset(joyButtons, 0, sizeof(joyButtons));
-  memset(keys, 0, sizeof(keys));
+  PressedKeys keys;
 
   int lastDown = 0, downStride = 0;
 
-  KeyDisplay kd(video, keys, sizeof(keys)/sizeof(*keys), joyButtons, sizeof(joyButtons) / sizeof(*joyButtons), SDL_JoystickNumAxes(joy), SDL_JoystickNumHats(joy));
-  kd.setMaxButtons(SDL_JoystickNumButtons(joy));
-  kd.displayString("", 0.0f, 0);
-  std::string textToDisplay;
+  KeyDisplay kd(video, keys);
+  kd.setTrailHalfLife(trailHalfLife);
+  if (nkro) kd.setRollover(&rollover);
+  SharedStateWriter sharedState;
+  if (shmName) sharedState.open(shmName);
+  EventStream stream;
+  if (socketPath) stream.open(socketPath);
+  ScreenshotWriter screenshots;
+  if (screenshotDir) screenshots.start(video.getScreen(), screenshotDir, EVENT_SCREENSHOT);
+  SessionRecorder recorder;
+  if (recordPath) recorder.open(recordPath, video.getScreen());
+  FlightRecorder flight;
+  flight.start(flightDir, flightLatency);
+  PhaseCounters counters;
+  if (perfCounters && counters.open()) kd.setCounters(&counters);
+#ifndef USE_SDL2
+  // SDL2 reports the joysticks present at startup as added devices
+  for (int i = 0; i < SDL_NumJoysticks() && kd.getNumDevices() < MAX_DEVICES; ++i) {
+    SDL_Joystick *joy = SDL_JoystickOpen(i);
+    if (joy) kd.addDevice(joy, joystickId(joy, i), joystickName(joy, i));
+  }
+  startJoystickWatcher(EVENT_JOYSTICKS_CHANGED);
+#endif
+  startup.mark("joysticks");
+
+  fontLoader.join();
+  startup.mark("waiting for the font");
+  startup.span("font", fontStart, fontEnd);
+  if (!fontLoaded) {
+    perror("Can't load font");
+    SDL_Quit();
+    return 4;
+  }
+#ifndef BAKED_FONT
+  font.warmUp();
+  startup.mark("glyph cache");
+#endif
+
+  kd.reserveLabelSurfaces();
+  kd.displayString(LABEL_NONE, 0.0f);
+  startup.mark("first frame");
+  startup.print();
+
+  RusageWindow measured;
+  if (realtime.enabled) {
+    enterRealtime(realtime);
+    kd.warmUp();
+    measured.begin();
+  }
+
+  InputProbe probe;
+  EventWaiter waiter(waitStrategy, waitPeriod, probe);
+  // SDL can merge a down/up/down within one poll, the evdev nodes can't
+  BounceDetector *bounces = new BounceDetector(static_cast<int>(bounceMs * 1000));
+  probe.setKeySink(BounceDetector::sink, bounces);
+  kd.setBounceDetector(bounces);
+  SDL_TimerID trailTimer = SDL_AddTimer(33, trailTick, nullptr);
+
+  int textLabel = LABEL_NONE;
   bool eventPending = false;
   bool needUpdate = false;
-  while (running && (eventPending || SDL_WaitEvent(&event))) {
+  bool screenshotPending = false;
+  // the first input since the last repaint, for the latency of the next one
+  uint64_t oldestInput = 0;
+  while (running && (eventPending || waiter.wait(&event))) {
+    // only what wait() returned comes with the kernel time of its wake-up
+    uint64_t inputMicros = eventPending ? 0 : waiter.getEventKernelTime();
     eventPending = false;
-    video.present();
-    int downCode = 0;
-    if (event.type == SDL_QUIT) {
-      running = false;
-    } else if (event.type == SDL_MOUSEMOTION) {
-      kd.setMouseMovement(event.motion.xrel, event.motion.yrel);
-      needUpdate = true;
-    } else if (event.type == SDL_JOYAXISMOTION) {
-      SDL_JoyAxisEvent &axisEvent(event.jaxis);
-      kd.setAxis(axisEvent.axis, axisEvent.value);
-      needUpdate = true;
-    } else if (event.type == SDL_JOYHATMOTION) {
-      SDL_JoyHatEvent &hat(event.jhat);
-      if (hat.value) {
-        const char *upDown = hat.value & SDL_HAT_UP ? "up" : hat.value & SDL_HAT_DOWN ? "down" : nullptr;
-        const char *leftRight = hat.value & SDL_HAT_LEFT ? "left" : hat.value & SDL_HAT_RIGHT ? "right" : nullptr;
-        std::stringstream hatName;
-        hatName << "Hat ";
-        if (!upDown && !leftRight) {
-          hatName << "centered";
-        } else {
-          if (upDown) {
-            hatName << upDown;
-            if (leftRight) hatName << " ";
-          }
-          if (leftRight) hatName << leftRight;
+    if (traceEnabled) {
+      int code;
+      uint64_t now = monotonicNanos();
+      traceInput(traceEventName(event, &code), now, code);
+      video.present();
+      traceSpan("present", now, monotonicNanos());
+    } else {
+      video.present();
+    }
+    StreamRecord input;
+    if (!inputMicros) inputMicros = eventMicros(event);
+    if (describeEvent(kd, event, inputMicros, &input)) {
+      flight.record(input);
+      if (stream.isOpen()) stream.record(input);
+      if (!oldestInput) oldestInput = input.micros;
+    }
+    {
+      SCOPE_STAT("event dispatch", "event", 1);
+      int downCode = 0;
+      if (event.type == SDL_QUIT) {
+        running = false;
+      } else if (event.type == SDL_MOUSEMOTION) {
+        kd.setMouseMovement(event.motion.xrel, event.motion.yrel);
+        needUpdate = true;
+      } else if (event.type == SDL_JOYAXISMOTION) {
+        SDL_JoyAxisEvent &axisEvent(event.jaxis);
+        JoyDevice *dev = kd.device(axisEvent.which);
+        if (dev) {
+          kd.setAxis(dev, axisEvent.axis, axisEvent.value);
+          needUpdate = true;
         }
-        textToDisplay = hatName.str();
-      }
-      if (hat.value != lastHat) {
-        lastHat = hat.value;
-        if (hat.value) downCode = TYPE_HAT | hat.value;
+      } else if (event.type == SDL_JOYHATMOTION) {
+        SDL_JoyHatEvent &hat(event.jhat);
+        JoyDevice *dev = kd.device(hat.which);
+        if (hat.value) {
+          textLabel = hatLabel(hat.value);
+        }
+        if (dev && kd.setHat(dev, hat.value)) {
+          if (hat.value) downCode = TYPE_HAT | (kd.deviceSlot(hat.which) << 8) | hat.value;
+          needUpdate = true;
+        }
+      } else if (event.type == SDL_JOYBUTTONDOWN) {
+        int button = event.jbutton.button;
+        JoyDevice *dev = kd.device(event.jbutton.which);
+        textLabel = buttonLabel(button);
         needUpdate = true;
-      }
-    } else if (event.type == SDL_JOYBUTTONDOWN) {
-      char buttonName[256] = { 0 };
-      int button = event.jbutton.button;
-      snprintf(buttonName, sizeof(buttonName), "Button #%d", button);
-      textToDisplay = buttonName;
-      needUpdate = true;
-      if (!joyButtons[button]) {
-        joyButtons[button] = true;
-        downCode = TYPE_BUTTON | button;
-      }
-    } else if (event.type == SDL_JOYBUTTONUP) {
-      int button = event.jbutton.button;
-      if (joyButtons[button]) {
-        joyButtons[button] = false;
+        if (dev && kd.setButton(dev, button, true)) {
+          downCode = TYPE_BUTTON | (kd.deviceSlot(event.jbutton.which) << 8) | button;
+        }
+      } else if (event.type == SDL_JOYBUTTONUP) {
+        JoyDevice *dev = kd.device(event.jbutton.which);
+        if (dev && kd.setButton(dev, event.jbutton.button, false)) {
+          needUpdate = true;
+        }
+#ifdef USE_SDL2
+      } else if (event.type == SDL_JOYDEVICEADDED) {
+        addUntrackedJoysticks(kd);
+        probe.rescan();
         needUpdate = true;
-      }
-    } else if (event.type == SDL_KEYDOWN) {
-      int key = keyCodeFromEvent(event);
-      const char *keyName = SDL_GetKeyName(event.key.keysym.sym);
-      if (!keys[key]) {
-        keys[key] = keyName;
-        downCode = TYPE_KEY | key;
-      }
-      textToDisplay = keyName;
-      needUpdate = true;
-    } else if (event.type == SDL_KEYUP) {
-      int key = keyCodeFromEvent(event);
-      if (keys[key]) {
-        keys[key] = nullptr;
+      } else if (event.type == SDL_JOYDEVICEREMOVED) {
+        kd.removeDevice(event.jdevice.which);
+        addUntrackedJoysticks(kd);
+        probe.rescan();
+        needUpdate = true;
+#else
+      } else if (event.type == EVENT_JOYSTICKS_CHANGED) {
+        rescanJoysticks(kd);
+        probe.rescan();
+        needUpdate = true;
+#endif
+      } else if (event.type == SDL_KEYDOWN) {
+        int key = keyCodeFromEvent(event);
+        if (keys.press(key, keyLabel(key))) {
+          downCode = TYPE_KEY | key;
+          if (nkro) rollover.press(keys, key);
+        }
+        textLabel = keyLabel(key);
+        // still shown as a key press, the capture has it on screen
+        if (key == SCREENSHOT_KEY && screenshots.isStarted()) screenshotPending = true;
+        if (key == FLIGHT_DUMP_KEY && flightKey) flight.trigger(FlightRecorder::TRIGGER_KEY);
+        needUpdate = true;
+      } else if (event.type == SDL_KEYUP) {
+        int key = keyCodeFromEvent(event);
+        if (keys.release(key)) needUpdate = true;
+      } else if (event.type == EVENT_TRAIL_TICK) {
+        trailTickPending = false;
+        kd.advanceFading();
+        needUpdate = true;
+      } else if (event.type == EVENT_SCREENSHOT) {
+        screenshotPending = true;
         needUpdate = true;
       }
-    }
-    if (downCode) {
-      if (lastDown == downCode) {
-        ++downStride;
-      } else {
-        downStride = 1;
+      if (downCode) {
+        if (lastDown == downCode) {
+          ++downStride;
+        } else {
+          downStride = 1;
+        }
+        lastDown = downCode;
       }
-      lastDown = downCode;
+      if (downStride == 3) running = false;
     }
-    if (downStride == 3) running = false;
     if (SDL_PollEvent(&event)) {
       eventPending = true;
     } else {
@@ -614,15 +1473,66 @@ int main(int argc, char* argv[]) {
       if (needUpdate) {
         int ds = downStride - 1;
         if (ds < 0) ds = 0;
-        kd.displayString(textToDisplay.c_str(), ds / 2.0f, lastHat);
+#ifdef ALLOC_STATS
+        beginFrameAllocs();
+#endif
+        uint64_t renderStart = monotonicMicros();
+        kd.displayString(textLabel, ds / 2.0f);
+        uint64_t shown = monotonicMicros();
+        flight.frameShown(shown, shown - renderStart, oldestInput ? shown - oldestInput : 0);
+        stream.frameShown(shown);
+        recorder.frameShown(video.getScreen(), shown);
+        if (screenshotPending) {
+          screenshots.capture(video.getScreen());
+          screenshotPending = false;
+        }
+        trailsFading = kd.isFading();
+        if (sharedState.isOpen()) {
+          kd.exportState(sharedState.begin());
+          sharedState.end();
+        }
+#ifdef ALLOC_STATS
+        endFrameAllocs();
+#endif
         needUpdate = false;
       }
+      oldestInput = 0;
     }
   }
 
+  SDL_RemoveTimer(trailTimer);
+  screenshots.stop();
+  screenshots.printStats();
+  recorder.close();
+  recorder.printStats();
+  flight.stop();
+  flight.printStats();
+  kd.printAxisSummary();
+  bounces->printStats();
+  if (nkro) rollover.printStats();
+  probe.setKeySink(nullptr, nullptr);
+  kd.setBounceDetector(nullptr);
+  delete bounces;
+  waiter.printStats();
+  counters.printStats();
+  closeTrace();
+  printScopeStats();
+  if (realtime.enabled) measured.print();
+
   // Clean up
-  TTF_CloseFont(font);
+#ifndef USE_SDL2
+  stopJoystickWatcher();
+#endif
+  freeLabelSurfaces();
+  font.close();
+  video.getPool()->printStats();
+  video.getArena()->printStats();
+#ifdef ALLOC_STATS
+  printAllocStats();
+#endif
+#ifndef BAKED_FONT
   TTF_Quit();
+#endif
 //  SDL_Quit();
 
   return 0;
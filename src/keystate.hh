@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Set of held keys: a bitset for O(1) membership tests, threaded with a
+// press-order list so the held keys can be walked newest first without
+// looking at the ones that are up. The label of a key is stored when it
+// goes down so drawing never has to look it up again.
+template<int N>
+class PressedSet {
+  uint64_t bits[(N + 63) / 64];
+  int16_t newer[N];
+  int16_t older[N];
+  uint16_t labels[N];
+  int newest;
+  int count;
+public:
+  PressedSet() {
+    clear();
+  }
+
+  void clear() {
+    memset(bits, 0, sizeof(bits));
+    newest = -1;
+    count = 0;
+  }
+
+  inline bool isDown(int code) const {
+    return (bits[code >> 6] >> (code & 63)) & 1;
+  }
+
+  // returns false if the key was already held
+  bool press(int code, int label) {
+    if (code < 0 || code >= N || isDown(code))
+      return false;
+    bits[code >> 6] |= 1ULL << (code & 63);
+    labels[code] = label;
+    newer[code] = -1;
+    older[code] = newest;
+    if (newest >= 0) newer[newest] = code;
+    newest = code;
+    ++count;
+    return true;
+  }
+
+  // returns false if the key was not held
+  bool release(int code) {
+    if (code < 0 || code >= N || !isDown(code))
+      return false;
+    bits[code >> 6] &= ~(1ULL << (code & 63));
+    if (newer[code] >= 0) {
+      older[newer[code]] = older[code];
+    } else {
+      newest = older[code];
+    }
+    if (older[code] >= 0) newer[older[code]] = newer[code];
+    --count;
+    return true;
+  }
+
+  inline int size() const {
+    return count;
+  }
+
+  // iteration, most recently pressed first: for (k = first(); k >= 0; k = next(k))
+  inline int first() const {
+    return newest;
+  }
+
+  inline int next(int code) const {
+    return older[code];
+  }
+
+  inline int label(int code) const {
+    return labels[code];
+  }
+};
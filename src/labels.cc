@@ -0,0 +1,65 @@
+#include "labels.hh"
+
+#include <stdio.h>
+
+const int NUM_HAT_LABELS = 16;
+const int NUM_BUTTON_LABELS = 256;
+
+const int FIRST_HAT_LABEL = LABEL_NONE + 1;
+const int FIRST_BUTTON_LABEL = FIRST_HAT_LABEL + NUM_HAT_LABELS;
+const int FIRST_KEY_LABEL = FIRST_BUTTON_LABEL + NUM_BUTTON_LABELS;
+const int NUM_LABELS = FIRST_KEY_LABEL + NUM_SCANCODES;
+
+static Label labels[NUM_LABELS];
+
+static void formatHat(char *buffer, size_t size, int value) {
+  const char *upDown = value & SDL_HAT_UP ? "up" : value & SDL_HAT_DOWN ? "down" : nullptr;
+  const char *leftRight = value & SDL_HAT_LEFT ? "left" : value & SDL_HAT_RIGHT ? "right" : nullptr;
+  if (!upDown && !leftRight) {
+    snprintf(buffer, size, "Hat centered");
+  } else if (upDown && leftRight) {
+    snprintf(buffer, size, "Hat %s %s", upDown, leftRight);
+  } else {
+    snprintf(buffer, size, "Hat %s", upDown ? upDown : leftRight);
+  }
+}
+
+void initLabels() {
+  for (int i = 0; i < NUM_HAT_LABELS; ++i) {
+    formatHat(labels[FIRST_HAT_LABEL + i].text, sizeof(labels[i].text), i);
+  }
+  for (int i = 0; i < NUM_BUTTON_LABELS; ++i) {
+    snprintf(labels[FIRST_BUTTON_LABEL + i].text, sizeof(labels[i].text), "Button #%d", i);
+  }
+  for (int i = 0; i < NUM_SCANCODES; ++i) {
+    const char *name = keyNameFromCode(i);
+    snprintf(labels[FIRST_KEY_LABEL + i].text, sizeof(labels[i].text), "%s", name ? name : "");
+  }
+}
+
+void freeLabelSurfaces() {
+  for (int i = 0; i < NUM_LABELS; ++i) {
+    delete labels[i].surface;
+    labels[i].surface = nullptr;
+  }
+}
+
+int keyLabel(int key) {
+  return key >= 0 && key < NUM_SCANCODES ? FIRST_KEY_LABEL + key : LABEL_NONE;
+}
+
+int buttonLabel(int button) {
+  return button >= 0 && button < NUM_BUTTON_LABELS ? FIRST_BUTTON_LABEL + button : LABEL_NONE;
+}
+
+int hatLabel(int value) {
+  return FIRST_HAT_LABEL + (value & (NUM_HAT_LABELS - 1));
+}
+
+Label& label(int id) {
+  return labels[id];
+}
+
+int numLabels() {
+  return NUM_LABELS;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "sdlcompat.hh"
+
+// Every text the event path can put on screen, formatted once at startup.
+// Events only carry the id of their label; the rendered surface is made
+// the first time the label is drawn and kept for the rest of the run.
+struct Label {
+  char text[32];
+  VideoSurface *surface;
+};
+
+const int LABEL_NONE = 0;
+
+// key names come from SDL, so this needs the video subsystem
+void initLabels();
+void freeLabelSurfaces();
+
+int keyLabel(int key);
+int buttonLabel(int button);
+int hatLabel(int value);
+Label& label(int id);
+// ids run from LABEL_NONE to numLabels() - 1
+int numLabels();
@@ -0,0 +1,168 @@
+#include "perfcounters.hh"
+
+#include <algorithm>
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+#include "timing.hh"
+
+static const char *columnNames[PhaseCounters::NUM_COLUMNS] = {
+  "cycles", "instructions", "cache misses", "branch misses", "ns"
+};
+
+static const uint64_t counterConfigs[PhaseCounters::NUM_COUNTERS] = {
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+static int openCounter(uint64_t config, int groupFd, bool excludeKernel) {
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.read_format = PERF_FORMAT_GROUP;
+  attr.disabled = groupFd < 0;
+  attr.exclude_kernel = excludeKernel;
+  attr.exclude_hv = 1;
+  // this thread on any CPU
+  return syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+PhaseCounters::PhaseCounters(): numOpen(0), current(PHASE_NONE), samples(nullptr) {
+  for (int i = 0; i < NUM_COUNTERS; ++i) {
+    fds[i] = -1;
+    slots[i] = -1;
+  }
+  memset(frame, 0, sizeof(frame));
+  memset(ran, 0, sizeof(ran));
+  memset(frames, 0, sizeof(frames));
+  memset(totals, 0, sizeof(totals));
+}
+
+PhaseCounters::~PhaseCounters() {
+  for (int i = 0; i < NUM_COUNTERS; ++i) {
+    if (fds[i] >= 0) close(fds[i]);
+  }
+  delete[] samples;
+}
+
+bool PhaseCounters::open() {
+  // kernel time (the driver's share of present) needs perf_event_paranoid < 2
+  bool excludeKernel = false;
+  int leader = openCounter(counterConfigs[0], -1, excludeKernel);
+  if (leader < 0) {
+    excludeKernel = true;
+    leader = openCounter(counterConfigs[0], -1, excludeKernel);
+  }
+  if (leader < 0) {
+    perror("Can't open the cycle counter");
+    return false;
+  }
+  fds[0] = leader;
+  slots[0] = numOpen++;
+  for (int i = 1; i < NUM_COUNTERS; ++i) {
+    fds[i] = openCounter(counterConfigs[i], leader, excludeKernel);
+    if (fds[i] >= 0) {
+      slots[i] = numOpen++;
+    } else {
+      fprintf(stderr, "No %s counter\n", columnNames[i]);
+    }
+  }
+  if (excludeKernel) printf("Counting user space only\n");
+
+  samples = new uint64_t[NUM_FRAME_PHASES * MAX_FRAMES * NUM_COLUMNS];
+  ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+}
+
+bool PhaseCounters::read(uint64_t *values) {
+  uint64_t buffer[1 + NUM_COUNTERS];
+  if (::read(fds[0], buffer, sizeof(buffer)) < static_cast<ssize_t>(sizeof(uint64_t) * (1 + numOpen)))
+    return false;
+  for (int i = 0; i < NUM_COUNTERS; ++i) {
+    values[i] = slots[i] >= 0 ? buffer[1 + slots[i]] : 0;
+  }
+  values[NUM_COUNTERS] = monotonicNanos();
+  return true;
+}
+
+void PhaseCounters::enter(int phase) {
+  if (!samples)
+    return;
+  uint64_t now[NUM_COLUMNS];
+  if (!read(now))
+    return;
+  if (current != PHASE_NONE) {
+    for (int i = 0; i < NUM_COLUMNS; ++i) {
+      frame[current][i] += now[i] - last[i];
+    }
+    ran[current] = true;
+  }
+  memcpy(last, now, sizeof(last));
+  current = phase;
+}
+
+void PhaseCounters::endFrame() {
+  enter(PHASE_NONE);
+  if (!samples)
+    return;
+  for (int p = 0; p < NUM_FRAME_PHASES; ++p) {
+    if (!ran[p]) continue;
+    uint64_t *sample = samples + (p * MAX_FRAMES + frames[p] % MAX_FRAMES) * NUM_COLUMNS;
+    for (int i = 0; i < NUM_COLUMNS; ++i) {
+      sample[i] = frame[p][i];
+      totals[p][i] += frame[p][i];
+    }
+    ++frames[p];
+    ran[p] = false;
+  }
+  memset(frame, 0, sizeof(frame));
+}
+
+void PhaseCounters::printStats() {
+  if (!samples)
+    return;
+  printf("Per frame phase counters (average / p99):\n");
+  printf("%-11s %7s", "phase", "frames");
+  for (int i = 0; i < NUM_COLUMNS; ++i) {
+    printf(" %23s", columnNames[i]);
+  }
+  printf(" %5s\n", "IPC");
+
+  std::vector<uint64_t> column;
+  for (int p = 0; p < NUM_FRAME_PHASES; ++p) {
+    if (!frames[p]) continue;
+    int kept = frames[p] < MAX_FRAMES ? frames[p] : MAX_FRAMES;
+    printf("%-11s %7llu", framePhaseNames[p], static_cast<unsigned long long>(frames[p]));
+    for (int i = 0; i < NUM_COLUMNS; ++i) {
+      if (i < NUM_COUNTERS && slots[i] < 0) {
+        printf(" %23s", "-");
+        continue;
+      }
+      column.clear();
+      for (int f = 0; f < kept; ++f) {
+        column.push_back(samples[(p * MAX_FRAMES + f) * NUM_COLUMNS + i]);
+      }
+      size_t rank = column.size() * 99 / 100;
+      std::nth_element(column.begin(), column.begin() + rank, column.end());
+      printf(" %11llu / %9llu",
+          static_cast<unsigned long long>(totals[p][i] / frames[p]),
+          static_cast<unsigned long long>(column[rank]));
+    }
+    if (totals[p][0] && slots[1] >= 0) {
+      printf(" %5.2f\n", static_cast<double>(totals[p][1]) / totals[p][0]);
+    } else {
+      printf(" %5s\n", "-");
+    }
+  }
+  fflush(stdout);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "framephase.hh"
+
+// Hardware counters of the render thread read at every phase switch of a
+// repaint (perf_event_open, one group so they count the same instructions).
+// Each phase keeps the per-frame totals of the last MAX_FRAMES frames it
+// ran in for the p99s, averages cover the whole run.
+class PhaseCounters {
+public:
+  static const int NUM_COUNTERS = 4;
+  // wall time is kept in the column after the hardware counters
+  static const int NUM_COLUMNS = NUM_COUNTERS + 1;
+  static const int MAX_FRAMES = 4096;
+private:
+  int fds[NUM_COUNTERS];
+  // position of each counter in the group read, -1 if it couldn't be opened
+  int slots[NUM_COUNTERS];
+  int numOpen;
+
+  int current;
+  uint64_t last[NUM_COLUMNS];
+  uint64_t frame[NUM_FRAME_PHASES][NUM_COLUMNS];
+  bool ran[NUM_FRAME_PHASES];
+
+  uint64_t *samples;
+  uint64_t frames[NUM_FRAME_PHASES];
+  uint64_t totals[NUM_FRAME_PHASES][NUM_COLUMNS];
+
+  bool read(uint64_t *values);
+public:
+  PhaseCounters();
+  ~PhaseCounters();
+
+  bool open();
+  // attributes the counts since the last switch to the current phase,
+  // PHASE_NONE stops counting until the next switch
+  void enter(int phase);
+  // closes the frame, call after the present phase
+  void endFrame();
+  void printStats();
+};
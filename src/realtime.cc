@@ -0,0 +1,68 @@
+#include "realtime.hh"
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+
+// the deepest the event loop and the drawing code are expected to go
+static const size_t STACK_PREFAULT = 256 * 1024;
+
+static void __attribute__((noinline)) prefaultStack() {
+  volatile char stack[STACK_PREFAULT];
+  for (size_t i = 0; i < STACK_PREFAULT; i += 4096) {
+    stack[i] = 0;
+  }
+  (void)stack;
+}
+
+bool enterRealtime(const RealtimeConfig &config) {
+  bool ok = true;
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0) {
+    perror("Can't lock memory (check RLIMIT_MEMLOCK)");
+    ok = false;
+  }
+  prefaultStack();
+
+  if (config.priority > 0) {
+    sched_param param;
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = config.priority;
+    int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error) {
+      fprintf(stderr, "Can't set SCHED_FIFO priority %d: %s\n", config.priority, strerror(error));
+      ok = false;
+    }
+  }
+
+  if (config.cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(config.cpu, &set);
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (error) {
+      fprintf(stderr, "Can't pin to CPU %d: %s\n", config.cpu, strerror(error));
+      ok = false;
+    }
+  }
+
+  return ok;
+}
+
+void RusageWindow::begin() {
+  started = getrusage(RUSAGE_THREAD, &start) == 0;
+  if (!started) perror("getrusage");
+}
+
+void RusageWindow::print() {
+  rusage end;
+  if (!started || getrusage(RUSAGE_THREAD, &end) < 0)
+    return;
+  printf("Measured window: %ld minor faults, %ld major faults, "
+      "%ld voluntary and %ld involuntary context switches\n",
+      end.ru_minflt - start.ru_minflt, end.ru_majflt - start.ru_majflt,
+      end.ru_nvcsw - start.ru_nvcsw, end.ru_nivcsw - start.ru_nivcsw);
+  fflush(stdout);
+}
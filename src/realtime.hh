@@ -0,0 +1,32 @@
+#pragma once
+
+#include <sys/resource.h>
+
+// Settings of the --realtime mode, which keeps the input and render
+// thread (the main thread) clear of page faults and scheduler noise
+struct RealtimeConfig {
+  bool enabled;
+  // SCHED_FIFO priority, 0 keeps the default scheduler
+  int priority;
+  // core to pin the thread to, -1 leaves the affinity alone
+  int cpu;
+
+  RealtimeConfig(): enabled(false), priority(0), cpu(-1) {}
+};
+
+// locks current and future pages and prefaults some stack, then applies
+// the priority and affinity to the calling thread; failures are reported
+// and the rest is still applied
+bool enterRealtime(const RealtimeConfig &config);
+
+// page faults and context switches of the calling thread between begin()
+// and print()
+class RusageWindow {
+  rusage start;
+  bool started;
+public:
+  RusageWindow(): started(false) {}
+
+  void begin();
+  void print();
+};
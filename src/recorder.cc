@@ -0,0 +1,217 @@
+#include "recorder.hh"
+#include "timing.hh"
+
+#include <stdlib.h>
+#include <string.h>
+
+// worst case for one tile: every pixel its own run
+static const int MAX_TILE_BYTES = 6 + VIDEO_TILE_SIZE * VIDEO_TILE_SIZE * 5;
+
+SessionRecorder::SessionRecorder(): head(0), tail(0), quit(false), out(nullptr),
+    width(0), height(0), tilesX(0), tilesY(0), previous(nullptr), encoded(nullptr),
+    first(true), numDropped(0), numCopied(0), copyMicros(0), numWritten(0), encodeMicros(0),
+    numTiles(0), numBytes(0) {
+  memset(frames, 0, sizeof(frames));
+}
+
+SessionRecorder::~SessionRecorder() {
+  close();
+}
+
+bool SessionRecorder::open(const char *path, VideoSurface *screen) {
+  width = screen->getWidth();
+  height = screen->getHeight();
+  tilesX = (width + VIDEO_TILE_SIZE - 1) / VIDEO_TILE_SIZE;
+  tilesY = (height + VIDEO_TILE_SIZE - 1) / VIDEO_TILE_SIZE;
+  out = fopen(path, "wb");
+  if (!out) {
+    perror("Can't open the recording");
+    return false;
+  }
+  size_t frameBytes = static_cast<size_t>(width) * height * 4;
+  for (int i = 0; i < QUEUE_SIZE; ++i) {
+    frames[i].pixels = static_cast<uint8_t*>(malloc(frameBytes));
+  }
+  previous = static_cast<uint8_t*>(malloc(frameBytes));
+  encoded = static_cast<uint8_t*>(malloc(static_cast<size_t>(tilesX) * tilesY * MAX_TILE_BYTES));
+  bool allocated = previous && encoded;
+  for (int i = 0; i < QUEUE_SIZE; ++i) {
+    allocated = allocated && frames[i].pixels;
+  }
+  if (!allocated) {
+    perror("Can't allocate the recording buffers");
+    fclose(out);
+    out = nullptr;
+    close();
+    return false;
+  }
+  setvbuf(out, nullptr, _IOFBF, 1 << 20);
+
+  VideoFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, VIDEO_MAGIC, sizeof(header.magic));
+  header.width = width;
+  header.height = height;
+  header.tileSize = VIDEO_TILE_SIZE;
+  header.redShift = __builtin_ctz(screen->mapRGBA(255, 0, 0, 0));
+  header.greenShift = __builtin_ctz(screen->mapRGBA(0, 255, 0, 0));
+  header.blueShift = __builtin_ctz(screen->mapRGBA(0, 0, 255, 0));
+  fwrite(&header, sizeof(header), 1, out);
+
+  sem_init(&wake, 0, 0);
+  writer = std::thread(&SessionRecorder::run, this);
+  return true;
+}
+
+void SessionRecorder::close() {
+  if (out) {
+    quit = true;
+    sem_post(&wake);
+    // queued frames are still written
+    writer.join();
+    sem_destroy(&wake);
+    if (fclose(out))
+      perror("Can't write the recording");
+    out = nullptr;
+  }
+  for (int i = 0; i < QUEUE_SIZE; ++i) {
+    free(frames[i].pixels);
+    frames[i].pixels = nullptr;
+  }
+  free(previous);
+  free(encoded);
+  previous = encoded = nullptr;
+}
+
+void SessionRecorder::frameShown(VideoSurface *screen, uint64_t micros) {
+  if (!out)
+    return;
+  unsigned h = head.load(std::memory_order_relaxed);
+  if (h - tail.load(std::memory_order_acquire) >= QUEUE_SIZE) {
+    ++numDropped;
+    return;
+  }
+  LockedSurface locked;
+  if (screen->lock(&locked)) {
+    ++numDropped;
+    return;
+  }
+  uint64_t start = monotonicMicros();
+  Frame &frame(frames[h % QUEUE_SIZE]);
+  int rowBytes = width * 4;
+  if (locked.pitch == rowBytes) {
+    memcpy(frame.pixels, locked.pixels, rowBytes * height);
+  } else {
+    for (int y = 0; y < height; ++y) {
+      memcpy(frame.pixels + y * rowBytes, locked.pixels + y * locked.pitch, rowBytes);
+    }
+  }
+  screen->unlock();
+  copyMicros += monotonicMicros() - start;
+  ++numCopied;
+  frame.micros = micros;
+  head.store(h + 1, std::memory_order_release);
+  sem_post(&wake);
+}
+
+void SessionRecorder::run() {
+  while (true) {
+    sem_wait(&wake);
+    unsigned t = tail.load(std::memory_order_relaxed);
+    while (t != head.load(std::memory_order_acquire)) {
+      uint64_t start = monotonicMicros();
+      encode(frames[t % QUEUE_SIZE]);
+      encodeMicros += monotonicMicros() - start;
+      tail.store(++t, std::memory_order_release);
+    }
+    if (quit)
+      break;
+  }
+}
+
+bool SessionRecorder::tileChanged(const uint8_t *frame, int x0, int y0, int w, int h) {
+  int rowBytes = width * 4;
+  size_t offset = static_cast<size_t>(y0) * rowBytes + x0 * 4;
+  for (int y = 0; y < h; ++y, offset += rowBytes) {
+    if (memcmp(frame + offset, previous + offset, w * 4))
+      return true;
+  }
+  return false;
+}
+
+uint8_t* SessionRecorder::encodeTile(uint8_t *dst, const uint8_t *frame, int tx, int ty, int w, int h) {
+  uint16_t pos[2] = { static_cast<uint16_t>(tx), static_cast<uint16_t>(ty) };
+  memcpy(dst, pos, sizeof(pos));
+  uint8_t *runCount = dst + 4;
+  dst += 6;
+  uint16_t runs = 0;
+  int runLength = 0;
+  uint32_t runPixel = 0;
+  for (int y = 0; y < h; ++y) {
+    const uint32_t *src = reinterpret_cast<const uint32_t*>(frame) +
+      (ty * VIDEO_TILE_SIZE + y) * width + tx * VIDEO_TILE_SIZE;
+    for (int x = 0; x < w; ++x) {
+      uint32_t p = src[x];
+      if (runLength && (p != runPixel || runLength == 256)) {
+        *dst++ = runLength - 1;
+        memcpy(dst, &runPixel, 4);
+        dst += 4;
+        ++runs;
+        runLength = 0;
+      }
+      runPixel = p;
+      ++runLength;
+    }
+  }
+  *dst++ = runLength - 1;
+  memcpy(dst, &runPixel, 4);
+  dst += 4;
+  ++runs;
+  memcpy(runCount, &runs, sizeof(runs));
+  return dst;
+}
+
+void SessionRecorder::encode(const Frame &frame) {
+  uint8_t *dst = encoded;
+  uint32_t changed = 0;
+  for (int ty = 0; ty < tilesY; ++ty) {
+    int y0 = ty * VIDEO_TILE_SIZE;
+    int h = height - y0 < VIDEO_TILE_SIZE ? height - y0 : VIDEO_TILE_SIZE;
+    for (int tx = 0; tx < tilesX; ++tx) {
+      int x0 = tx * VIDEO_TILE_SIZE;
+      int w = width - x0 < VIDEO_TILE_SIZE ? width - x0 : VIDEO_TILE_SIZE;
+      if (first || tileChanged(frame.pixels, x0, y0, w, h)) {
+        dst = encodeTile(dst, frame.pixels, tx, ty, w, h);
+        ++changed;
+        size_t offset = static_cast<size_t>(y0) * width * 4 + x0 * 4;
+        for (int y = 0; y < h; ++y, offset += width * 4) {
+          memcpy(previous + offset, frame.pixels + offset, w * 4);
+        }
+      }
+    }
+  }
+  first = false;
+
+  VideoFrameHeader header;
+  header.micros = frame.micros;
+  header.numTiles = changed;
+  header.bytes = dst - encoded;
+  fwrite(&header, sizeof(header), 1, out);
+  fwrite(encoded, 1, header.bytes, out);
+  ++numWritten;
+  numTiles += changed;
+  numBytes += sizeof(header) + header.bytes;
+}
+
+void SessionRecorder::printStats() {
+  int written = numWritten;
+  if (!written && !numDropped)
+    return;
+  int frames = written ? written : 1;
+  printf("Recording: %d frames, %d dropped, %.1f tiles and %.0f bytes per frame,"
+    " copy %.1f us, encode %.1f us on average\n",
+    written, numDropped, static_cast<double>(numTiles) / frames,
+    static_cast<double>(numBytes) / frames,
+    static_cast<double>(copyMicros) / (numCopied ? numCopied : 1),
+    static_cast<double>(encodeMicros) / frames);
+}
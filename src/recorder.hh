@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <stdio.h>
+#include <thread>
+#include <semaphore.h>
+
+#include "sdlcompat.hh"
+#include "videoformat.hh"
+
+// Records every presented frame to a file (--record FILE). The event loop
+// copies the screen into a small bounded queue, a writer thread diffs it
+// against the previous frame in tiles and writes the changed tiles run
+// length encoded. When the writer falls behind frames are dropped, never
+// waited for.
+class SessionRecorder {
+  static const int QUEUE_SIZE = 4;
+  struct Frame {
+    uint8_t *pixels;
+    uint64_t micros;
+  };
+  Frame frames[QUEUE_SIZE];
+  std::atomic<unsigned> head, tail;
+  std::atomic<bool> quit;
+  sem_t wake;
+  std::thread writer;
+  FILE *out;
+  int width, height;
+  int tilesX, tilesY;
+  // owned by the writer thread
+  uint8_t *previous;
+  uint8_t *encoded;
+  bool first;
+  int numDropped, numCopied;
+  uint64_t copyMicros;
+  std::atomic<int> numWritten;
+  std::atomic<uint64_t> encodeMicros, numTiles, numBytes;
+
+  void run();
+  bool tileChanged(const uint8_t *frame, int x0, int y0, int w, int h);
+  uint8_t* encodeTile(uint8_t *dst, const uint8_t *frame, int tx, int ty, int w, int h);
+  void encode(const Frame &frame);
+public:
+  SessionRecorder();
+  ~SessionRecorder();
+
+  bool open(const char *path, VideoSurface *screen);
+  void close();
+  inline bool isOpen() { return out != nullptr; }
+
+  void frameShown(VideoSurface *screen, uint64_t micros);
+  void printStats();
+};
@@ -0,0 +1,117 @@
+#include "rollover.hh"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+const char *RolloverAnalyzer::DEFAULT_TARGET = "a,s,d,f,g,h,j,k,l,space";
+
+RolloverAnalyzer::RolloverAnalyzer(): numTarget(0), maxHeld(0), bestHeld(0),
+    numBestMissing(0), numGhosts(0), totalGhosts(0) {
+  memset(inTarget, 0, sizeof(inTarget));
+}
+
+bool RolloverAnalyzer::setTarget(const char *list) {
+  numTarget = 0;
+  memset(inTarget, 0, sizeof(inTarget));
+  while (*list) {
+    const char *end = strchr(list, ',');
+    if (!end) end = list + strlen(list);
+    char name[32];
+    size_t len = std::min(static_cast<size_t>(end - list), sizeof(name) - 1);
+    memcpy(name, list, len);
+    name[len] = 0;
+    int code = keyCodeFromName(name);
+    if (code < 0 || code >= NUM_SCANCODES) {
+      fprintf(stderr, "Unknown key: %s\n", name);
+      return false;
+    }
+    if (!inTarget[code]) {
+      if (numTarget == MAX_TARGET_KEYS) {
+        fprintf(stderr, "At most %d keys can be tested at once\n", MAX_TARGET_KEYS);
+        return false;
+      }
+      inTarget[code] = true;
+      target[numTarget++] = code;
+    }
+    list = *end ? end + 1 : end;
+  }
+  return numTarget > 0;
+}
+
+int RolloverAnalyzer::countTargetHeld(const PressedKeys &keys) {
+  int n = 0;
+  for (int k = keys.first(); k >= 0; k = keys.next(k)) {
+    if (inTarget[k]) ++n;
+  }
+  return n;
+}
+
+void RolloverAnalyzer::press(const PressedKeys &keys, int code) {
+  int held = keys.size();
+  if (held > maxHeld) maxHeld = held;
+  if (code < 0 || code >= NUM_SCANCODES)
+    return;
+
+  if (inTarget[code]) {
+    int targetHeld = countTargetHeld(keys);
+    if (targetHeld > bestHeld) {
+      bestHeld = targetHeld;
+      numBestMissing = 0;
+      for (int i = 0; i < numTarget; ++i) {
+        if (!keys.isDown(target[i])) bestMissing[numBestMissing++] = target[i];
+      }
+    }
+    return;
+  }
+  if (held - 1 < GHOST_MIN_HELD)
+    return;
+
+  // nobody asked for this one, record who was down when it appeared
+  Ghost ghost;
+  ghost.numKeys = 0;
+  for (int k = keys.first(); k >= 0 && ghost.numKeys < MAX_TARGET_KEYS; k = keys.next(k)) {
+    if (k != code) ghost.keys[ghost.numKeys++] = k;
+  }
+  std::sort(ghost.keys, ghost.keys + ghost.numKeys);
+  ghost.held = held - 1;
+  ghost.ghost = code;
+  ghost.count = 1;
+  ++totalGhosts;
+
+  for (int i = 0; i < numGhosts; ++i) {
+    Ghost &g(ghosts[i]);
+    if (g.ghost == code && g.numKeys == ghost.numKeys &&
+        !memcmp(g.keys, ghost.keys, sizeof(uint16_t) * ghost.numKeys)) {
+      ++g.count;
+      return;
+    }
+  }
+  if (numGhosts < MAX_GHOSTS) ghosts[numGhosts++] = ghost;
+}
+
+void RolloverAnalyzer::printStats() {
+  if (!maxHeld)
+    return;
+  printf("Rollover: up to %d keys held at once, %d of the %d prescribed ones together\n",
+      maxHeld, bestHeld, numTarget);
+  if (numBestMissing) {
+    printf("  never arrived with the rest held:");
+    for (int i = 0; i < numBestMissing; ++i) {
+      const char *name = keyNameFromCode(bestMissing[i]);
+      printf(" [%s]", name ? name : "?");
+    }
+    printf("\n");
+  }
+  for (int i = 0; i < numGhosts; ++i) {
+    Ghost &g(ghosts[i]);
+    const char *name = keyNameFromCode(g.ghost);
+    printf("  ghost %s appeared %u times while holding %d keys:", name ? name : "?", g.count, g.held);
+    for (int k = 0; k < g.numKeys; ++k) {
+      name = keyNameFromCode(g.keys[k]);
+      printf(" [%s]", name ? name : "?");
+    }
+    printf("\n");
+  }
+  fflush(stdout);
+}
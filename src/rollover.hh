@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+#include "keystate.hh"
+
+typedef PressedSet<NUM_SCANCODES> PressedKeys;
+
+// Guided N-key rollover test: the user holds down a prescribed set of keys
+// together. A keyboard out of rollover sends nothing for the extra keys
+// (and the kernel discards USB ErrorRollOver reports), so the only way to
+// see a missing key is to know which keys should be down: the analyzer
+// keeps the most prescribed keys seen held at once and which of them never
+// arrived then. It also catches ghosting, a key outside the set going down
+// while three or more are held (on a matrix without diodes three held keys
+// at the corners of a rectangle close the fourth).
+class RolloverAnalyzer {
+public:
+  static const int MAX_TARGET_KEYS = 32;
+  static const int MAX_GHOSTS = 32;
+  static const int GHOST_MIN_HELD = 3;
+  // the home row and space bar, a finger each
+  static const char *DEFAULT_TARGET;
+private:
+  struct Ghost {
+    uint16_t keys[MAX_TARGET_KEYS];
+    int numKeys;
+    // held in total, may be more than the keys listed
+    int held;
+    int ghost;
+    uint32_t count;
+  };
+
+  uint16_t target[MAX_TARGET_KEYS];
+  int numTarget;
+  bool inTarget[NUM_SCANCODES];
+  int maxHeld;
+  // most prescribed keys down together, and the ones up at that moment
+  int bestHeld;
+  uint16_t bestMissing[MAX_TARGET_KEYS];
+  int numBestMissing;
+  Ghost ghosts[MAX_GHOSTS];
+  int numGhosts;
+  uint32_t totalGhosts;
+public:
+  RolloverAnalyzer();
+
+  // comma separated key names as SDL calls them, e.g. "a,s,d,f,space"
+  bool setTarget(const char *list);
+
+  void press(const PressedKeys &keys, int code);
+
+  inline int getNumTarget() { return numTarget; }
+  inline int getTargetKey(int i) { return target[i]; }
+  int countTargetHeld(const PressedKeys &keys);
+  inline int getMaxHeld() { return maxHeld; }
+  inline int getBestHeld() { return bestHeld; }
+  inline uint32_t getTotalGhosts() { return totalGhosts; }
+  void printStats();
+};
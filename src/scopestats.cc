@@ -0,0 +1,26 @@
+#include "scopestats.hh"
+
+#ifdef SCOPE_STATS
+
+#include <stdio.h>
+
+static ScopeSite *sites = nullptr;
+
+ScopeSite::ScopeSite(const char *name, const char *unit):
+    name(name), unit(unit), calls(0), nanos(0), units(0), next(sites) {
+  sites = this;
+}
+
+void printScopeStats() {
+  printf("%-20s %10s %12s %10s %14s\n", "scope", "calls", "total ms", "ns/call", "per call");
+  for (ScopeSite *s = sites; s; s = s->next) {
+    if (!s->calls) continue;
+    printf("%-20s %10llu %12.3f %10llu %8llu %-5s\n", s->name,
+        static_cast<unsigned long long>(s->calls), s->nanos / 1e6,
+        static_cast<unsigned long long>(s->nanos / s->calls),
+        static_cast<unsigned long long>(s->units / s->calls), s->unit);
+  }
+  fflush(stdout);
+}
+
+#endif
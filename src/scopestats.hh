@@ -0,0 +1,48 @@
+#pragma once
+
+// Call counts, time and pixels (or bytes) per call site of the hot drawing
+// and event paths. Only built with the SCOPE_STATS option, otherwise the
+// macros expand to nothing and no counters exist.
+#ifdef SCOPE_STATS
+
+#include <stdint.h>
+
+#include "timing.hh"
+
+struct ScopeSite {
+  const char *name;
+  const char *unit;
+  uint64_t calls, nanos, units;
+  ScopeSite *next;
+
+  ScopeSite(const char *name, const char *unit);
+};
+
+class ScopeTimer {
+  ScopeSite &site;
+  uint64_t start;
+public:
+  inline ScopeTimer(ScopeSite &site, uint64_t units): site(site), start(monotonicNanos()) {
+    site.units += units;
+  }
+  inline ~ScopeTimer() {
+    ++site.calls;
+    site.nanos += monotonicNanos() - start;
+  }
+};
+
+void printScopeStats();
+
+#define SCOPE_STAT_JOIN2(a, b) a##b
+#define SCOPE_STAT_JOIN(a, b) SCOPE_STAT_JOIN2(a, b)
+// times the rest of the enclosing scope
+#define SCOPE_STAT(name, unit, amount) \
+  static ScopeSite SCOPE_STAT_JOIN(scopeSite, __LINE__)(name, unit); \
+  ScopeTimer SCOPE_STAT_JOIN(scopeTimer, __LINE__)(SCOPE_STAT_JOIN(scopeSite, __LINE__), amount)
+
+#else
+
+#define SCOPE_STAT(name, unit, amount)
+inline void printScopeStats() {}
+
+#endif
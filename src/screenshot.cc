@@ -0,0 +1,164 @@
+#include "screenshot.hh"
+#include "timing.hh"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static ScreenshotWriter *signalTarget = nullptr;
+
+ScreenshotWriter::~ScreenshotWriter() {
+  stop();
+}
+
+void ScreenshotWriter::onSignal(int) {
+  // only async-signal-safe calls here, the worker pushes the event
+  if (signalTarget) {
+    signalTarget->triggered = true;
+    sem_post(&signalTarget->wake);
+  }
+}
+
+bool ScreenshotWriter::start(VideoSurface *screen, const char *outputDir, int type) {
+  width = screen->getWidth();
+  height = screen->getHeight();
+  dir = outputDir;
+  eventType = type;
+  for (int i = 0; i < POOL_SIZE; ++i) {
+    shots[i].pixels = static_cast<uint8_t*>(malloc(width * height * 4));
+    if (!shots[i].pixels) {
+      perror("Can't allocate screenshot buffers");
+      while (i--) free(shots[i].pixels);
+      return false;
+    }
+  }
+  // encoded in the screen's own channel order
+  uint32_t r = screen->mapRGBA(255, 0, 0, 0);
+  uint32_t g = screen->mapRGBA(0, 255, 0, 0);
+  uint32_t b = screen->mapRGBA(0, 0, 255, 0);
+  shifts[0] = __builtin_ctz(r);
+  shifts[1] = __builtin_ctz(g);
+  shifts[2] = __builtin_ctz(b);
+  sem_init(&wake, 0, 0);
+  worker = std::thread(&ScreenshotWriter::run, this);
+  started = true;
+
+  signalTarget = this;
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = onSignal;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGUSR2, &action, nullptr);
+  return true;
+}
+
+void ScreenshotWriter::stop() {
+  if (!started)
+    return;
+  signal(SIGUSR2, SIG_DFL);
+  signalTarget = nullptr;
+  quit = true;
+  sem_post(&wake);
+  // pending shots are still written
+  worker.join();
+  sem_destroy(&wake);
+  for (int i = 0; i < POOL_SIZE; ++i) {
+    free(shots[i].pixels);
+  }
+  started = false;
+}
+
+bool ScreenshotWriter::capture(VideoSurface *screen) {
+  unsigned h = head.load(std::memory_order_relaxed);
+  if (h - tail.load(std::memory_order_acquire) >= POOL_SIZE ||
+      screen->getWidth() != width || screen->getHeight() != height) {
+    ++numDropped;
+    return false;
+  }
+  LockedSurface locked;
+  if (screen->lock(&locked)) {
+    ++numDropped;
+    return false;
+  }
+  uint64_t start = monotonicMicros();
+  Shot &shot(shots[h % POOL_SIZE]);
+  int rowBytes = width * 4;
+  if (locked.pitch == rowBytes) {
+    memcpy(shot.pixels, locked.pixels, rowBytes * height);
+  } else {
+    for (int y = 0; y < height; ++y) {
+      memcpy(shot.pixels + y * rowBytes, locked.pixels + y * locked.pitch, rowBytes);
+    }
+  }
+  screen->unlock();
+  copyMicros += monotonicMicros() - start;
+  shot.taken = time(nullptr);
+  shot.number = numTaken++;
+  head.store(h + 1, std::memory_order_release);
+  sem_post(&wake);
+  return true;
+}
+
+void ScreenshotWriter::run() {
+  uint8_t *row = static_cast<uint8_t*>(malloc(width * 3));
+  while (true) {
+    sem_wait(&wake);
+    if (triggered.exchange(false)) {
+      SDL_Event event;
+      memset(&event, 0, sizeof(event));
+      event.type = eventType;
+      SDL_PushEvent(&event);
+    }
+    unsigned t = tail.load(std::memory_order_relaxed);
+    while (t != head.load(std::memory_order_acquire)) {
+      uint64_t start = monotonicMicros();
+      encode(shots[t % POOL_SIZE], row);
+      encodeMicros += monotonicMicros() - start;
+      tail.store(++t, std::memory_order_release);
+    }
+    if (quit)
+      break;
+  }
+  free(row);
+}
+
+void ScreenshotWriter::encode(const Shot &shot, uint8_t *row) {
+  char stamp[32];
+  char path[1024];
+  struct tm local;
+  localtime_r(&shot.taken, &local);
+  strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+  snprintf(path, sizeof(path), "%s/intester-%s-%d.ppm", dir, stamp, shot.number);
+  FILE *out = fopen(path, "wb");
+  if (!out) {
+    perror("Can't write screenshot");
+    return;
+  }
+  fprintf(out, "P6\n%d %d\n255\n", width, height);
+  const uint32_t *src = reinterpret_cast<const uint32_t*>(shot.pixels);
+  for (int y = 0; y < height; ++y) {
+    uint8_t *dst = row;
+    for (int x = 0; x < width; ++x) {
+      uint32_t p = *src++;
+      *dst++ = p >> shifts[0];
+      *dst++ = p >> shifts[1];
+      *dst++ = p >> shifts[2];
+    }
+    fwrite(row, 3, width, out);
+  }
+  if (fclose(out))
+    perror("Can't write screenshot");
+  else
+    printf("Screenshot saved to %s\n", path);
+}
+
+void ScreenshotWriter::printStats() {
+  if (!numTaken && !numDropped)
+    return;
+  int written = numTaken ? numTaken : 1;
+  printf("Screenshots: %d taken, %d dropped, copy %.1f us, encode %.1f ms on average\n",
+    numTaken, numDropped, static_cast<double>(copyMicros) / written,
+    encodeMicros / 1000.0 / written);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <time.h>
+#include <semaphore.h>
+
+#include "sdlcompat.hh"
+
+// Screen captures (PrintScreen or SIGUSR2), only with --screenshot-dir so
+// the buffers and the thread cost nothing otherwise. The event loop only
+// copies the screen into a preallocated slot, a worker thread converts it
+// to PPM and writes it out, so disk speed never shows up in the frame time.
+class ScreenshotWriter {
+  static const int POOL_SIZE = 3;
+  struct Shot {
+    uint8_t *pixels;
+    time_t taken;
+    int number;
+  };
+  Shot shots[POOL_SIZE];
+  // single producer (the event loop), single consumer (the worker)
+  std::atomic<unsigned> head, tail;
+  std::atomic<bool> quit, triggered;
+  sem_t wake;
+  bool started;
+  std::thread worker;
+  const char *dir;
+  int width, height;
+  int shifts[3];
+  int eventType;
+  int numTaken, numDropped;
+  uint64_t copyMicros;
+  std::atomic<uint64_t> encodeMicros;
+
+  void run();
+  void encode(const Shot &shot, uint8_t *row);
+  static void onSignal(int sig);
+public:
+  ScreenshotWriter(): head(0), tail(0), quit(false), triggered(false), started(false), dir("."),
+      width(0), height(0), eventType(0), numTaken(0), numDropped(0), copyMicros(0), encodeMicros(0) {}
+  ~ScreenshotWriter();
+
+  // allocates the pool for the screen size, starts the worker and installs
+  // the SIGUSR2 handler which makes the worker push eventType
+  bool start(VideoSurface *screen, const char *dir, int eventType);
+  void stop();
+  inline bool isStarted() { return started; }
+  // false when every slot is still waiting for the encoder
+  bool capture(VideoSurface *screen);
+  void printStats();
+};
@@ -0,0 +1,7729 @@
+// Generated by tools/sdfbake from RussoOne_Regular_ttf, do not edit.
+
+static const uint8_t sdfFontAtlas[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x15, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1c, 0x12, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x12,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x13, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x17, 0x22, 0x27, 0x29, 0x29, 0x29, 0x29, 0x27, 0x22, 0x18,
+  0x0a, 0x00, 0x00, 0x00, 0x0a, 0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c,
+  0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0b, 0x14, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x18, 0x18, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x19, 0x13, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x1a, 0x28, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d,
+  0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16, 0x02, 0x00, 0x00,
+  0x00, 0x04, 0x16, 0x1f, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x34,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x32, 0x1e, 0x05, 0x00, 0x00,
+  0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b,
+  0x2d, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2d, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x1b, 0x2e, 0x38, 0x39, 0x39, 0x39, 0x39, 0x38, 0x30, 0x1e, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x25,
+  0x34, 0x40, 0x46, 0x48, 0x48, 0x48, 0x48, 0x46, 0x40, 0x35, 0x25, 0x12,
+  0x00, 0x0b, 0x23, 0x35, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x32, 0x1e,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x1b, 0x29, 0x33, 0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x37,
+  0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x17, 0x2a, 0x37, 0x37, 0x2a, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x25, 0x33, 0x38, 0x30, 0x1e, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x31, 0x45, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x42, 0x2f, 0x15, 0x00, 0x00, 0x00, 0x1a,
+  0x31, 0x3f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x3d, 0x2e, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x4b, 0x30, 0x13, 0x00, 0x00, 0x0b, 0x29,
+  0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x29, 0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x44, 0x44,
+  0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x44, 0x29, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x48,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x4b, 0x32, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3d, 0x50, 0x5e,
+  0x64, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5e, 0x50, 0x3f, 0x29, 0x11, 0x1b,
+  0x37, 0x50, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x4b, 0x30, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x25, 0x37, 0x45,
+  0x52, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x29, 0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x53, 0x3b, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2f, 0x43,
+  0x55, 0x55, 0x42, 0x2f, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15,
+  0x29, 0x3d, 0x50, 0x58, 0x4b, 0x34, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x1e, 0x20, 0x2d, 0x48,
+  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x55, 0x3e, 0x22, 0x21, 0x1c, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23, 0x41,
+  0x5e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x5b, 0x40, 0x22, 0x03, 0x00, 0x0c, 0x2b, 0x47, 0x5d,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x5b, 0x44, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x77, 0x58, 0x38, 0x19, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32,
+  0x50, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x70, 0x50, 0x53, 0x70, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0f, 0x19, 0x38, 0x58, 0x75, 0x78,
+  0x78, 0x78, 0x78, 0x77, 0x5b, 0x3c, 0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x3c, 0x53, 0x6a, 0x7a, 0x88, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x88, 0x7c, 0x6b, 0x56, 0x3d, 0x22, 0x2b, 0x47, 0x62,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x77, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x3d, 0x50, 0x62, 0x70, 0x78,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x44, 0x5b, 0x6f, 0x6f,
+  0x5b, 0x47, 0x33, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x18, 0x2d, 0x41, 0x56,
+  0x6a, 0x77, 0x61, 0x4b, 0x33, 0x1b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x3c, 0x40, 0x35, 0x54, 0x73, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x68, 0x48, 0x39, 0x41, 0x39, 0x26, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0x90, 0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa0,
+  0xa0, 0xa0, 0x88, 0x70, 0x94, 0xa0, 0xa0, 0xa0, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x1a, 0x38, 0x58, 0x77,
+  0x98, 0xa0, 0xa0, 0xa0, 0x8d, 0x6c, 0x4c, 0x58, 0x78, 0x98, 0xa0, 0xa0,
+  0xa0, 0x8c, 0x6c, 0x4c, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x13, 0x22, 0x2d, 0x36, 0x3b, 0x58, 0x78, 0x9b, 0x9c, 0x9c,
+  0x9c, 0x78, 0x59, 0x3d, 0x3d, 0x3d, 0x3b, 0x30, 0x1b, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x2e, 0x4b, 0x67, 0x84, 0x99, 0xa6, 0xac, 0xac, 0xac,
+  0xac, 0xa6, 0x99, 0x86, 0x69, 0x4c, 0x30, 0x3b, 0x56, 0x72, 0x8e, 0xa0,
+  0xa0, 0xa0, 0x89, 0x6c, 0x50, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x37, 0x52, 0x6a, 0x7c, 0x8e, 0x98, 0x9e, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xa0, 0xa0, 0xa0, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x29, 0x41, 0x59, 0x70, 0x8b, 0x89, 0x72, 0x5e,
+  0x4b, 0x33, 0x17, 0x00, 0x00, 0x10, 0x2c, 0x45, 0x59, 0x6c, 0x84, 0x91,
+  0x77, 0x5e, 0x48, 0x30, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0x27, 0x41, 0x58, 0x5f, 0x50, 0x54, 0x74, 0x98, 0xa0, 0xa0,
+  0x8c, 0x68, 0x48, 0x55, 0x60, 0x53, 0x3b, 0x1f, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xb0,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac, 0xac, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xbc, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc0, 0xa8,
+  0x88, 0x70, 0x94, 0xb4, 0xc0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x00, 0x00, 0x0e, 0x1e, 0x25, 0x25, 0x25, 0x3f, 0x5e, 0x7c, 0x9e, 0xbd,
+  0xc0, 0xa6, 0x88, 0x65, 0x47, 0x60, 0x7c, 0xa0, 0xbe, 0xc0, 0xa4, 0x86,
+  0x64, 0x45, 0x26, 0x17, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a,
+  0x2d, 0x3e, 0x4b, 0x54, 0x5a, 0x5c, 0x74, 0x98, 0xb6, 0xb8, 0x98, 0x74,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x38, 0x57, 0x74, 0x94, 0xb0, 0xb0, 0x9b, 0x94, 0x94, 0x9b, 0xb0,
+  0xb0, 0x95, 0x75, 0x58, 0x38, 0x4b, 0x65, 0x84, 0x9e, 0xbb, 0xb2, 0x95,
+  0x77, 0x5d, 0x40, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x29, 0x47, 0x63, 0x7c, 0x99, 0xab, 0xb7, 0xbd, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xc0, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x22, 0x3c, 0x56, 0x6c, 0x89, 0x9f, 0xa2, 0x8e, 0x77, 0x5e, 0x3f,
+  0x20, 0x00, 0x00, 0x18, 0x38, 0x57, 0x72, 0x89, 0x9c, 0xa7, 0x8e, 0x75,
+  0x5b, 0x42, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x37, 0x52, 0x6c, 0x7a, 0x6c, 0x5d, 0x74, 0x98, 0xb8, 0xac, 0x8c, 0x68,
+  0x60, 0x70, 0x84, 0x65, 0x4b, 0x30, 0x14, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x16, 0x1f, 0x21, 0x21, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x21, 0x21, 0x20, 0x17, 0x07, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc5, 0xa7, 0x88, 0x70,
+  0x90, 0xb0, 0xc8, 0xa8, 0x8b, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x0c,
+  0x26, 0x3b, 0x44, 0x44, 0x44, 0x46, 0x64, 0x88, 0xa5, 0xc4, 0xbe, 0xa0,
+  0x7c, 0x5f, 0x47, 0x65, 0x88, 0xa6, 0xc5, 0xbc, 0x9d, 0x7c, 0x5e, 0x44,
+  0x41, 0x31, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x47, 0x59,
+  0x69, 0x73, 0x78, 0x7c, 0x7c, 0x94, 0xb4, 0xb4, 0x94, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0x9c, 0xbc, 0xa1, 0x84, 0x70, 0x70, 0x84, 0xa1, 0xbd, 0x9e,
+  0x7c, 0x5c, 0x3e, 0x5b, 0x75, 0x94, 0xae, 0xbe, 0xa2, 0x86, 0x69, 0x4c,
+  0x32, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34,
+  0x53, 0x70, 0x90, 0xab, 0xc4, 0xd5, 0xcc, 0xbc, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc5, 0xa7,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x34,
+  0x4e, 0x67, 0x84, 0x9c, 0xb5, 0xb2, 0x97, 0x7a, 0x5e, 0x3f, 0x20, 0x00,
+  0x00, 0x18, 0x38, 0x57, 0x72, 0x90, 0xab, 0xbb, 0xa3, 0x8b, 0x6f, 0x55,
+  0x3b, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2c, 0x47, 0x62,
+  0x7c, 0x99, 0x89, 0x77, 0x74, 0x98, 0xb8, 0xac, 0x8c, 0x6c, 0x7c, 0x8e,
+  0x94, 0x75, 0x5b, 0x40, 0x25, 0x09, 0x00, 0x00, 0x00, 0x1a, 0x31, 0x3f,
+  0x41, 0x41, 0x41, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xac, 0x8c, 0x68, 0x48,
+  0x41, 0x41, 0x41, 0x3f, 0x33, 0x1e, 0x05, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb0, 0xb5, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x10, 0x30, 0x4f, 0x6c, 0x90, 0xb0, 0xc1, 0xa3, 0x84, 0x6c, 0x8d, 0xac,
+  0xc4, 0xa5, 0x88, 0x64, 0x44, 0x25, 0x06, 0x00, 0x00, 0x19, 0x37, 0x53,
+  0x64, 0x64, 0x64, 0x64, 0x6c, 0x8c, 0xac, 0xca, 0xb7, 0x98, 0x78, 0x64,
+  0x64, 0x6c, 0x8e, 0xac, 0xcb, 0xb6, 0x98, 0x75, 0x64, 0x64, 0x5e, 0x45,
+  0x28, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x45, 0x5e, 0x72, 0x88, 0x94,
+  0x9c, 0xa0, 0xa0, 0xa5, 0xbd, 0xbd, 0xa5, 0xa0, 0xa0, 0xa0, 0xa0, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xa0, 0x7c, 0x5c, 0x5c, 0x7c, 0xa0, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x4e, 0x6a, 0x88, 0xa2, 0xbe, 0xae, 0x92, 0x75, 0x59, 0x3e, 0x22, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x78,
+  0x99, 0xb8, 0xd5, 0xce, 0xb5, 0xa0, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x8c, 0x68, 0x48, 0x29, 0x19, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x30, 0x4f, 0x6c, 0x90, 0xb0, 0xc1, 0xa3, 0x84, 0x60,
+  0x41, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x44, 0x60, 0x7a,
+  0x96, 0xb0, 0xc0, 0xa3, 0x88, 0x6a, 0x4e, 0x34, 0x17, 0x00, 0x00, 0x10,
+  0x2c, 0x47, 0x62, 0x7c, 0x9c, 0xb7, 0xb6, 0x9d, 0x84, 0x67, 0x4c, 0x30,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3d, 0x57, 0x72, 0x90, 0xab,
+  0xa5, 0x95, 0x86, 0x98, 0xb8, 0xac, 0x8d, 0x8b, 0x99, 0xa9, 0xa3, 0x89,
+  0x6b, 0x50, 0x34, 0x17, 0x00, 0x00, 0x0c, 0x2b, 0x47, 0x5d, 0x60, 0x60,
+  0x60, 0x60, 0x64, 0x88, 0xa8, 0xc7, 0xac, 0x8c, 0x68, 0x60, 0x60, 0x60,
+  0x60, 0x5e, 0x4b, 0x30, 0x13, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90,
+  0x90, 0x9d, 0xba, 0xa2, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x0c, 0x2c,
+  0x4b, 0x69, 0x8c, 0xac, 0xbe, 0xa0, 0x7c, 0x68, 0x89, 0xa8, 0xc0, 0xa1,
+  0x84, 0x60, 0x41, 0x21, 0x02, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88,
+  0x88, 0x88, 0x88, 0x95, 0xb2, 0xd1, 0xb4, 0x95, 0x88, 0x88, 0x88, 0x88,
+  0x95, 0xb4, 0xd2, 0xb4, 0x95, 0x88, 0x88, 0x88, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x1c, 0x39, 0x55, 0x72, 0x8b, 0xa2, 0xb1, 0xba, 0xc0,
+  0xc0, 0xc3, 0xd2, 0xd2, 0xc3, 0xc0, 0xc0, 0xc0, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x5c, 0x7c, 0xa0, 0xc0, 0xa0, 0x7c, 0x5c, 0x5e, 0x78,
+  0x97, 0xb2, 0xbb, 0x9e, 0x84, 0x65, 0x4a, 0x2e, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xbf,
+  0xdd, 0xc1, 0xa3, 0x89, 0x73, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x63, 0x46, 0x42, 0x34, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x2c, 0x4b, 0x69, 0x8c, 0xac, 0xbe, 0xa0, 0x7c, 0x5c, 0x3d, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x54, 0x70, 0x8d, 0xa8, 0xc2,
+  0xb2, 0x95, 0x77, 0x5b, 0x3e, 0x23, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x37,
+  0x54, 0x6e, 0x8e, 0xab, 0xc7, 0xae, 0x94, 0x77, 0x5b, 0x40, 0x24, 0x07,
+  0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x86, 0x99, 0xa9, 0xb9, 0xb0,
+  0xa4, 0xab, 0xc2, 0xb8, 0xa6, 0xa6, 0xb5, 0xb4, 0xa5, 0x94, 0x7a, 0x5c,
+  0x3c, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x89, 0xa8, 0xc8, 0xac, 0x8d, 0x84, 0x84, 0x84, 0x84, 0x84, 0x77,
+  0x58, 0x38, 0x19, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x7c, 0x9c,
+  0xab, 0x91, 0x75, 0x59, 0x3e, 0x21, 0x02, 0x00, 0x0f, 0x2e, 0x4c, 0x67,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x67, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb,
+  0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x08, 0x28, 0x47, 0x65,
+  0x88, 0xa8, 0xba, 0x9c, 0x78, 0x64, 0x86, 0xa4, 0xbc, 0x9d, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa8, 0xa8,
+  0xa8, 0xac, 0xc1, 0xdc, 0xc1, 0xac, 0xa8, 0xa8, 0xa8, 0xa8, 0xac, 0xc1,
+  0xdc, 0xc1, 0xac, 0xa8, 0xa8, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x07, 0x25, 0x44, 0x62, 0x84, 0x9e, 0xb8, 0xcd, 0xd4, 0xc0, 0xb5, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x5c, 0x7c, 0xa0, 0xc0, 0xa0, 0x7c, 0x5c, 0x6e, 0x8b, 0xa7, 0xc2,
+  0xab, 0x90, 0x72, 0x56, 0x3b, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc,
+  0x9c, 0x78, 0x5b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x62, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x60, 0x49, 0x2c, 0x11, 0x05, 0x00, 0x00, 0x00, 0x08, 0x28,
+  0x47, 0x65, 0x88, 0xa8, 0xba, 0x9c, 0x78, 0x58, 0x3a, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x29, 0x45, 0x62, 0x7c, 0x9d, 0xb8, 0xc3, 0xa5, 0x89,
+  0x69, 0x4c, 0x30, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x45, 0x62,
+  0x7c, 0x9d, 0xbb, 0xc0, 0xa3, 0x89, 0x6b, 0x4e, 0x31, 0x14, 0x00, 0x00,
+  0x00, 0x02, 0x21, 0x3e, 0x59, 0x6c, 0x7c, 0x8e, 0x9e, 0xad, 0xc1, 0xc8,
+  0xd7, 0xd0, 0xc5, 0xbb, 0xa9, 0x99, 0x89, 0x77, 0x67, 0x53, 0x37, 0x19,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa4, 0xa4, 0xa4, 0xa4, 0xa5,
+  0xb5, 0xd0, 0xb8, 0xa6, 0xa4, 0xa4, 0xa4, 0xa4, 0x9c, 0x78, 0x58, 0x39,
+  0x19, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4e, 0x6b, 0x8b, 0xa7, 0x9b, 0x7c,
+  0x63, 0x49, 0x2e, 0x13, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a,
+  0x3a, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x04, 0x24, 0x43, 0x62, 0x84, 0xa4,
+  0xa4, 0x98, 0x74, 0x60, 0x84, 0xa0, 0xa4, 0x99, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xc3, 0xca,
+  0xd8, 0xd4, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xca, 0xd8, 0xd4, 0xc4,
+  0xc0, 0xc0, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x0d, 0x2c,
+  0x4c, 0x6b, 0x8c, 0xa9, 0xc8, 0xd9, 0xbe, 0xa7, 0x97, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xa0, 0x7c, 0x5c, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xa0, 0x7c, 0x62, 0x7c, 0x9b, 0xb6, 0xb7, 0x9b, 0x7c,
+  0x62, 0x47, 0x2b, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9d, 0xbc, 0xdb, 0xbc, 0x9c, 0x78,
+  0x58, 0x39, 0x35, 0x35, 0x38, 0x58, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x70, 0x50, 0x35, 0x30, 0x20, 0x0a, 0x00, 0x00, 0x04, 0x24, 0x43, 0x62,
+  0x84, 0xa4, 0xa4, 0x98, 0x74, 0x54, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x36, 0x54, 0x70, 0x8e, 0xab, 0xc7, 0xb9, 0x9b, 0x7a, 0x5d, 0x40,
+  0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x55, 0x73, 0x92,
+  0xb0, 0xce, 0xb4, 0x97, 0x77, 0x5b, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00,
+  0x13, 0x2c, 0x40, 0x50, 0x60, 0x70, 0x84, 0x94, 0xb1, 0xd0, 0xf0, 0xe8,
+  0xc8, 0xa9, 0x8e, 0x7c, 0x6c, 0x5d, 0x4c, 0x3c, 0x26, 0x0c, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc3, 0xc3, 0xc3, 0xc4, 0xce, 0xe2,
+  0xd0, 0xc5, 0xc3, 0xc3, 0xc3, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00,
+  0x00, 0x00, 0x1c, 0x3b, 0x59, 0x77, 0x95, 0x98, 0x89, 0x6c, 0x53, 0x37,
+  0x1d, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2b, 0x20, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5e, 0x7c, 0x84, 0x84, 0x84,
+  0x70, 0x5c, 0x7a, 0x84, 0x84, 0x84, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa5, 0xbc, 0xd7, 0xc0,
+  0xa8, 0xa0, 0xa0, 0xa0, 0xa0, 0xa5, 0xbd, 0xd9, 0xbf, 0xa8, 0xa0, 0xa0,
+  0xa0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x92, 0xb0, 0xd0, 0xcb, 0xae, 0x92, 0x77, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x6c, 0x52, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0x9e, 0xbd, 0xa0, 0x7c, 0x68, 0x68, 0x7c, 0xa0,
+  0xbf, 0xa0, 0x7c, 0x72, 0x8e, 0xab, 0xc3, 0xa7, 0x8d, 0x6e, 0x53, 0x37,
+  0x21, 0x21, 0x21, 0x1e, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x38, 0x58, 0x75, 0x95, 0xb3, 0xcd, 0xbc, 0x9c, 0x7a, 0x5d, 0x54,
+  0x54, 0x54, 0x54, 0x5d, 0x7c, 0x9d, 0xa8, 0xa8, 0xa8, 0x94, 0x70, 0x54,
+  0x54, 0x4c, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x3f, 0x5e, 0x7c, 0x84,
+  0x84, 0x84, 0x70, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x05, 0x23, 0x41,
+  0x5e, 0x7c, 0x9c, 0xb9, 0xcd, 0xae, 0x90, 0x70, 0x53, 0x35, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x4a, 0x68, 0x88, 0xa6, 0xc4,
+  0xc0, 0xa3, 0x88, 0x67, 0x49, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x17, 0x31,
+  0x47, 0x56, 0x67, 0x75, 0x89, 0x99, 0xb4, 0xd2, 0xeb, 0xe5, 0xca, 0xac,
+  0x94, 0x84, 0x72, 0x62, 0x52, 0x41, 0x2b, 0x10, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xbe, 0xd6, 0xc1, 0xb1,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+  0x1c, 0x3b, 0x5a, 0x73, 0x74, 0x74, 0x73, 0x5d, 0x41, 0x27, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd9, 0xba, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x60, 0x60, 0x60, 0x60, 0x5d, 0x4d,
+  0x5f, 0x60, 0x60, 0x60, 0x5e, 0x4a, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x1d,
+  0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x90, 0xb0, 0xcf, 0xb4, 0x95, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x94, 0xb4, 0xd3, 0xb4, 0x94, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc7, 0xa8, 0x88, 0x65, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x4f, 0x3f, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38,
+  0x58, 0x77, 0x97, 0xb4, 0xab, 0x94, 0x8c, 0x8c, 0x94, 0xaa, 0xb5, 0x98,
+  0x78, 0x84, 0x9e, 0xbb, 0xb4, 0x99, 0x7a, 0x5e, 0x44, 0x41, 0x41, 0x41,
+  0x41, 0x3c, 0x33, 0x25, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30,
+  0x4e, 0x6b, 0x88, 0xa2, 0xb5, 0xc3, 0xa5, 0x8b, 0x78, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x84, 0xa4, 0xc3, 0xc7, 0xb4, 0x94, 0x74, 0x74, 0x74, 0x62,
+  0x43, 0x24, 0x04, 0x00, 0x00, 0x18, 0x35, 0x50, 0x60, 0x60, 0x60, 0x60,
+  0x5d, 0x47, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x4b, 0x69, 0x89,
+  0xa7, 0xc4, 0xc5, 0xa6, 0x88, 0x67, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x22, 0x40, 0x5e, 0x7c, 0x9d, 0xbc, 0xcd, 0xae,
+  0x92, 0x72, 0x54, 0x36, 0x18, 0x00, 0x00, 0x03, 0x23, 0x41, 0x5e, 0x72,
+  0x84, 0x94, 0xa3, 0xb4, 0xbc, 0xc0, 0xd1, 0xca, 0xbd, 0xbe, 0xae, 0x9e,
+  0x8e, 0x7c, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0xab, 0xc9, 0xae, 0x94, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x14, 0x30,
+  0x48, 0x54, 0x54, 0x54, 0x54, 0x48, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c,
+  0x7a, 0x9c, 0xbc, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x36, 0x17, 0x00, 0x00,
+  0x00, 0x0a, 0x23, 0x37, 0x40, 0x41, 0x41, 0x41, 0x3f, 0x35, 0x40, 0x41,
+  0x41, 0x41, 0x3f, 0x33, 0x1d, 0x03, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4d,
+  0x5c, 0x5c, 0x5c, 0x74, 0x95, 0xb4, 0xcd, 0xae, 0x90, 0x6e, 0x5c, 0x5c,
+  0x75, 0x97, 0xb5, 0xcc, 0xac, 0x8e, 0x6c, 0x5c, 0x5c, 0x5c, 0x57, 0x41,
+  0x25, 0x07, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x41, 0x41, 0x41, 0x41, 0x3f, 0x3d, 0x38, 0x31,
+  0x30, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x4f, 0x6c,
+  0x89, 0x9f, 0xad, 0xb0, 0xac, 0xac, 0xb0, 0xae, 0xa0, 0x89, 0x75, 0x94,
+  0xae, 0xc0, 0xa5, 0x89, 0x6b, 0x5d, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5b,
+  0x50, 0x40, 0x2c, 0x15, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x3f, 0x59,
+  0x72, 0x89, 0x99, 0xaa, 0xb8, 0xa3, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x99, 0xae, 0xcb, 0xd7, 0xb9, 0x9f, 0x98, 0x98, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x0a, 0x23, 0x37, 0x40, 0x41, 0x41, 0x41, 0x3f, 0x31,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x54, 0x73, 0x94, 0xb1, 0xcf,
+  0xbd, 0x9e, 0x7c, 0x5f, 0x40, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x38, 0x57, 0x74, 0x95, 0xb4, 0xd3, 0xba, 0x9c, 0x7c,
+  0x5d, 0x3f, 0x1f, 0x01, 0x00, 0x05, 0x24, 0x44, 0x63, 0x84, 0x9d, 0xae,
+  0xbb, 0xab, 0x9d, 0xa5, 0xbe, 0xb4, 0x9e, 0xa0, 0xb0, 0xbb, 0xaa, 0x95,
+  0x77, 0x5b, 0x3c, 0x1c, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x88, 0xa8, 0xc7, 0xac, 0x8c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6b, 0x54, 0x36, 0x17, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x2d, 0x34,
+  0x35, 0x35, 0x34, 0x2d, 0x1b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x99,
+  0xb8, 0xd3, 0xb4, 0x94, 0x72, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x1a, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x19, 0x20, 0x21, 0x21, 0x21,
+  0x20, 0x17, 0x07, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2c, 0x34, 0x3c, 0x3d,
+  0x5c, 0x7a, 0x9c, 0xbb, 0xc6, 0xa8, 0x88, 0x68, 0x49, 0x5d, 0x7c, 0x9d,
+  0xbc, 0xc5, 0xa7, 0x88, 0x67, 0x48, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc8, 0xa8, 0x8b,
+  0x6c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5d, 0x5c, 0x58, 0x4e, 0x42, 0x31,
+  0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x40, 0x5b, 0x72, 0x86,
+  0x90, 0x94, 0x94, 0x94, 0x94, 0x90, 0x86, 0x72, 0x88, 0xa2, 0xbe, 0xb0,
+  0x95, 0x77, 0x70, 0x7c, 0x84, 0x84, 0x84, 0x84, 0x84, 0x78, 0x6c, 0x59,
+  0x42, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x37, 0x4d, 0x62, 0x73,
+  0x84, 0xa0, 0xc0, 0xc0, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc4,
+  0xdb, 0xe4, 0xcc, 0xbb, 0xb8, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x0b, 0x1a, 0x21, 0x21, 0x21, 0x21, 0x1f, 0x16, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x3d, 0x5c, 0x7c, 0x9c, 0xba, 0xd6, 0xb7, 0x98,
+  0x75, 0x58, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x30, 0x4f, 0x6c, 0x90, 0xae, 0xcd, 0xc3, 0xa4, 0x86, 0x64, 0x46,
+  0x27, 0x09, 0x00, 0x00, 0x1c, 0x39, 0x54, 0x6f, 0x8d, 0xa8, 0x9f, 0x90,
+  0x7c, 0x98, 0xb8, 0xac, 0x8c, 0x84, 0x94, 0xa3, 0xa0, 0x86, 0x67, 0x4c,
+  0x32, 0x15, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x64, 0x88, 0xa8, 0xc7, 0xac, 0x8c, 0x68, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x15, 0x15, 0x15,
+  0x15, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb7, 0xcf,
+  0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x34, 0x49, 0x50, 0x50, 0x50, 0x63, 0x84,
+  0xa3, 0xc1, 0xc0, 0xa1, 0x84, 0x60, 0x50, 0x64, 0x86, 0xa4, 0xc3, 0xbf,
+  0xa0, 0x7c, 0x60, 0x50, 0x50, 0x49, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x30, 0x4f, 0x6c, 0x90, 0xae, 0xcd, 0xd0, 0xb4, 0x9c, 0x88, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x7c, 0x7c, 0x75, 0x6c, 0x5d, 0x4b, 0x34, 0x1c,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x45, 0x58, 0x65, 0x6e, 0x70,
+  0x70, 0x70, 0x70, 0x6e, 0x67, 0x78, 0x97, 0xb2, 0xbd, 0xa2, 0x86, 0x75,
+  0x8d, 0x9c, 0xa4, 0xa4, 0xa4, 0xa4, 0xa2, 0x99, 0x89, 0x6e, 0x54, 0x37,
+  0x1a, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4a, 0x63, 0x7a, 0x91, 0x9e, 0xb0,
+  0xc9, 0xbe, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc8, 0xdd, 0xe6,
+  0xcf, 0xbf, 0xbc, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xc1, 0xd0, 0xb1, 0x94, 0x70, 0x52,
+  0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a,
+  0x49, 0x68, 0x89, 0xa8, 0xc8, 0xca, 0xac, 0x8d, 0x6c, 0x4c, 0x2d, 0x0e,
+  0x00, 0x00, 0x0e, 0x29, 0x44, 0x60, 0x7a, 0x94, 0x84, 0x72, 0x74, 0x98,
+  0xb8, 0xac, 0x8c, 0x68, 0x77, 0x89, 0x90, 0x72, 0x57, 0x3d, 0x21, 0x06,
+  0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x44, 0x64, 0x88,
+  0xa8, 0xc7, 0xac, 0x8c, 0x68, 0x48, 0x2d, 0x2d, 0x2d, 0x2c, 0x24, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x33, 0x52, 0x70, 0x94, 0xb4, 0xcd, 0xae, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x23, 0x42, 0x60, 0x70, 0x70, 0x70, 0x70, 0x8b, 0xa8, 0xc8,
+  0xb9, 0x9b, 0x78, 0x70, 0x70, 0x70, 0x8c, 0xab, 0xc9, 0xb8, 0x99, 0x78,
+  0x70, 0x70, 0x70, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x2a,
+  0x49, 0x67, 0x88, 0xa5, 0xc2, 0xdb, 0xc9, 0xb3, 0xa5, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa0, 0x9d, 0x97, 0x8b, 0x77, 0x61, 0x48, 0x2d, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x2c, 0x3d, 0x47, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x52, 0x6e, 0x8b, 0xa7, 0xc2, 0xae, 0x92, 0x75, 0x88, 0xa2, 0xb8,
+  0xa8, 0x9c, 0x9c, 0x9d, 0xad, 0xb4, 0x9c, 0x7c, 0x60, 0x42, 0x23, 0x04,
+  0x00, 0x01, 0x1f, 0x3d, 0x59, 0x75, 0x91, 0xaa, 0xbc, 0xc3, 0xad, 0xa0,
+  0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0xb0, 0xcd, 0xd8, 0xbb, 0xa2,
+  0x9c, 0x9c, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a,
+  0x49, 0x68, 0x8b, 0xa8, 0xc8, 0xcc, 0xac, 0x8e, 0x6c, 0x4c, 0x2d, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x84, 0xa4, 0xc3, 0xd0, 0xb1, 0x94, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00,
+  0x00, 0x19, 0x34, 0x50, 0x6b, 0x75, 0x65, 0x57, 0x74, 0x98, 0xb8, 0xac,
+  0x8c, 0x68, 0x5b, 0x6b, 0x78, 0x62, 0x47, 0x2c, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc0,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x0d, 0x0d, 0x0d, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x30, 0x50, 0x6e, 0x90, 0xb0, 0xb8, 0xac, 0x8c, 0x68, 0x49,
+  0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0x94, 0x94, 0x94, 0x99, 0xb2, 0xcf, 0xbb, 0x9f,
+  0x94, 0x94, 0x94, 0x94, 0x99, 0xb4, 0xd0, 0xbb, 0x9f, 0x94, 0x94, 0x94,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x02, 0x21, 0x3f, 0x5d,
+  0x78, 0x96, 0xae, 0xc0, 0xca, 0xce, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc0, 0xbc, 0xb4, 0xa5, 0x90, 0x73, 0x58, 0x3c, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x1f, 0x29, 0x30, 0x31, 0x31, 0x31, 0x47, 0x62,
+  0x7c, 0x9b, 0xb6, 0xbb, 0x9e, 0x84, 0x70, 0x90, 0xb0, 0xad, 0x91, 0x7a,
+  0x78, 0x7c, 0x97, 0xb5, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x0a,
+  0x28, 0x47, 0x65, 0x86, 0xa2, 0xbe, 0xce, 0xb2, 0x96, 0x84, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x78, 0x78,
+  0x78, 0x63, 0x44, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4c, 0x6c,
+  0x90, 0xae, 0xcd, 0xca, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x41, 0x60, 0x84, 0xa1,
+  0xc0, 0xd6, 0xb7, 0x98, 0x74, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x09,
+  0x24, 0x3f, 0x54, 0x58, 0x4b, 0x54, 0x74, 0x98, 0x9c, 0x9c, 0x8c, 0x68,
+  0x48, 0x4e, 0x58, 0x4d, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa0, 0xa0, 0xa0, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x2d, 0x4c, 0x6c, 0x8e, 0x98, 0x98, 0x98, 0x88, 0x67, 0x48, 0x28, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44,
+  0x64, 0x88, 0xa8, 0xb4, 0xb4, 0xb6, 0xc6, 0xde, 0xcc, 0xb9, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb6, 0xc6, 0xdf, 0xcc, 0xb9, 0xb4, 0xb4, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x16, 0x32, 0x4e, 0x67, 0x84,
+  0x95, 0xa2, 0xac, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xbe,
+  0xd0, 0xbc, 0xa0, 0x84, 0x64, 0x46, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x0a, 0x11, 0x11, 0x1f, 0x3b, 0x56, 0x72, 0x8e, 0xab,
+  0xc5, 0xab, 0x8e, 0x72, 0x70, 0x94, 0xb4, 0xac, 0x8c, 0x68, 0x58, 0x70,
+  0x94, 0xb4, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x10, 0x30, 0x4f,
+  0x6c, 0x8e, 0xac, 0xcb, 0xc7, 0xa8, 0x88, 0x69, 0x58, 0x58, 0x58, 0x58,
+  0x58, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x58, 0x58, 0x50,
+  0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb1,
+  0xd0, 0xc7, 0xa8, 0x88, 0x64, 0x46, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xda,
+  0xbb, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x12, 0x28,
+  0x36, 0x38, 0x34, 0x53, 0x6f, 0x78, 0x78, 0x78, 0x78, 0x67, 0x48, 0x32,
+  0x39, 0x32, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x47,
+  0x65, 0x74, 0x74, 0x74, 0x74, 0x74, 0x62, 0x43, 0x25, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0xa8, 0xb8, 0xb9, 0xc7, 0xde, 0xd1, 0xbe, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9,
+  0xc7, 0xde, 0xd1, 0xbe, 0xb8, 0xb8, 0xb8, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x3c, 0x53, 0x67, 0x77, 0x84,
+  0x8c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0xab, 0xc9, 0xca,
+  0xac, 0x8e, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x2e, 0x4b, 0x65, 0x84, 0x9e, 0xbb, 0xb7, 0x9b,
+  0x7c, 0x62, 0x70, 0x94, 0xb4, 0xac, 0x8c, 0x68, 0x50, 0x70, 0x94, 0xb4,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x39, 0x39, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x39, 0x33, 0x23, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x17, 0x19,
+  0x29, 0x42, 0x55, 0x58, 0x58, 0x58, 0x58, 0x52, 0x3c, 0x20, 0x19, 0x14,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x3b, 0x53, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x55, 0x3e, 0x22, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x67, 0x52, 0x35, 0x16, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x98, 0x98,
+  0x9b, 0xb2, 0xcf, 0xc0, 0xa5, 0x98, 0x98, 0x98, 0x98, 0x9b, 0xb2, 0xcf,
+  0xbe, 0xa5, 0x98, 0x98, 0x98, 0x98, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3b, 0x4c, 0x5a, 0x64, 0x6b, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x88, 0xa8, 0xc7, 0xd1, 0xb2, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x23, 0x3e, 0x5b, 0x75, 0x94, 0xae, 0xc3, 0xa7, 0x8b, 0x6e, 0x52,
+  0x70, 0x94, 0xb4, 0xac, 0x8c, 0x68, 0x50, 0x70, 0x94, 0xb4, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc7, 0xa8, 0x88, 0x65, 0x54, 0x54, 0x55, 0x58, 0x58, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x15, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2a,
+  0x37, 0x39, 0x39, 0x39, 0x39, 0x35, 0x25, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x26,
+  0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x24, 0x43, 0x62, 0x74, 0x74, 0x74, 0x8d, 0xac,
+  0xcc, 0xb7, 0x98, 0x77, 0x74, 0x74, 0x74, 0x8e, 0xac, 0xcc, 0xb5, 0x97,
+  0x75, 0x74, 0x74, 0x74, 0x74, 0x62, 0x43, 0x24, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x15, 0x22, 0x25, 0x30, 0x3c, 0x46, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x33,
+  0x4e, 0x6a, 0x88, 0xa2, 0xbe, 0xb4, 0x97, 0x7a, 0x5e, 0x50, 0x70, 0x94,
+  0xb4, 0xac, 0x8c, 0x68, 0x50, 0x70, 0x94, 0xb4, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x11, 0x31, 0x50, 0x70, 0x92, 0xb0, 0xd0, 0xcb, 0xae,
+  0x94, 0x7c, 0x74, 0x74, 0x74, 0x78, 0x78, 0x78, 0x88, 0xa8, 0xc7, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x18, 0x19,
+  0x19, 0x19, 0x19, 0x16, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x19, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xac, 0xac, 0xac, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x36, 0x4c, 0x54, 0x54, 0x72, 0x94, 0xb2, 0xcf, 0xb0,
+  0x92, 0x70, 0x54, 0x54, 0x74, 0x94, 0xb4, 0xce, 0xb0, 0x90, 0x70, 0x54,
+  0x54, 0x54, 0x54, 0x4c, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x2f, 0x40, 0x44, 0x44, 0x41, 0x40, 0x3d, 0x3d, 0x39, 0x39, 0x39, 0x36,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x42, 0x5e, 0x78,
+  0x97, 0xb2, 0xc0, 0xa3, 0x89, 0x6b, 0x50, 0x50, 0x70, 0x94, 0xb4, 0xac,
+  0x8c, 0x69, 0x60, 0x70, 0x94, 0xb4, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x8c, 0xa9, 0xc8, 0xd9, 0xc1, 0xaa, 0x9c,
+  0x98, 0x98, 0x98, 0x9c, 0x9c, 0x9c, 0x9e, 0xb3, 0xce, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb1, 0xd0, 0xc7, 0xa8, 0x88, 0x64, 0x46, 0x27, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xda, 0xbb, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcb, 0xbc, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x20, 0x30, 0x3b, 0x5a, 0x78, 0x99, 0xb8, 0xc8, 0xa9, 0x8c, 0x69,
+  0x4b, 0x5b, 0x78, 0x9c, 0xba, 0xc8, 0xa8, 0x8b, 0x68, 0x4a, 0x35, 0x35,
+  0x35, 0x30, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x42, 0x5b,
+  0x64, 0x64, 0x60, 0x60, 0x5c, 0x5c, 0x58, 0x58, 0x58, 0x54, 0x54, 0x65,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x52, 0x6e, 0x8b, 0xa7, 0xc2,
+  0xb0, 0x95, 0x77, 0x5b, 0x40, 0x4f, 0x6c, 0x8e, 0xac, 0xb2, 0x96, 0x88,
+  0x84, 0x89, 0x9d, 0xb9, 0xa5, 0x88, 0x65, 0x47, 0x28, 0x08, 0x00, 0x07,
+  0x25, 0x44, 0x62, 0x84, 0x9d, 0xb7, 0xca, 0xd4, 0xc5, 0xba, 0xb8, 0xb8,
+  0xb8, 0xbb, 0xbc, 0xbc, 0xbd, 0xca, 0xcc, 0xcb, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4c, 0x6c,
+  0x90, 0xae, 0xcd, 0xca, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x41, 0x60, 0x84, 0xa1,
+  0xc0, 0xd6, 0xb7, 0x98, 0x74, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x23, 0x41, 0x60, 0x84, 0xa0, 0xb0, 0xb0, 0xa3, 0x84, 0x64, 0x44, 0x62,
+  0x84, 0xa2, 0xb0, 0xb0, 0xa2, 0x84, 0x62, 0x43, 0x24, 0x15, 0x15, 0x11,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x84,
+  0x84, 0x7c, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x74, 0x74, 0x7c, 0x94, 0xae,
+  0xcb, 0xd0, 0xb0, 0x92, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x2b, 0x47, 0x62, 0x7c, 0x9b, 0xb0, 0xb0, 0xa2, 0x86,
+  0x67, 0x4c, 0x30, 0x46, 0x63, 0x84, 0x9c, 0xb0, 0xb0, 0xa6, 0xa4, 0xa8,
+  0xb4, 0xac, 0x96, 0x7a, 0x5d, 0x3f, 0x21, 0x02, 0x00, 0x00, 0x1c, 0x39,
+  0x54, 0x6f, 0x8b, 0x9e, 0xac, 0xb4, 0xb8, 0xbc, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb4, 0xb4, 0xb2, 0xb0, 0xad, 0xac, 0xa8, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x68, 0x8b, 0xa8,
+  0xc8, 0xcc, 0xac, 0x8e, 0x6c, 0x4c, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa4, 0xc3, 0xd0,
+  0xb1, 0x94, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x88, 0x90, 0x90, 0x90, 0x90, 0x7c, 0x5c, 0x48, 0x68, 0x89, 0x90,
+  0x90, 0x90, 0x90, 0x7a, 0x5c, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa4, 0xa4, 0xa0,
+  0xa0, 0x9e, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x9c, 0xa9, 0xbf, 0xd9, 0xc8,
+  0xa9, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x34, 0x54, 0x72, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x73, 0x59, 0x3d,
+  0x21, 0x39, 0x55, 0x6c, 0x86, 0x94, 0x98, 0x9c, 0x9c, 0x9c, 0x98, 0x90,
+  0x7c, 0x67, 0x4e, 0x34, 0x17, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x43, 0x5b,
+  0x70, 0x84, 0x90, 0x95, 0x98, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x94, 0x94,
+  0x94, 0x90, 0x90, 0x8c, 0x89, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x25, 0x44, 0x64, 0x84, 0xa3, 0xc1, 0xd0,
+  0xb1, 0x94, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x2a, 0x49, 0x68, 0x89, 0xa8, 0xc8, 0xca, 0xac, 0x8d,
+  0x6c, 0x4c, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x45, 0x61, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6b, 0x54, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xc3, 0xc0, 0xc0, 0xbd,
+  0xbc, 0xbc, 0xba, 0xb8, 0xb8, 0xba, 0xc5, 0xd4, 0xcb, 0xb8, 0x9e, 0x84,
+  0x62, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32,
+  0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x64, 0x49, 0x2d, 0x12, 0x29,
+  0x3f, 0x56, 0x67, 0x72, 0x75, 0x78, 0x78, 0x78, 0x74, 0x70, 0x63, 0x50,
+  0x3a, 0x22, 0x08, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2f, 0x44, 0x56, 0x64,
+  0x6e, 0x74, 0x75, 0x78, 0x74, 0x74, 0x74, 0x74, 0x74, 0x70, 0x70, 0x6c,
+  0x6c, 0x68, 0x68, 0x64, 0x60, 0x49, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0x3d, 0x5c, 0x7c, 0x9c, 0xba, 0xd6, 0xb7, 0x98,
+  0x75, 0x58, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x30, 0x4f, 0x6c, 0x90, 0xae, 0xcd, 0xc3, 0xa4, 0x86, 0x64, 0x46,
+  0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x34, 0x47, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x3f, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xa8, 0xac, 0xac, 0xb0, 0xb1, 0xb4, 0xb7,
+  0xc9, 0xd1, 0xc0, 0xbc, 0xb8, 0xb5, 0xad, 0x9f, 0x8b, 0x70, 0x55, 0x39,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x49, 0x37, 0x1e, 0x02, 0x13, 0x29, 0x3d,
+  0x4b, 0x54, 0x58, 0x58, 0x58, 0x58, 0x55, 0x52, 0x47, 0x38, 0x23, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 0x2a, 0x3b, 0x47, 0x50, 0x54,
+  0x58, 0x58, 0x57, 0x54, 0x54, 0x54, 0x54, 0x50, 0x50, 0x4c, 0x4c, 0x48,
+  0x48, 0x44, 0x42, 0x34, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x36, 0x54, 0x73, 0x94, 0xb1, 0xcf, 0xbd, 0x9e, 0x7c, 0x5f,
+  0x40, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38,
+  0x57, 0x74, 0x95, 0xb4, 0xd3, 0xba, 0x9c, 0x7c, 0x5d, 0x3f, 0x1f, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2c, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2c, 0x24, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x24, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x88, 0x88, 0x8c, 0x8e, 0x90, 0x94, 0x94, 0x9c, 0xb7, 0xbe,
+  0xa5, 0x9c, 0x98, 0x97, 0x90, 0x84, 0x72, 0x5b, 0x44, 0x2a, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2a, 0x1e, 0x0a, 0x00, 0x00, 0x11, 0x20, 0x2d, 0x34,
+  0x38, 0x39, 0x39, 0x39, 0x37, 0x33, 0x2b, 0x1d, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1e, 0x29, 0x30, 0x35, 0x38, 0x39,
+  0x38, 0x35, 0x35, 0x35, 0x35, 0x31, 0x31, 0x2e, 0x2d, 0x29, 0x29, 0x25,
+  0x23, 0x19, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x2d, 0x4b, 0x69, 0x89, 0xa7, 0xc4, 0xc5, 0xa6, 0x88, 0x67, 0x49, 0x2b,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x40, 0x5e, 0x7c,
+  0x9d, 0xbc, 0xcc, 0xae, 0x92, 0x72, 0x54, 0x36, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06,
+  0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x40, 0x59,
+  0x64, 0x67, 0x68, 0x6c, 0x6c, 0x70, 0x72, 0x94, 0xb4, 0xb8, 0x98, 0x78,
+  0x75, 0x74, 0x6e, 0x65, 0x57, 0x45, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0e, 0x15, 0x19, 0x19,
+  0x19, 0x19, 0x18, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x15, 0x19, 0x19, 0x18, 0x15,
+  0x15, 0x15, 0x15, 0x11, 0x11, 0x0f, 0x0d, 0x0a, 0x09, 0x05, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x41,
+  0x5e, 0x7c, 0x9c, 0xb9, 0xcd, 0xae, 0x90, 0x70, 0x53, 0x35, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x4a, 0x68, 0x88, 0xa6, 0xc4,
+  0xc0, 0xa3, 0x86, 0x67, 0x49, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2c, 0x3e, 0x44, 0x48,
+  0x48, 0x4c, 0x4c, 0x57, 0x74, 0x98, 0xb8, 0xb8, 0x9b, 0x78, 0x58, 0x54,
+  0x50, 0x47, 0x3b, 0x2b, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x36, 0x54, 0x70,
+  0x8e, 0xab, 0xc7, 0xb9, 0x9b, 0x7a, 0x5d, 0x40, 0x23, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x38, 0x55, 0x73, 0x92, 0xb0, 0xce, 0xb4, 0x97,
+  0x77, 0x5b, 0x3d, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x25, 0x28, 0x29, 0x2d,
+  0x39, 0x58, 0x78, 0x98, 0x98, 0x98, 0x98, 0x78, 0x5b, 0x3c, 0x31, 0x29,
+  0x1e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x45, 0x62, 0x7c, 0x9d,
+  0xb7, 0xc3, 0xa5, 0x89, 0x69, 0x4c, 0x30, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x28, 0x45, 0x62, 0x7c, 0x9e, 0xbb, 0xc0, 0xa3, 0x89, 0x6b, 0x4e,
+  0x31, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0a, 0x18, 0x38, 0x57,
+  0x72, 0x74, 0x74, 0x74, 0x74, 0x72, 0x59, 0x3b, 0x1c, 0x0a, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x54, 0x6f, 0x8d, 0xa8, 0xc2,
+  0xb2, 0x95, 0x77, 0x5b, 0x3e, 0x23, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x37,
+  0x54, 0x6e, 0x8e, 0xab, 0xc7, 0xae, 0x94, 0x77, 0x5b, 0x40, 0x24, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2c, 0x45, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x45, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x29, 0x44, 0x60, 0x7a, 0x96, 0xb0, 0xc0, 0xa3,
+  0x88, 0x6a, 0x4e, 0x34, 0x17, 0x00, 0x00, 0x10, 0x2c, 0x47, 0x62, 0x7c,
+  0x9c, 0xb7, 0xb6, 0x9d, 0x84, 0x67, 0x4c, 0x30, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2b, 0x34, 0x35, 0x35, 0x35,
+  0x35, 0x34, 0x2b, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x34, 0x4e, 0x67, 0x84, 0x9c, 0xb5, 0xb2, 0x97, 0x7a,
+  0x5e, 0x3f, 0x20, 0x00, 0x00, 0x18, 0x38, 0x57, 0x72, 0x90, 0xab, 0xbb,
+  0xa2, 0x8b, 0x6f, 0x55, 0x3b, 0x20, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x22, 0x3c, 0x55, 0x6c, 0x89, 0x9f, 0xa2, 0x8e, 0x77, 0x5e, 0x3f,
+  0x20, 0x00, 0x00, 0x18, 0x38, 0x57, 0x72, 0x89, 0x9c, 0xa7, 0x8e, 0x75,
+  0x5b, 0x42, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x29, 0x41, 0x59, 0x6f, 0x89, 0x89, 0x72, 0x5e, 0x4b, 0x33, 0x17, 0x00,
+  0x00, 0x10, 0x2c, 0x45, 0x59, 0x6c, 0x84, 0x91, 0x77, 0x5e, 0x48, 0x2f,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c,
+  0x43, 0x5b, 0x6f, 0x6f, 0x5b, 0x47, 0x32, 0x1e, 0x07, 0x00, 0x00, 0x00,
+  0x18, 0x2c, 0x41, 0x56, 0x6a, 0x77, 0x61, 0x4b, 0x33, 0x1b, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2f, 0x42,
+  0x53, 0x53, 0x42, 0x2f, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x29, 0x3d, 0x50, 0x58, 0x4b, 0x34, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x29, 0x34, 0x34,
+  0x29, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23,
+  0x33, 0x38, 0x30, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x14, 0x14, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x19,
+  0x13, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x05, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x09,
+  0x09, 0x09, 0x09, 0x05, 0x05, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d,
+  0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x18,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x15, 0x1f, 0x24, 0x28, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x25, 0x21, 0x19, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x15,
+  0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x15, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x17, 0x0f, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x18, 0x1f, 0x25, 0x29, 0x29, 0x29,
+  0x28, 0x25, 0x25, 0x23, 0x21, 0x1f, 0x1d, 0x19, 0x16, 0x12, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x19, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x14, 0x1e, 0x24, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x25, 0x20, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x14, 0x1e, 0x24, 0x28, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x25, 0x20, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x42, 0x2f, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x23, 0x35, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x16, 0x25, 0x33, 0x3d, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x44, 0x3f, 0x37, 0x2b, 0x1c, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x19, 0x27, 0x33, 0x3c, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x29, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3a, 0x34, 0x2b, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x36, 0x2d, 0x20, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x29, 0x38, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x34,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x19, 0x29, 0x35, 0x3f, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44,
+  0x44, 0x42, 0x41, 0x3d, 0x3c, 0x39, 0x35, 0x31, 0x22, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x26, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35,
+  0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x24, 0x32, 0x3c,
+  0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x3f,
+  0x36, 0x29, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x24, 0x32, 0x3c, 0x43, 0x47, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x44, 0x3f, 0x36, 0x29, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x5b, 0x40, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x37, 0x50, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x57, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x30,
+  0x42, 0x50, 0x5b, 0x63, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x64, 0x5e, 0x55, 0x47, 0x36, 0x21, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x11, 0x1e, 0x2b, 0x37, 0x44, 0x50, 0x5b, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x57, 0x41, 0x25, 0x07, 0x00, 0x00, 0x04, 0x22, 0x3e, 0x55,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x58, 0x53, 0x49, 0x3b, 0x29, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29,
+  0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5a, 0x54, 0x4b, 0x3d, 0x2c, 0x18, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3e, 0x55,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x57, 0x41, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1b,
+  0x31, 0x44, 0x53, 0x5d, 0x64, 0x68, 0x68, 0x68, 0x67, 0x64, 0x64, 0x60,
+  0x60, 0x5c, 0x5c, 0x58, 0x54, 0x4e, 0x39, 0x1e, 0x01, 0x00, 0x00, 0x00,
+  0x1e, 0x3b, 0x53, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x40, 0x4e, 0x5a, 0x63, 0x67,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5e, 0x54, 0x45,
+  0x33, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x3f,
+  0x4e, 0x5a, 0x62, 0x65, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x64, 0x5e, 0x54, 0x45, 0x34, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x27, 0x44, 0x60, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x16, 0x30, 0x48, 0x5b, 0x6c,
+  0x78, 0x84, 0x88, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x88,
+  0x7c, 0x72, 0x62, 0x4d, 0x37, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x0d, 0x20,
+  0x2e, 0x3b, 0x47, 0x54, 0x60, 0x6c, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x70,
+  0x65, 0x55, 0x42, 0x2c, 0x12, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x78, 0x73, 0x67, 0x58, 0x45, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x33, 0x4e, 0x6a, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x19, 0x31, 0x48, 0x5e,
+  0x70, 0x7c, 0x86, 0x89, 0x8c, 0x8c, 0x88, 0x88, 0x88, 0x84, 0x84, 0x7c,
+  0x7a, 0x78, 0x74, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00, 0x05, 0x25, 0x44,
+  0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x11, 0x2b, 0x42, 0x59, 0x6b, 0x78, 0x84, 0x88, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x86, 0x7c, 0x70, 0x5e, 0x4b, 0x34,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x42, 0x59, 0x6b, 0x78,
+  0x84, 0x88, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x86, 0x7c,
+  0x70, 0x60, 0x4b, 0x34, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac, 0xac, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0x33, 0x50, 0x6c, 0x8d, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x64, 0x47,
+  0x29, 0x0a, 0x00, 0x00, 0x09, 0x25, 0x42, 0x5b, 0x75, 0x8b, 0x99, 0xa3,
+  0xa8, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xa8, 0xa5, 0x9d, 0x90,
+  0x7a, 0x64, 0x4b, 0x2e, 0x12, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4b, 0x58,
+  0x64, 0x70, 0x7c, 0x8d, 0x99, 0xa0, 0xa0, 0xa0, 0xa0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x99, 0x90, 0x84, 0x6f,
+  0x58, 0x3f, 0x24, 0x07, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x94,
+  0x86, 0x72, 0x5b, 0x42, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0b, 0x27, 0x42, 0x5e, 0x78, 0x97, 0xa0, 0xa0, 0xa0,
+  0xa0, 0x92, 0x75, 0x59, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x29, 0x44, 0x5e, 0x75, 0x8d, 0x9b,
+  0xa4, 0xa8, 0xac, 0xac, 0xa8, 0xa8, 0xa8, 0xa4, 0xa3, 0xa0, 0x9c, 0x9b,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x04,
+  0x20, 0x3d, 0x57, 0x6f, 0x89, 0x97, 0xa2, 0xa8, 0xac, 0xac, 0xac, 0xac,
+  0xac, 0xac, 0xac, 0xa8, 0xa4, 0x9c, 0x8e, 0x77, 0x60, 0x45, 0x29, 0x0d,
+  0x00, 0x00, 0x00, 0x03, 0x20, 0x3c, 0x56, 0x6f, 0x88, 0x97, 0xa2, 0xa8,
+  0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xa8, 0xa4, 0x9c, 0x8e, 0x77,
+  0x61, 0x47, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x40,
+  0x5d, 0x78, 0x99, 0xb5, 0xc0, 0xb2, 0x94, 0x75, 0x58, 0x3b, 0x1e, 0x00,
+  0x00, 0x00, 0x15, 0x33, 0x50, 0x6c, 0x8b, 0xa3, 0xb5, 0xc1, 0xc7, 0xcb,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xca, 0xc8, 0xc4, 0xbb, 0xaa, 0x94, 0x75,
+  0x59, 0x3d, 0x1f, 0x01, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x75, 0x84, 0x90,
+  0x9d, 0xa9, 0xb5, 0xc0, 0xc0, 0xc0, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbe, 0xb8, 0xae, 0x9d, 0x86, 0x6b, 0x4e,
+  0x32, 0x14, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xba, 0xb0, 0xa0, 0x8b,
+  0x6e, 0x52, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x37, 0x52, 0x6e, 0x8b, 0xa7, 0xc0, 0xc0, 0xb9, 0x9e, 0x84,
+  0x65, 0x49, 0x2e, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x18, 0x35, 0x53, 0x70, 0x8d, 0xa5, 0xb8, 0xc3, 0xc8,
+  0xcb, 0xc7, 0xc7, 0xc7, 0xc6, 0xc3, 0xc1, 0xc0, 0xbc, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x0f, 0x2d, 0x4b,
+  0x67, 0x86, 0x9f, 0xb4, 0xc0, 0xc7, 0xcb, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xcb, 0xc8, 0xc4, 0xb9, 0xa7, 0x8e, 0x70, 0x54, 0x37, 0x19, 0x00, 0x00,
+  0x00, 0x0e, 0x2c, 0x4a, 0x67, 0x84, 0x9e, 0xb3, 0xc0, 0xc7, 0xcb, 0xc8,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xcb, 0xc8, 0xc4, 0xb9, 0xa7, 0x8e, 0x72, 0x55,
+  0x37, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb0, 0xb0, 0xb0, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4c, 0x69, 0x88,
+  0xa5, 0xc2, 0xc3, 0xa5, 0x88, 0x69, 0x4c, 0x2e, 0x11, 0x00, 0x00, 0x00,
+  0x1f, 0x3d, 0x5b, 0x78, 0x99, 0xb5, 0xcf, 0xd4, 0xbe, 0xae, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa8, 0xac, 0xb7, 0xcc, 0xd6, 0xbe, 0xa2, 0x86, 0x65, 0x47,
+  0x28, 0x0a, 0x00, 0x10, 0x30, 0x4f, 0x6c, 0x8d, 0xa0, 0xac, 0xb9, 0xc5,
+  0xc5, 0xd0, 0xdf, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb7, 0xc4, 0xd7, 0xc9, 0xb3, 0x97, 0x78, 0x5a, 0x3c, 0x1e,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb7, 0xc4, 0xd9, 0xcc, 0xb6, 0x9b, 0x7c, 0x5e,
+  0x40, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b,
+  0x47, 0x62, 0x7c, 0x9b, 0xb6, 0xd2, 0xc5, 0xa9, 0x8e, 0x70, 0x55, 0x39,
+  0x1e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xcf, 0xbb, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x01, 0x1f, 0x3f, 0x5d, 0x7c, 0x9b, 0xb8, 0xd1, 0xd1, 0xbc, 0xad, 0xa8,
+  0xa8, 0xa8, 0xab, 0xac, 0xb0, 0xb0, 0xb4, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xd5, 0xdf, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x94,
+  0xb0, 0xcb, 0xda, 0xc4, 0xb4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xae, 0xbe,
+  0xd4, 0xd3, 0xb9, 0x9d, 0x7c, 0x5e, 0x3f, 0x21, 0x02, 0x00, 0x00, 0x16,
+  0x35, 0x54, 0x72, 0x92, 0xb0, 0xca, 0xdd, 0xc6, 0xb4, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xae, 0xbd, 0xd1, 0xd4, 0xbb, 0x9d, 0x7c, 0x60, 0x41, 0x23,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x3b, 0x59, 0x75, 0x94, 0xb2, 0xce,
+  0xb7, 0x99, 0x7a, 0x5d, 0x40, 0x22, 0x05, 0x00, 0x00, 0x05, 0x24, 0x44,
+  0x63, 0x84, 0xa3, 0xc1, 0xdc, 0xc0, 0xa7, 0x92, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x8d, 0x9f, 0xb7, 0xd3, 0xcb, 0xac, 0x8e, 0x6c, 0x4c, 0x2e, 0x0f,
+  0x00, 0x09, 0x27, 0x44, 0x60, 0x7c, 0x9d, 0xba, 0xb1, 0xa6, 0xa6, 0xb8,
+  0xd3, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x99, 0xad, 0xc4, 0xde, 0xc0, 0xa2, 0x84, 0x64, 0x44, 0x25, 0x06, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x99, 0xad, 0xc4, 0xde, 0xc4, 0xa6, 0x88, 0x65, 0x47, 0x28,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x3b, 0x56, 0x72,
+  0x8e, 0xab, 0xc5, 0xd0, 0xb5, 0x99, 0x7c, 0x61, 0x45, 0x2a, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdd, 0xbf, 0xa2, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x86, 0xa4, 0xc3, 0xdb, 0xbe, 0xa5, 0x90, 0x88, 0x88, 0x88,
+  0x8c, 0x8c, 0x90, 0x90, 0x94, 0x94, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0xa9, 0xc6, 0xe0, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x78, 0x9c, 0xbb, 0xd9,
+  0xc9, 0xad, 0x97, 0x8b, 0x88, 0x88, 0x88, 0x88, 0x92, 0xa7, 0xc0, 0xdc,
+  0xc4, 0xa5, 0x88, 0x64, 0x44, 0x25, 0x07, 0x00, 0x00, 0x1b, 0x3a, 0x58,
+  0x78, 0x9b, 0xb9, 0xd8, 0xcb, 0xb0, 0x99, 0x8b, 0x88, 0x88, 0x88, 0x88,
+  0x92, 0xa5, 0xc0, 0xdc, 0xc5, 0xa7, 0x88, 0x65, 0x47, 0x28, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x5e, 0x41, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x2b, 0x47, 0x65, 0x84, 0xa1, 0xbe, 0xc8, 0xab, 0x8d,
+  0x6e, 0x52, 0x34, 0x17, 0x00, 0x00, 0x00, 0x09, 0x28, 0x48, 0x67, 0x88,
+  0xa8, 0xc7, 0xd4, 0xb4, 0x95, 0x77, 0x67, 0x64, 0x64, 0x64, 0x64, 0x6f,
+  0x8d, 0xab, 0xc9, 0xd1, 0xb2, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x1a, 0x37, 0x54, 0x72, 0x90, 0x9d, 0x94, 0x88, 0x8d, 0xac, 0xcc, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x07, 0x26, 0x45, 0x61,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x7c, 0x97,
+  0xb5, 0xd3, 0xc8, 0xa8, 0x8b, 0x68, 0x48, 0x29, 0x09, 0x00, 0x10, 0x2f,
+  0x4e, 0x6a, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x7c, 0x97, 0xb5, 0xd3, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x4b, 0x65, 0x84, 0x9e, 0xbb,
+  0xd5, 0xc0, 0xa5, 0x8b, 0x6c, 0x52, 0x35, 0x1b, 0x09, 0x09, 0x08, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x89, 0xa8, 0xc8, 0xd2, 0xb4, 0x94, 0x75, 0x67, 0x64, 0x64, 0x68, 0x69,
+  0x6c, 0x6c, 0x70, 0x70, 0x74, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00, 0x04,
+  0x23, 0x42, 0x60, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x89, 0xa6, 0xc5, 0xd4, 0xb7, 0x99, 0x7a, 0x5d, 0x3f, 0x1f,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdd, 0xbe, 0xa0,
+  0x84, 0x6b, 0x64, 0x64, 0x64, 0x67, 0x77, 0x95, 0xb4, 0xd4, 0xc8, 0xa9,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xbe, 0xdd, 0xc0, 0xa1, 0x84, 0x6b, 0x64, 0x64, 0x64, 0x67, 0x77, 0x95,
+  0xb4, 0xd2, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x45, 0x31, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0x37, 0x54, 0x72, 0x90, 0xad, 0xcb, 0xbb, 0x9e, 0x84, 0x62, 0x45,
+  0x27, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcf, 0xb0, 0x90, 0x6e, 0x50, 0x44, 0x44, 0x44, 0x46, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x0e, 0x2b,
+  0x47, 0x64, 0x84, 0x7c, 0x73, 0x69, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x1b, 0x34, 0x49, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x52, 0x6c, 0x90, 0xb0, 0xcf,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x07, 0x23, 0x3d, 0x4e,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x52, 0x6c, 0x90,
+  0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x23, 0x3e, 0x5b, 0x75, 0x94, 0xae, 0xca, 0xcc, 0xb0,
+  0x95, 0x77, 0x5d, 0x42, 0x29, 0x29, 0x29, 0x29, 0x28, 0x1e, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb,
+  0xbc, 0x9c, 0x78, 0x58, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x4b, 0x37, 0x1e, 0x02, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4e, 0x44, 0x45, 0x48, 0x4b, 0x4c, 0x4f,
+  0x50, 0x52, 0x54, 0x4e, 0x39, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x19, 0x34,
+  0x49, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x59, 0x75,
+  0x95, 0xb2, 0xcf, 0xc8, 0xab, 0x8e, 0x6e, 0x52, 0x34, 0x17, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58,
+  0x44, 0x44, 0x44, 0x50, 0x6e, 0x90, 0xb0, 0xcf, 0xc9, 0xab, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb,
+  0xbc, 0x9c, 0x78, 0x5a, 0x44, 0x44, 0x44, 0x4e, 0x6c, 0x90, 0xb0, 0xcf,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x28,
+  0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x44,
+  0x60, 0x7c, 0x9d, 0xba, 0xcd, 0xb0, 0x92, 0x73, 0x55, 0x39, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0,
+  0x90, 0x6c, 0x4c, 0x2d, 0x25, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x1e, 0x3b, 0x56,
+  0x64, 0x5f, 0x55, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2c, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x34, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x10, 0x23, 0x2f, 0x31, 0x31,
+  0x3c, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4c, 0x6c, 0x90, 0xb0, 0xcf,
+  0xc6, 0xa8, 0x89, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x33, 0x4e, 0x6a, 0x88, 0xa2, 0xbe, 0xd8, 0xbc, 0xa2, 0x86, 0x69,
+  0x4c, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x39, 0x22, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c,
+  0x78, 0x58, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x3f, 0x34, 0x2d, 0x1f,
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x54, 0x58, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58,
+  0x4c, 0x3e, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2c, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x49, 0x65, 0x84, 0xa2, 0xbe,
+  0xd9, 0xbc, 0x9e, 0x84, 0x62, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x1d,
+  0x3c, 0x5c, 0x7a, 0x9c, 0xbb, 0xd9, 0xbc, 0x9c, 0x78, 0x58, 0x41, 0x41,
+  0x41, 0x4f, 0x6c, 0x90, 0xb0, 0xcf, 0xc4, 0xa6, 0x88, 0x64, 0x45, 0x26,
+  0x07, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c,
+  0x78, 0x58, 0x39, 0x25, 0x2d, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x50, 0x6c, 0x8d,
+  0xa9, 0xc6, 0xc0, 0xa3, 0x88, 0x67, 0x4a, 0x2d, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c,
+  0x4c, 0x2d, 0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x10, 0x29, 0x3d, 0x44, 0x41,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16,
+  0x29, 0x3c, 0x4e, 0x61, 0x72, 0x90, 0xb0, 0xcf, 0xc8, 0xa8, 0x8b, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x07, 0x10, 0x25, 0x41, 0x58, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x72, 0x92, 0xb0, 0xcd, 0xb8, 0x9d,
+  0x7c, 0x60, 0x42, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x42,
+  0x5e, 0x78, 0x97, 0xb2, 0xce, 0xc9, 0xac, 0x92, 0x73, 0x59, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x65, 0x4e, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5d, 0x50, 0x41, 0x2f, 0x18, 0x01,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x72, 0x78, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x69, 0x57,
+  0x42, 0x2b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x1b, 0x37, 0x55, 0x72, 0x90, 0xae, 0xcb, 0xcd, 0xb0,
+  0x94, 0x73, 0x57, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55,
+  0x73, 0x92, 0xad, 0xc6, 0xbd, 0x9e, 0x7c, 0x64, 0x60, 0x60, 0x60, 0x60,
+  0x75, 0x94, 0xb4, 0xcc, 0xb5, 0x9b, 0x7c, 0x5e, 0x40, 0x22, 0x03, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x58,
+  0x41, 0x41, 0x41, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x40, 0x5d, 0x78, 0x99, 0xb5, 0xd2,
+  0xb5, 0x97, 0x78, 0x5b, 0x3e, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d,
+  0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x25, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1d, 0x31, 0x42, 0x55,
+  0x67, 0x7a, 0x8e, 0xa2, 0xb9, 0xd5, 0xbc, 0xa0, 0x84, 0x62, 0x43, 0x24,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x8b, 0xa0, 0xbb, 0xb2, 0xa2, 0x8b, 0x70, 0x54,
+  0x37, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x52, 0x6e, 0x8b,
+  0xa7, 0xc2, 0xd4, 0xb9, 0x9d, 0x84, 0x64, 0x60, 0x84, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdc, 0xbd, 0x9e, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x8b, 0x86, 0x7a, 0x6c, 0x5b, 0x45, 0x2d, 0x13, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xd0, 0xb1, 0x94, 0x90, 0x94,
+  0x98, 0x9c, 0xa0, 0xa0, 0xa0, 0xa0, 0x9d, 0x95, 0x86, 0x6f, 0x57, 0x3e,
+  0x22, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x27, 0x44, 0x62, 0x7c, 0x9d, 0xbb, 0xd7, 0xc1, 0xa3, 0x88, 0x67,
+  0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x49, 0x65, 0x84,
+  0x99, 0xac, 0xbb, 0xab, 0x94, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8d, 0xa2,
+  0xbe, 0xb1, 0x9f, 0x89, 0x6e, 0x52, 0x35, 0x18, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0x9c, 0x78, 0x60, 0x60, 0x60,
+  0x60, 0x64, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x2e, 0x4c, 0x69, 0x88, 0xa5, 0xc2, 0xc5, 0xa8, 0x8b,
+  0x6c, 0x4f, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x37, 0x4a, 0x5d, 0x6f, 0x84, 0x96,
+  0xa8, 0xbb, 0xcf, 0xc1, 0xaa, 0x90, 0x73, 0x57, 0x3a, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x90, 0xa4, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa7, 0xb7, 0xb0, 0x96, 0x88, 0x72, 0x5b, 0x44, 0x29, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x47, 0x62, 0x7c, 0x9b, 0xb6, 0xd2,
+  0xc4, 0xa9, 0x8e, 0x70, 0x55, 0x60, 0x84, 0xa4, 0xac, 0xac, 0xac, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdf, 0xca, 0xb4, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+  0xa8, 0xa4, 0x99, 0x89, 0x72, 0x59, 0x3e, 0x22, 0x05, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xdb, 0xc1, 0xae, 0xad, 0xb4, 0xb8, 0xbc,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xbc, 0xb2, 0x9f, 0x86, 0x69, 0x4c, 0x30, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34,
+  0x50, 0x6e, 0x8d, 0xa9, 0xc7, 0xd2, 0xb5, 0x98, 0x78, 0x5b, 0x3e, 0x21,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x39, 0x53, 0x6a, 0x7c, 0x90,
+  0xa2, 0xbf, 0xac, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa9, 0xb8, 0xac, 0x94,
+  0x86, 0x72, 0x5b, 0x42, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xbe, 0xdd, 0xc2, 0xa5, 0x8e, 0x84, 0x84, 0x84, 0x84, 0x88,
+  0x8b, 0x94, 0xb1, 0xd0, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1e, 0x3b, 0x59, 0x75, 0x94, 0xb2, 0xce, 0xb9, 0x9d, 0x7c, 0x60, 0x42,
+  0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x1a, 0x2c, 0x3f, 0x50, 0x63, 0x75, 0x8b, 0x9d, 0xb0, 0xc2, 0xd0,
+  0xbe, 0xaa, 0x94, 0x7a, 0x62, 0x48, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x90, 0xb0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc5, 0xcc, 0xad, 0x91, 0x84, 0x72, 0x5e, 0x47, 0x2d, 0x13, 0x00, 0x00,
+  0x00, 0x04, 0x1f, 0x3b, 0x56, 0x72, 0x8e, 0xab, 0xc5, 0xd0, 0xb5, 0x99,
+  0x7c, 0x60, 0x45, 0x60, 0x84, 0xa4, 0xc3, 0xcb, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x29, 0x18, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xcb, 0xc8, 0xc3,
+  0xb5, 0xa2, 0x88, 0x69, 0x4c, 0x2e, 0x10, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xe3, 0xcc, 0xbe, 0xb9, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb6, 0xc4, 0xda, 0xcb, 0xb2, 0x95, 0x74, 0x57, 0x38, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x40, 0x5d, 0x7a,
+  0x99, 0xb6, 0xd3, 0xc6, 0xa9, 0x8c, 0x6c, 0x50, 0x32, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x23, 0x3d, 0x53, 0x6a, 0x7c, 0x8b, 0x9e, 0xbd,
+  0xca, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xc8, 0xa9, 0x8e, 0x84, 0x70,
+  0x5b, 0x45, 0x2b, 0x11, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x78, 0x98,
+  0xb7, 0xd3, 0xd2, 0xbb, 0xa9, 0xa4, 0xa4, 0xa4, 0xa4, 0xa7, 0xa8, 0xae,
+  0xc1, 0xdb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x47,
+  0x65, 0x84, 0xa1, 0xbe, 0xcb, 0xad, 0x90, 0x70, 0x54, 0x37, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x33,
+  0x45, 0x58, 0x6b, 0x7c, 0x91, 0xa5, 0xb6, 0xc9, 0xc9, 0xb6, 0xa5, 0x91,
+  0x7a, 0x64, 0x4d, 0x36, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x2d, 0x4c, 0x6c, 0x90, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb1, 0xbb,
+  0xbe, 0xad, 0xa0, 0x8e, 0x72, 0x59, 0x3e, 0x22, 0x05, 0x00, 0x00, 0x12,
+  0x2e, 0x4b, 0x65, 0x84, 0x9e, 0xbb, 0xd5, 0xc0, 0xa5, 0x89, 0x6c, 0x50,
+  0x50, 0x60, 0x84, 0xa4, 0xc3, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x50, 0x44,
+  0x2d, 0x12, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb2, 0xc3, 0xda, 0xcd, 0xb2,
+  0x94, 0x74, 0x57, 0x38, 0x18, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xd4, 0xb7, 0xa0, 0x9b, 0x97, 0x94, 0x94, 0x94, 0x94, 0x99, 0xad,
+  0xc7, 0xdb, 0xbc, 0x9d, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4c, 0x69, 0x89, 0xa5, 0xc3,
+  0xd8, 0xbb, 0x9d, 0x7c, 0x60, 0x44, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x34, 0x4e, 0x6a, 0x84, 0x99, 0xa8, 0xb4, 0xc0, 0xb4, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb2, 0xbb, 0xbb, 0xac, 0x9e, 0x8b, 0x72, 0x57,
+  0x3d, 0x20, 0x03, 0x00, 0x00, 0x14, 0x33, 0x52, 0x6e, 0x8d, 0xa7, 0xbe,
+  0xcb, 0xcf, 0xc6, 0xc3, 0xc3, 0xc3, 0xc3, 0xc1, 0xbc, 0xbe, 0xcc, 0xe3,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x37, 0x54, 0x72, 0x90,
+  0xad, 0xcb, 0xbe, 0xa2, 0x84, 0x65, 0x47, 0x2b, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0,
+  0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x15, 0x28, 0x3a, 0x4d, 0x5e, 0x72,
+  0x86, 0x99, 0xab, 0xbe, 0xd0, 0xc2, 0xb0, 0x9d, 0x8b, 0x75, 0x62, 0x4d,
+  0x37, 0x21, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c,
+  0x6c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x9e, 0xb3, 0xcb,
+  0xb9, 0xa2, 0x88, 0x69, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x1c, 0x3b, 0x59,
+  0x75, 0x94, 0xae, 0xca, 0xd4, 0xb4, 0x95, 0x77, 0x70, 0x70, 0x70, 0x70,
+  0x84, 0xa4, 0xc3, 0xd7, 0xb8, 0x98, 0x74, 0x70, 0x70, 0x59, 0x3b, 0x1c,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x96, 0xad, 0xc7, 0xdb, 0xbc, 0x9c, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x78, 0x74, 0x70, 0x70, 0x70, 0x70, 0x7c, 0x9d, 0xbc, 0xdc,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x1e, 0x3b, 0x59, 0x75, 0x95, 0xb2, 0xcf, 0xcb, 0xae,
+  0x92, 0x72, 0x55, 0x37, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23,
+  0x40, 0x5e, 0x7a, 0x97, 0xb0, 0xc4, 0xbd, 0xa5, 0x95, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x94, 0x9f, 0xb5, 0xc9, 0xb8, 0x9f, 0x86, 0x67, 0x4a, 0x2c,
+  0x0e, 0x00, 0x00, 0x0b, 0x27, 0x44, 0x60, 0x77, 0x91, 0xa2, 0xac, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xac, 0xa8, 0xa3, 0x9d, 0xa0, 0xb7, 0xd4, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x44, 0x60, 0x7c, 0x9d, 0xba, 0xd0,
+  0xb2, 0x95, 0x75, 0x59, 0x3c, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c,
+  0x4c, 0x2d, 0x0d, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x03, 0x1b, 0x2f, 0x41, 0x54, 0x67, 0x78, 0x8e, 0x9f, 0xb3,
+  0xc4, 0xcd, 0xbb, 0xa8, 0x96, 0x84, 0x6f, 0x5d, 0x4a, 0x36, 0x21, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x64, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x86, 0xa2, 0xbf, 0xcd, 0xb2,
+  0x94, 0x74, 0x57, 0x38, 0x18, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xbe, 0xd9, 0xd6, 0xb7, 0x9c, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa9,
+  0xc6, 0xda, 0xbb, 0x9f, 0x94, 0x94, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x19, 0x37, 0x53, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x69, 0x7c, 0x9e, 0xbd, 0xdc, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x54, 0x50, 0x50, 0x50, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x2b, 0x47, 0x65, 0x84, 0xa1, 0xbe, 0xdc, 0xc0, 0xa2, 0x86, 0x65,
+  0x49, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x4a, 0x68,
+  0x89, 0xa6, 0xc2, 0xcb, 0xad, 0x91, 0x77, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x72, 0x89, 0xa3, 0xc1, 0xcb, 0xb0, 0x92, 0x72, 0x54, 0x35, 0x16, 0x00,
+  0x00, 0x00, 0x19, 0x34, 0x4b, 0x61, 0x75, 0x86, 0x8d, 0x90, 0x90, 0x90,
+  0x90, 0x8c, 0x88, 0x84, 0x7c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x33, 0x50, 0x6c, 0x8d, 0xa9, 0xc6, 0xc3, 0xa6, 0x89,
+  0x6b, 0x4c, 0x30, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d,
+  0x15, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x14, 0x30, 0x48, 0x5b, 0x6c, 0x84, 0x94, 0xa7, 0xb9, 0xcc, 0xc6, 0xb4,
+  0xa2, 0x8e, 0x7a, 0x67, 0x56, 0x42, 0x31, 0x21, 0x21, 0x1e, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x1e, 0x25, 0x25, 0x37, 0x49, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x59, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf,
+  0xdf, 0xc9, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbf, 0xd5, 0xe5,
+  0xcc, 0xb9, 0xb4, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x0e,
+  0x26, 0x3b, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x31, 0x31, 0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x37,
+  0x54, 0x72, 0x90, 0xad, 0xcb, 0xd0, 0xb4, 0x97, 0x77, 0x5a, 0x3d, 0x1f,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0xb0,
+  0xce, 0xc7, 0xa8, 0x88, 0x65, 0x4f, 0x4c, 0x4c, 0x4c, 0x4c, 0x5c, 0x7a,
+  0x9c, 0xbc, 0xd8, 0xb9, 0x9b, 0x78, 0x59, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+  0x07, 0x1e, 0x34, 0x4a, 0x59, 0x65, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69,
+  0x67, 0x62, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x22, 0x40, 0x5d, 0x78, 0x99, 0xb5, 0xd3, 0xb7, 0x9b, 0x7a, 0x5e, 0x40,
+  0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x35, 0x35, 0x35,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1c, 0x3b,
+  0x5a, 0x75, 0x89, 0x9c, 0xad, 0xc1, 0xd3, 0xbf, 0xac, 0x99, 0x89, 0x72,
+  0x61, 0x4e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3c, 0x2c, 0x14, 0x00, 0x00,
+  0x0c, 0x26, 0x3b, 0x44, 0x44, 0x41, 0x41, 0x3d, 0x3d, 0x3b, 0x39, 0x39,
+  0x38, 0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc9, 0xdd, 0xec, 0xd4, 0xc4,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x0c, 0x26, 0x3b, 0x44,
+  0x44, 0x41, 0x41, 0x3d, 0x3d, 0x3b, 0x39, 0x39, 0x38, 0x39, 0x58, 0x78,
+  0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x35, 0x35,
+  0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x27, 0x44, 0x60, 0x7c,
+  0x9d, 0xba, 0xd7, 0xc5, 0xa7, 0x8b, 0x6b, 0x4e, 0x31, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x35, 0x35, 0x35, 0x39, 0x58, 0x78, 0x9c, 0xbc,
+  0xdb, 0xbf, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x2f, 0x40, 0x44, 0x47, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x48, 0x4c,
+  0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4c,
+  0x69, 0x88, 0xa5, 0xc2, 0xc9, 0xab, 0x8e, 0x70, 0x52, 0x35, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xa9, 0xc8, 0xd0, 0xb1, 0x94, 0x70, 0x58, 0x54, 0x54, 0x54, 0x57, 0x68,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xb5, 0xc8, 0xda, 0xc2, 0xa7, 0x94, 0x7c, 0x6c, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x58, 0x40, 0x23, 0x05, 0x00, 0x19, 0x37,
+  0x53, 0x64, 0x64, 0x60, 0x60, 0x5c, 0x5c, 0x59, 0x58, 0x58, 0x58, 0x54,
+  0x5b, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xb0, 0xcb, 0xdd, 0xc0, 0xa8, 0xa0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x19, 0x37, 0x53, 0x64, 0x64, 0x60,
+  0x60, 0x5c, 0x5c, 0x59, 0x58, 0x58, 0x58, 0x54, 0x5b, 0x78, 0x9c, 0xbc,
+  0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xd0, 0xb1, 0x94, 0x70, 0x58, 0x54, 0x54, 0x54, 0x5e,
+  0x7c, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x33, 0x50, 0x6c, 0x8d, 0xa9, 0xc6,
+  0xd5, 0xb9, 0x9c, 0x7c, 0x5f, 0x42, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x65, 0x54, 0x54, 0x54, 0x54, 0x54, 0x5d, 0x7a, 0x9c, 0xbc, 0xdb, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x06, 0x24, 0x42, 0x5b,
+  0x64, 0x63, 0x60, 0x5d, 0x5c, 0x5a, 0x58, 0x58, 0x54, 0x57, 0x6e, 0x90,
+  0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x3b, 0x59, 0x75, 0x94,
+  0xb2, 0xce, 0xbc, 0xa0, 0x84, 0x63, 0x45, 0x29, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44, 0x64, 0x88, 0xa6, 0xc5,
+  0xd7, 0xb9, 0x9d, 0x86, 0x77, 0x74, 0x74, 0x74, 0x74, 0x7c, 0x95, 0xb0,
+  0xce, 0xcf, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xdf, 0xdb, 0xbc, 0x9c, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0x88, 0x84, 0x84, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x75, 0x74, 0x78, 0x89,
+  0xa3, 0xc0, 0xdc, 0xbd, 0x9e, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x1d,
+  0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x84, 0xa4, 0xc3, 0xd7, 0xb8, 0x98, 0x7c, 0x7c, 0x7a, 0x5c,
+  0x3c, 0x1d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x84, 0x84, 0x7c,
+  0x7c, 0x78, 0x78, 0x78, 0x75, 0x74, 0x78, 0x89, 0xa3, 0xc0, 0xdc, 0xbd,
+  0x9e, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x28, 0x48, 0x67, 0x88, 0xa8,
+  0xc7, 0xd7, 0xb9, 0x9d, 0x86, 0x77, 0x74, 0x74, 0x74, 0x78, 0x8b, 0xa7,
+  0xc4, 0xdc, 0xbd, 0x9e, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x22, 0x40, 0x5d, 0x78, 0x99, 0xb5, 0xd3, 0xca, 0xac,
+  0x90, 0x70, 0x54, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x92, 0xb0, 0xd0, 0xcb, 0xae, 0x94, 0x7c, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x78, 0x8b, 0xa5, 0xc3, 0xda, 0xbb, 0x9c, 0x78,
+  0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x84,
+  0x84, 0x7c, 0x7c, 0x78, 0x78, 0x78, 0x74, 0x74, 0x84, 0x9b, 0xb7, 0xd4,
+  0xc7, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x47, 0x65, 0x84, 0xa1, 0xbe, 0xce,
+  0xb0, 0x94, 0x73, 0x57, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x22, 0x40, 0x60, 0x7c, 0x9e, 0xbc, 0xd9, 0xc9,
+  0xb3, 0xa0, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9d, 0xab, 0xc1, 0xdb, 0xc5,
+  0xa8, 0x8b, 0x69, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xe2,
+  0xc5, 0xad, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa4,
+  0xa2, 0xa0, 0xa0, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x98, 0xa2, 0xb5, 0xce,
+  0xd3, 0xb5, 0x98, 0x77, 0x58, 0x38, 0x1a, 0x00, 0x00, 0x17, 0x34, 0x4d,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x60,
+  0x84, 0xa4, 0xc3, 0xd7, 0xb8, 0x98, 0x74, 0x5c, 0x5c, 0x4d, 0x34, 0x17,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa4, 0xa2, 0xa0, 0xa0, 0x9c,
+  0x9c, 0x9c, 0x98, 0x98, 0x98, 0xa2, 0xb5, 0xce, 0xd3, 0xb5, 0x98, 0x77,
+  0x58, 0x38, 0x1a, 0x00, 0x04, 0x24, 0x43, 0x62, 0x84, 0xa1, 0xc0, 0xdc,
+  0xc9, 0xb3, 0xa0, 0x98, 0x98, 0x98, 0x98, 0x9b, 0xa5, 0xb8, 0xd2, 0xd3,
+  0xb6, 0x98, 0x77, 0x58, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x2e, 0x4c, 0x69, 0x88, 0xa5, 0xc2, 0xdc, 0xbe, 0xa1, 0x84, 0x64,
+  0x47, 0x29, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c,
+  0x4c, 0x6b, 0x8c, 0xa9, 0xc8, 0xd9, 0xc1, 0xaa, 0x9c, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0xa3, 0xb8, 0xd0, 0xd0, 0xb4, 0x94, 0x74, 0x55, 0x37,
+  0x18, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa4, 0xa4, 0xa0,
+  0xa0, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x9e, 0xb0, 0xc7, 0xdb, 0xbf, 0xa1,
+  0x84, 0x62, 0x43, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x37, 0x54, 0x72, 0x90, 0xad, 0xcb, 0xc1, 0xa3, 0x88,
+  0x68, 0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x38, 0x57, 0x73, 0x92, 0xad, 0xc2, 0xd0, 0xcb, 0xbe,
+  0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0xc7, 0xd3, 0xc8, 0xb5, 0x9b, 0x7c,
+  0x60, 0x42, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xcf, 0xcf, 0xc9,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc1, 0xc0,
+  0xbf, 0xbc, 0xbc, 0xbc, 0xb8, 0xb8, 0xb8, 0xbf, 0xce, 0xcf, 0xc0, 0xa8,
+  0x8d, 0x6c, 0x50, 0x32, 0x13, 0x00, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x41, 0x60, 0x84, 0xa4,
+  0xc3, 0xcf, 0xb8, 0x98, 0x74, 0x54, 0x3c, 0x34, 0x21, 0x08, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc1, 0xc0, 0xbf, 0xbc, 0xbc, 0xbc,
+  0xb8, 0xb8, 0xb8, 0xbf, 0xce, 0xcf, 0xc0, 0xa8, 0x8d, 0x6c, 0x50, 0x32,
+  0x13, 0x00, 0x00, 0x1d, 0x3b, 0x5a, 0x77, 0x95, 0xb0, 0xc5, 0xd2, 0xcb,
+  0xbe, 0xb8, 0xb8, 0xb8, 0xb8, 0xb9, 0xc2, 0xd2, 0xcf, 0xc0, 0xa8, 0x8d,
+  0x6e, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x3b,
+  0x59, 0x75, 0x94, 0xb2, 0xce, 0xcf, 0xb2, 0x95, 0x75, 0x59, 0x3b, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44, 0x62,
+  0x84, 0x9d, 0xb7, 0xca, 0xd4, 0xc5, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xc0, 0xcf, 0xce, 0xbe, 0xa5, 0x8b, 0x6b, 0x4e, 0x2f, 0x10, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xc3, 0xc0, 0xc0, 0xbc,
+  0xbc, 0xba, 0xb8, 0xb8, 0xbc, 0xc9, 0xd2, 0xc5, 0xb0, 0x95, 0x77, 0x59,
+  0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x27, 0x44, 0x60, 0x7c, 0x9d, 0xb0, 0xb0, 0xb0, 0x98, 0x78, 0x5b, 0x3e,
+  0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x2d, 0x49, 0x65, 0x7c, 0x96, 0xa7, 0xb1, 0xb8, 0xb8, 0xbc, 0xbc,
+  0xbc, 0xbc, 0xbc, 0xba, 0xb8, 0xb4, 0xab, 0x9c, 0x89, 0x6c, 0x52, 0x35,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xb0, 0xb0, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xac, 0xac, 0xb0, 0xb1, 0xb4,
+  0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb7, 0xb0, 0xa5, 0x94, 0x7a, 0x60,
+  0x44, 0x27, 0x09, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x21, 0x41, 0x60, 0x84, 0xa4, 0xb0, 0xb0,
+  0xb0, 0x98, 0x74, 0x54, 0x35, 0x17, 0x08, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xac, 0xac, 0xb0, 0xb1, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xb7, 0xb0, 0xa5, 0x94, 0x7a, 0x60, 0x44, 0x27, 0x09, 0x00,
+  0x00, 0x14, 0x30, 0x4c, 0x69, 0x84, 0x99, 0xa9, 0xb4, 0xb8, 0xba, 0xbc,
+  0xbc, 0xbc, 0xbc, 0xbc, 0xb8, 0xb7, 0xb0, 0xa5, 0x94, 0x7a, 0x60, 0x44,
+  0x27, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x47, 0x65, 0x84,
+  0xa1, 0xb0, 0xb0, 0xb0, 0xa6, 0x89, 0x69, 0x4c, 0x30, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x54, 0x6f, 0x8b,
+  0x9e, 0xac, 0xb4, 0xb8, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb8,
+  0xb7, 0xb0, 0xa3, 0x91, 0x77, 0x5e, 0x42, 0x24, 0x07, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xa8, 0xac, 0xb0, 0xb0, 0xb4, 0xb4, 0xb8,
+  0xb8, 0xb8, 0xbb, 0xb8, 0xb4, 0xa9, 0x99, 0x84, 0x67, 0x4c, 0x30, 0x13,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x4f,
+  0x6c, 0x8d, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x6c, 0x50, 0x32, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e,
+  0x39, 0x50, 0x67, 0x7a, 0x8b, 0x94, 0x98, 0x99, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x9c, 0x98, 0x94, 0x8d, 0x84, 0x6e, 0x59, 0x41, 0x27, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x8c, 0x8d, 0x90, 0x94, 0x94, 0x95, 0x98,
+  0x98, 0x98, 0x99, 0x99, 0x98, 0x92, 0x89, 0x77, 0x64, 0x4d, 0x34, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x21, 0x41, 0x60, 0x84, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0x88, 0x8c, 0x8d, 0x90, 0x94, 0x94, 0x95, 0x98, 0x98, 0x98, 0x99, 0x99,
+  0x98, 0x92, 0x89, 0x77, 0x64, 0x4d, 0x34, 0x19, 0x00, 0x00, 0x00, 0x05,
+  0x22, 0x3c, 0x56, 0x6b, 0x7c, 0x8c, 0x94, 0x98, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x9c, 0x99, 0x98, 0x92, 0x89, 0x77, 0x64, 0x4d, 0x34, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x72, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x7a, 0x5e, 0x40, 0x23, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x29, 0x43, 0x5b, 0x70, 0x84, 0x90,
+  0x95, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x92,
+  0x88, 0x77, 0x61, 0x4b, 0x32, 0x17, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x88, 0x88, 0x8c, 0x90, 0x90, 0x94, 0x94, 0x98, 0x98, 0x98,
+  0x9c, 0x98, 0x94, 0x8c, 0x7c, 0x6a, 0x55, 0x3c, 0x21, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5e, 0x44, 0x27, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x23, 0x3a,
+  0x4e, 0x5e, 0x6b, 0x70, 0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x74, 0x73, 0x6c, 0x63, 0x54, 0x42, 0x2c, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x18, 0x35,
+  0x50, 0x63, 0x64, 0x68, 0x6c, 0x6c, 0x70, 0x70, 0x74, 0x74, 0x74, 0x74,
+  0x78, 0x78, 0x74, 0x70, 0x69, 0x5d, 0x4c, 0x37, 0x21, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x3d, 0x5b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x50,
+  0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x63, 0x64, 0x68,
+  0x6c, 0x6c, 0x70, 0x70, 0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x74, 0x70,
+  0x69, 0x5d, 0x4c, 0x37, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29,
+  0x3f, 0x52, 0x62, 0x6c, 0x73, 0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x74, 0x70, 0x69, 0x5d, 0x4c, 0x37, 0x21, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x69, 0x52, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x2f, 0x44, 0x56, 0x64, 0x6e, 0x74, 0x75,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x70, 0x68, 0x5b,
+  0x4b, 0x34, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x40, 0x59,
+  0x64, 0x68, 0x68, 0x6c, 0x70, 0x70, 0x74, 0x74, 0x74, 0x74, 0x78, 0x74,
+  0x73, 0x6c, 0x60, 0x52, 0x3e, 0x29, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x45, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0x34, 0x42,
+  0x4c, 0x53, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x54,
+  0x4f, 0x45, 0x39, 0x28, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x49, 0x37, 0x1e, 0x02, 0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00, 0x00, 0x0a, 0x23, 0x38, 0x44,
+  0x46, 0x48, 0x4c, 0x4c, 0x50, 0x50, 0x54, 0x54, 0x54, 0x54, 0x58, 0x58,
+  0x54, 0x52, 0x4b, 0x40, 0x32, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x2e, 0x43, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x3c, 0x25, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x38, 0x44, 0x46, 0x48, 0x4c, 0x4c,
+  0x50, 0x50, 0x54, 0x54, 0x54, 0x54, 0x58, 0x58, 0x54, 0x52, 0x4b, 0x40,
+  0x32, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x25, 0x37,
+  0x44, 0x4e, 0x54, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54,
+  0x52, 0x4b, 0x40, 0x32, 0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b,
+  0x3c, 0x25, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x18, 0x2a, 0x3b, 0x47, 0x50, 0x54, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x52, 0x4a, 0x3e, 0x30, 0x1e,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2c, 0x3e, 0x44, 0x48,
+  0x4a, 0x4c, 0x50, 0x50, 0x54, 0x54, 0x54, 0x57, 0x58, 0x55, 0x54, 0x4e,
+  0x44, 0x35, 0x25, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x28, 0x1a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x24, 0x2d, 0x34,
+  0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x34, 0x30, 0x27,
+  0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2a, 0x1e,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x29, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x24, 0x27, 0x29,
+  0x2d, 0x2d, 0x31, 0x31, 0x35, 0x35, 0x35, 0x35, 0x39, 0x39, 0x35, 0x33,
+  0x2c, 0x23, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x27,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x1c, 0x24, 0x27, 0x29, 0x2d, 0x2d, 0x31, 0x31,
+  0x35, 0x35, 0x35, 0x35, 0x39, 0x39, 0x35, 0x33, 0x2c, 0x23, 0x16, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1b, 0x25, 0x2f,
+  0x34, 0x36, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x33, 0x2c,
+  0x23, 0x16, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x1e, 0x29, 0x30, 0x35, 0x38, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x35, 0x33, 0x2c, 0x22, 0x14, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x25, 0x29, 0x2b, 0x2d,
+  0x31, 0x31, 0x35, 0x35, 0x35, 0x38, 0x39, 0x37, 0x34, 0x2f, 0x25, 0x19,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x14, 0x15, 0x19,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x15, 0x10, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x09, 0x0d, 0x0e,
+  0x11, 0x11, 0x15, 0x15, 0x15, 0x15, 0x19, 0x19, 0x15, 0x14, 0x0d, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x08, 0x09, 0x0d, 0x0e, 0x11, 0x11, 0x15, 0x15,
+  0x15, 0x15, 0x19, 0x19, 0x15, 0x14, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x15, 0x17,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x15, 0x14, 0x0d, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x11, 0x15, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x15, 0x14, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0x09, 0x0c, 0x0d, 0x11, 0x11,
+  0x15, 0x15, 0x15, 0x18, 0x19, 0x18, 0x15, 0x10, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0d, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0b, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x05, 0x05, 0x06, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x2f, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x2c, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x10, 0x23, 0x2f,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2c, 0x1d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0x17, 0x24, 0x2c, 0x2a, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x02,
+  0x15, 0x22, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x24, 0x1c, 0x0c, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x29,
+  0x2d, 0x27, 0x1a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x15,
+  0x19, 0x1c, 0x1d, 0x21, 0x21, 0x25, 0x25, 0x25, 0x29, 0x29, 0x29, 0x29,
+  0x25, 0x20, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x18, 0x20, 0x25, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x23, 0x1a, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x16, 0x0e, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x15, 0x1a, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x14, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x49, 0x34, 0x19, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x49, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x1b, 0x27,
+  0x35, 0x42, 0x4c, 0x49, 0x37, 0x1e, 0x02, 0x00, 0x00, 0x16, 0x2f, 0x40,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x38, 0x23, 0x09, 0x00, 0x00, 0x1b, 0x34, 0x47, 0x4c, 0x44,
+  0x37, 0x2b, 0x1d, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x20, 0x30, 0x35, 0x39, 0x3c,
+  0x3d, 0x41, 0x41, 0x44, 0x44, 0x44, 0x48, 0x48, 0x48, 0x48, 0x44, 0x3f,
+  0x36, 0x29, 0x1a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x1b, 0x2b, 0x36, 0x3f, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x41, 0x38, 0x2b, 0x1b, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x2b, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x35, 0x2c, 0x1e, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x2b, 0x33,
+  0x39, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3b, 0x30, 0x1b, 0x01, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x39, 0x33, 0x29, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35,
+  0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x2f, 0x4e, 0x6a, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60,
+  0x42, 0x23, 0x04, 0x00, 0x10, 0x2f, 0x4e, 0x6a, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x11, 0x1e, 0x2b, 0x37, 0x45, 0x52, 0x5e,
+  0x6b, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x06, 0x24, 0x42, 0x5b, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63,
+  0x50, 0x33, 0x15, 0x00, 0x07, 0x26, 0x45, 0x61, 0x6c, 0x60, 0x54, 0x47,
+  0x3b, 0x2d, 0x20, 0x14, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x36, 0x4c, 0x54, 0x58, 0x5b, 0x5c, 0x60,
+  0x60, 0x64, 0x64, 0x64, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5e, 0x54, 0x45,
+  0x34, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x23, 0x36, 0x47,
+  0x54, 0x5e, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x65, 0x60, 0x55, 0x47, 0x34, 0x1e, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x41,
+  0x57, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d,
+  0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x54, 0x49, 0x3b, 0x2a, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x28, 0x39, 0x47, 0x52, 0x58, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5a, 0x48, 0x2d, 0x0f, 0x00, 0x00, 0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x58, 0x52, 0x47, 0x39, 0x2a, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0x94, 0x94, 0x94, 0x94, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0x94, 0x94, 0x94, 0x94, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x14, 0x22, 0x2e, 0x3b, 0x47, 0x55, 0x62, 0x6e, 0x7a, 0x8b, 0x6c,
+  0x4c, 0x2d, 0x0d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x58, 0x39,
+  0x19, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x7c, 0x70, 0x63, 0x57, 0x4b,
+  0x3d, 0x30, 0x24, 0x17, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x24, 0x43, 0x62, 0x74, 0x78, 0x78, 0x7c, 0x84, 0x84, 0x88,
+  0x88, 0x88, 0x8b, 0x8c, 0x8c, 0x8b, 0x86, 0x7c, 0x70, 0x60, 0x4b, 0x34,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x23, 0x3a, 0x50, 0x62, 0x70, 0x7c,
+  0x86, 0x89, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x88, 0x7c, 0x72, 0x61, 0x4b, 0x33, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x32, 0x50, 0x6c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x62, 0x44, 0x25, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x78, 0x72, 0x65, 0x56, 0x42, 0x2c, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x29, 0x3f, 0x54, 0x63, 0x70, 0x78, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54,
+  0x34, 0x15, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x70,
+  0x65, 0x55, 0x43, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54,
+  0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xb4, 0xb4, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xb4, 0xb4, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x17, 0x24, 0x32,
+  0x3e, 0x4b, 0x58, 0x65, 0x72, 0x7c, 0x8d, 0x9b, 0x90, 0x6c, 0x4c, 0x2d,
+  0x0d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0x9d, 0x90, 0x84, 0x73, 0x67, 0x5b, 0x4e,
+  0x40, 0x34, 0x27, 0x1a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0x99, 0x9c, 0xa0, 0xa1, 0xa4, 0xa5, 0xa8, 0xa8,
+  0xa8, 0xac, 0xac, 0xa8, 0xa4, 0x9c, 0x8e, 0x77, 0x61, 0x47, 0x2b, 0x0e,
+  0x00, 0x00, 0x00, 0x1b, 0x36, 0x50, 0x67, 0x7a, 0x8e, 0x9c, 0xa4, 0xa8,
+  0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xa7,
+  0x9e, 0x8e, 0x77, 0x5e, 0x45, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x1f, 0x3d, 0x5b, 0x78, 0x98, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0x8c, 0x6c, 0x4f, 0x31, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0x9b, 0x92, 0x84, 0x6f, 0x59, 0x3f, 0x24, 0x07, 0x00, 0x00, 0x00, 0x05,
+  0x22, 0x3d, 0x56, 0x6c, 0x84, 0x90, 0x99, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0x98, 0x90, 0x84, 0x6f,
+  0x5b, 0x45, 0x2c, 0x12, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x00, 0x00, 0x01, 0x0e, 0x1b, 0x27, 0x35, 0x42, 0x4e, 0x5b, 0x68,
+  0x75, 0x84, 0x90, 0x9d, 0xab, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xac, 0xa0, 0x94, 0x86, 0x77, 0x6b, 0x5e, 0x50,
+  0x44, 0x37, 0x2b, 0x1d, 0x10, 0x04, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44,
+  0x64, 0x88, 0xa8, 0xbc, 0xc0, 0xc0, 0xc3, 0xc4, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xcb, 0xc8, 0xc4, 0xb9, 0xa7, 0x8e, 0x72, 0x55, 0x37, 0x1a, 0x00, 0x00,
+  0x0d, 0x2b, 0x47, 0x62, 0x7a, 0x96, 0xaa, 0xb9, 0xc4, 0xc1, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc5, 0xc5, 0xbb, 0xa7,
+  0x8e, 0x70, 0x53, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x2b, 0x49, 0x65, 0x86, 0xa3, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xb5, 0x97, 0x77, 0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbf, 0xb9, 0xae,
+  0x9e, 0x88, 0x6b, 0x4e, 0x32, 0x14, 0x00, 0x00, 0x00, 0x13, 0x30, 0x4c,
+  0x69, 0x86, 0x9c, 0xac, 0xb7, 0xbd, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbd, 0xb7, 0xad, 0x9e, 0x8b, 0x72, 0x58,
+  0x3d, 0x20, 0x04, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac,
+  0xac, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xac, 0xac, 0xac, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+  0x0e, 0x1e, 0x2b, 0x37, 0x45, 0x52, 0x5e, 0x6b, 0x78, 0x88, 0x94, 0xa0,
+  0xad, 0xbb, 0xc3, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xc1, 0xbc, 0xb0, 0xa3, 0x95, 0x89, 0x7a, 0x6e, 0x60, 0x54,
+  0x47, 0x3b, 0x2d, 0x20, 0x11, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0xa8, 0xb4, 0xb0, 0xb0, 0xac, 0xac, 0xab, 0xa8, 0xa8, 0xa8, 0xac, 0xb9,
+  0xcf, 0xd4, 0xbb, 0x9d, 0x7c, 0x60, 0x41, 0x23, 0x03, 0x00, 0x18, 0x36,
+  0x54, 0x70, 0x8e, 0xaa, 0xc3, 0xc3, 0xb0, 0xa2, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xaa, 0xbe, 0xd3, 0xb9, 0x9b, 0x7a,
+  0x5c, 0x3d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x36, 0x54, 0x70, 0x90, 0xae, 0xcb, 0xdf, 0xdf, 0xdd, 0xc0, 0xa2,
+  0x84, 0x65, 0x47, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb9, 0xc7, 0xd8, 0xca, 0xb3, 0x97,
+  0x78, 0x5a, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x77, 0x95,
+  0xb0, 0xc8, 0xd6, 0xc5, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb6, 0xc2, 0xd2, 0xc9, 0xb7, 0x9f, 0x86, 0x67, 0x4b, 0x2e,
+  0x10, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x0c, 0x26, 0x3b,
+  0x47, 0x55, 0x62, 0x6e, 0x7a, 0x8b, 0x97, 0xa3, 0xb0, 0xbe, 0xbe, 0xb2,
+  0xa7, 0x9b, 0x8e, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x77, 0x58, 0x38, 0x19, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x98,
+  0xa3, 0xb0, 0xbc, 0xc0, 0xb4, 0xa6, 0x99, 0x8d, 0x7c, 0x70, 0x63, 0x57,
+  0x4b, 0x3d, 0x29, 0x10, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x94, 0x94,
+  0x90, 0x90, 0x8c, 0x8c, 0x8c, 0x88, 0x88, 0x88, 0x8e, 0xa2, 0xbc, 0xd9,
+  0xc5, 0xa7, 0x88, 0x67, 0x48, 0x28, 0x09, 0x01, 0x20, 0x3f, 0x5e, 0x7c,
+  0x9c, 0xb9, 0xcb, 0xb0, 0x96, 0x86, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x91, 0xab, 0xc8, 0xc1, 0xa3, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x41,
+  0x5e, 0x7c, 0x9c, 0xb9, 0xd7, 0xe2, 0xdf, 0xe6, 0xcb, 0xad, 0x90, 0x70,
+  0x53, 0x35, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x9b, 0xb0, 0xc7, 0xde, 0xc0, 0xa2, 0x84, 0x62,
+  0x43, 0x24, 0x04, 0x00, 0x04, 0x23, 0x42, 0x60, 0x84, 0xa0, 0xbf, 0xdc,
+  0xc5, 0xad, 0x9b, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x98, 0xa5, 0xbb, 0xd2, 0xcc, 0xb0, 0x94, 0x74, 0x57, 0x38, 0x1a, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5b,
+  0x40, 0x22, 0x03, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x5b, 0x40, 0x22, 0x03, 0x00, 0x19, 0x37, 0x53, 0x65, 0x72,
+  0x7c, 0x8d, 0x9b, 0xa7, 0xb4, 0xc0, 0xb9, 0xac, 0xa1, 0x95, 0x89, 0x7a,
+  0x70, 0x61, 0x47, 0x29, 0x0a, 0x00, 0x04, 0x22, 0x3e, 0x55, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b,
+  0x4b, 0x30, 0x13, 0x00, 0x07, 0x25, 0x44, 0x5e, 0x6c, 0x78, 0x88, 0x94,
+  0x9e, 0xab, 0xb6, 0xc2, 0xb6, 0xa9, 0x9d, 0x90, 0x84, 0x73, 0x67, 0x56,
+  0x3b, 0x1d, 0x00, 0x04, 0x24, 0x43, 0x62, 0x74, 0x72, 0x70, 0x70, 0x6c,
+  0x6c, 0x68, 0x68, 0x64, 0x64, 0x65, 0x73, 0x92, 0xb0, 0xd0, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x05, 0x25, 0x44, 0x64, 0x86, 0xa4, 0xc4,
+  0xc0, 0xa1, 0x84, 0x69, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x63, 0x84, 0xa4, 0xc3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x4c, 0x6b, 0x89,
+  0xa7, 0xc4, 0xd4, 0xc4, 0xc0, 0xc9, 0xd5, 0xb9, 0x9b, 0x7c, 0x5e, 0x40,
+  0x23, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x84, 0x9b, 0xb9, 0xd7, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x07, 0x26, 0x45, 0x64, 0x88, 0xa8, 0xc6, 0xd6, 0xb7, 0x9b,
+  0x7c, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x6a, 0x50, 0x32, 0x13, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x78, 0x8e,
+  0xa5, 0xc2, 0xdb, 0xbc, 0x9e, 0x7c, 0x5e, 0x3f, 0x20, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x3f, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x1f, 0x37, 0x46, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x42, 0x2f, 0x15,
+  0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x42, 0x2f, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x9d, 0xab,
+  0xb7, 0xbe, 0xb2, 0xa7, 0x9b, 0x90, 0x84, 0x75, 0x6b, 0x5e, 0x52, 0x45,
+  0x34, 0x1c, 0x00, 0x00, 0x07, 0x26, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54, 0x36,
+  0x17, 0x00, 0x00, 0x19, 0x31, 0x44, 0x50, 0x5b, 0x67, 0x73, 0x84, 0x8d,
+  0x99, 0xa5, 0xb0, 0xbc, 0xb9, 0xac, 0xa0, 0x94, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x1b, 0x36, 0x4c, 0x54, 0x54, 0x50, 0x50, 0x4c, 0x4c, 0x48,
+  0x48, 0x45, 0x44, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa8, 0xc8, 0xbc, 0x9c,
+  0x78, 0x5a, 0x42, 0x56, 0x65, 0x70, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x84, 0xa4, 0xc3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x75, 0x94, 0xb2, 0xd0,
+  0xc0, 0xa8, 0xa0, 0xb0, 0xcb, 0xc4, 0xa6, 0x89, 0x69, 0x4b, 0x2e, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50, 0x53,
+  0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xab, 0xc9, 0xcf, 0xb0, 0x90, 0x70, 0x52,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3d,
+  0x25, 0x09, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5e, 0x78, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x47, 0x31, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d,
+  0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16, 0x02, 0x00, 0x00,
+  0x00, 0x0a, 0x1d, 0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16,
+  0x02, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xbb, 0xc7, 0xb9, 0xa2,
+  0x95, 0x89, 0x7c, 0x70, 0x64, 0x59, 0x4c, 0x41, 0x35, 0x29, 0x1b, 0x07,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00,
+  0x00, 0x05, 0x19, 0x27, 0x32, 0x3e, 0x4b, 0x57, 0x62, 0x6e, 0x78, 0x88,
+  0x94, 0x9e, 0xb4, 0xc9, 0xbc, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x0a, 0x20, 0x30, 0x35, 0x34, 0x31, 0x31, 0x2d, 0x2d, 0x29, 0x29, 0x2b,
+  0x36, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x58,
+  0x59, 0x6f, 0x84, 0x90, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0xab,
+  0xc8, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x27, 0x45, 0x63, 0x84, 0xa0, 0xbe, 0xd2, 0xb5, 0x97,
+  0x84, 0xa2, 0xc0, 0xcf, 0xb1, 0x94, 0x74, 0x57, 0x39, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x41, 0x41, 0x41, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc4, 0xa4, 0x86, 0x64, 0x44, 0x25, 0x05, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x10, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x31, 0x31, 0x31, 0x34, 0x53, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x42, 0x34, 0x31, 0x2b, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xb0, 0x90, 0x78, 0x6c,
+  0x62, 0x55, 0x49, 0x3d, 0x32, 0x25, 0x1a, 0x0e, 0x02, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x18, 0x24, 0x30, 0x3b, 0x47, 0x53, 0x5e, 0x6b, 0x77, 0x8c,
+  0xac, 0xcb, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x05,
+  0x11, 0x15, 0x15, 0x11, 0x13, 0x1e, 0x29, 0x33, 0x3e, 0x49, 0x54, 0x5e,
+  0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x58, 0x6c, 0x89,
+  0x9e, 0xae, 0xb7, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xc2, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x32, 0x50, 0x6e, 0x8d, 0xab, 0xc9, 0xc8, 0xa9, 0x8c, 0x78, 0x98,
+  0xb6, 0xd4, 0xbc, 0x9e, 0x84, 0x62, 0x44, 0x27, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x75, 0x95, 0xb4, 0xce,
+  0xb6, 0x9b, 0x7c, 0x5e, 0x3f, 0x20, 0x01, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x11, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x60, 0x49, 0x2c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x24, 0x16, 0x02, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x24, 0x16, 0x02, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xb7, 0xc5, 0xb9, 0xa3, 0x98, 0x8d, 0x7c, 0x72,
+  0x67, 0x5b, 0x4f, 0x44, 0x37, 0x2c, 0x1e, 0x0a, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb8, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x05, 0x1a, 0x29,
+  0x35, 0x41, 0x4c, 0x59, 0x64, 0x70, 0x7c, 0x8b, 0x95, 0xa2, 0xb6, 0xc7,
+  0xbb, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x1e, 0x30, 0x3c, 0x46, 0x52, 0x5b, 0x67, 0x72, 0x7c, 0x89, 0x96,
+  0xb2, 0xd1, 0xc4, 0xa6, 0x88, 0x65, 0x47, 0x28, 0x08, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x5d, 0x7a, 0x99, 0xb5, 0xca,
+  0xc6, 0xb4, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb8, 0xd0, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x3e,
+  0x5b, 0x78, 0x98, 0xb6, 0xd3, 0xbe, 0xa0, 0x84, 0x6e, 0x8e, 0xac, 0xca,
+  0xc8, 0xa9, 0x8d, 0x6c, 0x50, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x8e, 0xa3, 0xbe, 0xb4, 0xa2, 0x8b,
+  0x6e, 0x52, 0x35, 0x18, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa5,
+  0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x42, 0x2f, 0x15, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x42, 0x2f, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0x8e, 0x9b, 0xa7, 0xb5, 0xc1, 0xb5, 0xa9, 0x9e, 0x92, 0x86, 0x78,
+  0x6c, 0x60, 0x55, 0x49, 0x37, 0x1e, 0x02, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x19, 0x31, 0x45, 0x53, 0x5e,
+  0x6b, 0x75, 0x84, 0x90, 0x9b, 0xa7, 0xb4, 0xbf, 0xb7, 0xab, 0x9d, 0x90,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32,
+  0x4b, 0x59, 0x64, 0x70, 0x78, 0x88, 0x90, 0x9c, 0xa7, 0xb2, 0xc3, 0xca,
+  0xb5, 0x9b, 0x7c, 0x5e, 0x40, 0x22, 0x03, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x64, 0x86, 0xa4, 0xc3, 0xd0, 0xb4, 0x99,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0xa6, 0xc5, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x49, 0x67, 0x88,
+  0xa3, 0xc1, 0xd2, 0xb4, 0x95, 0x75, 0x64, 0x84, 0xa2, 0xc0, 0xd3, 0xb5,
+  0x98, 0x78, 0x5b, 0x3d, 0x1f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xcc, 0xb3, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa9, 0xb9, 0xb4, 0x99, 0x89, 0x72, 0x5b, 0x42,
+  0x27, 0x0b, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xce, 0xb5, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x5b,
+  0x40, 0x22, 0x03, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x5b, 0x40, 0x22, 0x03, 0x00, 0x18, 0x35, 0x50, 0x62, 0x70,
+  0x7c, 0x8b, 0x97, 0xa5, 0xb2, 0xbe, 0xbb, 0xae, 0xa3, 0x97, 0x8c, 0x7c,
+  0x72, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x08, 0x28, 0x47, 0x65, 0x74, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72,
+  0x57, 0x38, 0x18, 0x00, 0x07, 0x25, 0x44, 0x5e, 0x70, 0x7c, 0x89, 0x95,
+  0xa1, 0xac, 0xb9, 0xc0, 0xb4, 0xa7, 0x9b, 0x8d, 0x7c, 0x72, 0x65, 0x53,
+  0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x77,
+  0x84, 0x8e, 0x99, 0xa3, 0xae, 0xba, 0xc4, 0xc8, 0xbc, 0xae, 0x9e, 0x89,
+  0x6c, 0x52, 0x35, 0x18, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xbc, 0x9c, 0x78, 0x64, 0x88, 0xa8, 0xc7, 0xc8, 0xa8, 0x89, 0x6c, 0x68,
+  0x68, 0x68, 0x84, 0xa4, 0xc3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x37, 0x54, 0x72, 0x92, 0xae, 0xcd,
+  0xc8, 0xa9, 0x8c, 0x6c, 0x5a, 0x78, 0x98, 0xb6, 0xd4, 0xc0, 0xa3, 0x86,
+  0x65, 0x49, 0x2b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xdf, 0xcc, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc6, 0xd0, 0xb1, 0x94, 0x88, 0x75, 0x61, 0x4b, 0x33, 0x19,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xe2, 0xd0, 0xc8, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x0a, 0x23, 0x37, 0x45, 0x52, 0x5f, 0x6c,
+  0x78, 0x88, 0x94, 0xa2, 0xae, 0xbb, 0xc0, 0xb5, 0xa9, 0x9d, 0x90, 0x6c,
+  0x4c, 0x2d, 0x0d, 0x00, 0x01, 0x1e, 0x39, 0x4e, 0x54, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x45, 0x2c,
+  0x10, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x9b, 0xa7, 0xb2, 0xbe, 0xbe,
+  0xb0, 0xa3, 0x97, 0x8b, 0x7a, 0x6e, 0x62, 0x55, 0x47, 0x3b, 0x26, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xac,
+  0xb7, 0xc1, 0xc9, 0xbf, 0xb4, 0xa9, 0x9e, 0x94, 0x84, 0x6f, 0x59, 0x41,
+  0x27, 0x0b, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c,
+  0x78, 0x64, 0x88, 0xa8, 0xc7, 0xc8, 0xa8, 0x89, 0x6c, 0x68, 0x6c, 0x74,
+  0x84, 0xa4, 0xc3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x24, 0x42, 0x5f, 0x7c, 0x9d, 0xba, 0xd8, 0xbe, 0xa0,
+  0x84, 0x62, 0x50, 0x6e, 0x8e, 0xab, 0xc9, 0xcb, 0xae, 0x90, 0x70, 0x54,
+  0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xd5, 0xbe, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb7, 0xc1, 0xae, 0xa3, 0x91, 0x77, 0x5e, 0x44, 0x27, 0x0b, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xd0, 0xb8, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac,
+  0xac, 0xac, 0xac, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xac, 0xac, 0xac, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac, 0xac, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x00, 0x0b, 0x1b, 0x29, 0x35, 0x42, 0x4f, 0x5d, 0x69,
+  0x75, 0x84, 0x92, 0x9e, 0xab, 0xb7, 0xc5, 0xb0, 0x90, 0x6c, 0x4c, 0x2d,
+  0x0d, 0x00, 0x00, 0x0d, 0x22, 0x31, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x2b, 0x18, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xc4, 0xbb, 0xad, 0xa0, 0x94, 0x88,
+  0x78, 0x6b, 0x5e, 0x52, 0x45, 0x37, 0x2b, 0x1e, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd5, 0xc5,
+  0xad, 0xa1, 0x95, 0x8c, 0x84, 0x73, 0x67, 0x56, 0x42, 0x2c, 0x15, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x64,
+  0x88, 0xa7, 0xc5, 0xd0, 0xb4, 0x9c, 0x8c, 0x8c, 0x90, 0x94, 0x9e, 0xb0,
+  0xcb, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0x30, 0x4c, 0x6b, 0x8b, 0xa7, 0xc5, 0xd0, 0xb4, 0x95, 0x75, 0x58,
+  0x54, 0x63, 0x84, 0xa1, 0xbf, 0xd7, 0xb9, 0x9c, 0x7c, 0x5e, 0x41, 0x24,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc6, 0xa9, 0x92, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0x9b,
+  0xb0, 0xc8, 0xbe, 0xa7, 0x8d, 0x6e, 0x52, 0x35, 0x17, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc5, 0xa6, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xcb, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x19, 0x25, 0x32, 0x3f, 0x4c, 0x59, 0x65,
+  0x72, 0x84, 0x8e, 0x9b, 0xa7, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00,
+  0x00, 0x00, 0x07, 0x12, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
+  0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0e, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xab, 0x9d, 0x90, 0x84, 0x75, 0x68, 0x5b, 0x4e,
+  0x42, 0x35, 0x27, 0x1b, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb8, 0xb8, 0xb8, 0x9c, 0x84,
+  0x77, 0x6c, 0x62, 0x57, 0x4b, 0x3b, 0x2a, 0x15, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x60, 0x7c, 0x9d,
+  0xb9, 0xd1, 0xc9, 0xb5, 0xac, 0xac, 0xae, 0xb4, 0xa8, 0xae, 0xc4, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3b,
+  0x59, 0x75, 0x95, 0xb2, 0xd0, 0xcb, 0xac, 0x8c, 0x74, 0x74, 0x74, 0x74,
+  0x77, 0x98, 0xb8, 0xd7, 0xc4, 0xa7, 0x89, 0x6b, 0x4c, 0x2e, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x70, 0x84, 0x9d, 0xba,
+  0xd3, 0xb7, 0x9b, 0x7a, 0x5c, 0x3d, 0x1f, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x63, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb0, 0xb0,
+  0xb0, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb0, 0xb2, 0xc3, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x16, 0x22, 0x2e, 0x3c, 0x49, 0x55, 0x62,
+  0x70, 0x7c, 0x8b, 0x97, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0x9b, 0x8d, 0x7c, 0x72, 0x65, 0x58, 0x4b, 0x3e, 0x32, 0x24, 0x17,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x78, 0x59, 0x4e,
+  0x44, 0x39, 0x2d, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xbc, 0x9c, 0x78, 0x58, 0x72, 0x8e, 0xa5, 0xb7,
+  0xc0, 0xc0, 0xbd, 0xb4, 0xa9, 0x99, 0x89, 0x97, 0xb5, 0xb8, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x28, 0x46, 0x63, 0x84,
+  0xa1, 0xbe, 0xdc, 0xcf, 0xb2, 0x9b, 0x98, 0x98, 0x98, 0x98, 0x98, 0xa2,
+  0xbc, 0xdb, 0xd0, 0xb2, 0x94, 0x75, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x54, 0x72, 0x94, 0xb4, 0xd3, 0xc1,
+  0xa3, 0x84, 0x63, 0x44, 0x24, 0x05, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x19, 0x19, 0x19, 0x1c, 0x1d,
+  0x1f, 0x21, 0x23, 0x25, 0x24, 0x1b, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x21,
+  0x21, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x37,
+  0x21, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90,
+  0x96, 0xb2, 0xa2, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x1e, 0x2c, 0x39, 0x45, 0x52, 0x5f,
+  0x6c, 0x78, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8b, 0x7a,
+  0x6e, 0x62, 0x55, 0x47, 0x3b, 0x2e, 0x22, 0x14, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b,
+  0x5a, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x72, 0x57, 0x38, 0x25, 0x1c,
+  0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xca, 0xbc, 0x9c, 0x78, 0x58, 0x5e, 0x75, 0x8b, 0x99, 0xa0, 0xa0,
+  0x9e, 0x95, 0x8c, 0x7c, 0x70, 0x90, 0x98, 0x98, 0x98, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x16, 0x33, 0x52, 0x6e, 0x8e, 0xac, 0xc9,
+  0xe3, 0xd4, 0xc7, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0xcf, 0xd9,
+  0xdb, 0xbe, 0xa0, 0x84, 0x63, 0x45, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x35, 0x39, 0x39, 0x39, 0x3b, 0x3d, 0x3f, 0x41,
+  0x42, 0x44, 0x43, 0x36, 0x20, 0x05, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x41, 0x41, 0x41, 0x42,
+  0x57, 0x74, 0x95, 0xb4, 0xd4, 0xc5, 0xa6, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x39,
+  0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5e,
+  0x41, 0x23, 0x03, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x75, 0x94, 0xab,
+  0x91, 0x75, 0x59, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0e, 0x1c, 0x29, 0x35, 0x42, 0x4f, 0x5d,
+  0x69, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x26, 0x45, 0x61, 0x6b, 0x5e, 0x52, 0x45,
+  0x37, 0x2b, 0x1e, 0x11, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x67, 0x52, 0x35, 0x16, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x64, 0x88, 0xa8, 0xc6,
+  0xbc, 0x9d, 0x7c, 0x60, 0x4c, 0x5e, 0x6e, 0x78, 0x7c, 0x7c, 0x7c, 0x75,
+  0x6c, 0x60, 0x67, 0x74, 0x74, 0x74, 0x74, 0x74, 0x5e, 0x3f, 0x20, 0x00,
+  0x00, 0x00, 0x04, 0x22, 0x3f, 0x5d, 0x78, 0x99, 0xb7, 0xd4, 0xcc, 0xb7,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xbe, 0xd6, 0xc9,
+  0xab, 0x8d, 0x6e, 0x50, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x63, 0x77, 0x97, 0xb5, 0xd4, 0xc6, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xca, 0xcf, 0xb0, 0x90,
+  0x70, 0x57, 0x54, 0x58, 0x58, 0x58, 0x59, 0x5c, 0x5d, 0x60, 0x60, 0x64,
+  0x62, 0x4c, 0x30, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x6b, 0x84,
+  0x9e, 0xbc, 0xdb, 0xc0, 0xa1, 0x84, 0x60, 0x41, 0x22, 0x03, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x53, 0x39, 0x1c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x21, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x45, 0x31, 0x17,
+  0x00, 0x00, 0x05, 0x21, 0x3a, 0x4b, 0x67, 0x86, 0xa2, 0x9b, 0x7c, 0x63,
+  0x49, 0x2e, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x19, 0x25, 0x32, 0x3f, 0x4b, 0x49,
+  0x37, 0x1e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x34, 0x47, 0x4c, 0x42, 0x35, 0x27, 0x1b, 0x0e,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x60, 0x84, 0xa1, 0xbf, 0xc5, 0xa9,
+  0x8e, 0x75, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x70, 0x70, 0x70, 0x74, 0x74,
+  0x78, 0x78, 0x7a, 0x64, 0x54, 0x54, 0x4a, 0x33, 0x17, 0x00, 0x00, 0x00,
+  0x0f, 0x2d, 0x4a, 0x68, 0x88, 0xa5, 0xc2, 0xd9, 0xbb, 0x9f, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x92, 0xab, 0xc8, 0xd3, 0xb6, 0x98,
+  0x78, 0x5b, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x8e, 0xa5, 0xc0, 0xdd, 0xc1, 0xa3, 0x84, 0x60, 0x42, 0x23, 0x04,
+  0x08, 0x27, 0x46, 0x64, 0x88, 0xa8, 0xc6, 0xd6, 0xb7, 0x9b, 0x84, 0x74,
+  0x74, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c, 0x84, 0x84, 0x88, 0x74, 0x54,
+  0x35, 0x15, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4,
+  0xa4, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x89, 0x99, 0xb0, 0xc9,
+  0xd3, 0xb7, 0x99, 0x78, 0x5a, 0x3b, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x20,
+  0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x28, 0x1a, 0x04, 0x00, 0x00,
+  0x00, 0x1c, 0x3b, 0x59, 0x75, 0x94, 0x98, 0x89, 0x6c, 0x53, 0x37, 0x1d,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x16, 0x22, 0x2c, 0x2a, 0x1e, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x1c, 0x29, 0x2c, 0x24, 0x17, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xac, 0xac, 0xac,
+  0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3b, 0x59, 0x77, 0x95, 0xb2, 0xcc, 0xbb, 0xa5, 0x94,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x94, 0x94, 0x94, 0x98, 0x98, 0x98, 0x9c,
+  0x88, 0x64, 0x44, 0x35, 0x2e, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x1a, 0x37,
+  0x55, 0x73, 0x92, 0xb0, 0xce, 0xce, 0xb0, 0x94, 0x73, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x84, 0x9e, 0xbc, 0xdb, 0xc1, 0xa3, 0x88, 0x67,
+  0x49, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xcc, 0xb3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xab,
+  0xbb, 0xd1, 0xd3, 0xb7, 0x9b, 0x7a, 0x5c, 0x3d, 0x1f, 0x00, 0x04, 0x23,
+  0x42, 0x60, 0x84, 0xa0, 0xbe, 0xdb, 0xc7, 0xb0, 0x9e, 0x98, 0x98, 0x98,
+  0x9c, 0x9c, 0x9c, 0xa0, 0xa0, 0xa4, 0xa4, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xcc, 0xb3, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa8, 0xb4, 0xc6, 0xd6, 0xc1, 0xa8,
+  0x8d, 0x6e, 0x52, 0x33, 0x15, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xcc, 0xb3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x3b, 0x5a, 0x73, 0x74, 0x74, 0x73, 0x5d, 0x41, 0x27, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0b, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcb, 0xbc, 0x9c, 0x78,
+  0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x30, 0x4c, 0x69, 0x86, 0x9f, 0xb5, 0xc7, 0xbe, 0xb2, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb2, 0xb4, 0xb4, 0xb6, 0xb8, 0xb8, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x10, 0x03, 0x00, 0x00, 0x00, 0x07, 0x25, 0x42, 0x60, 0x7c,
+  0x9d, 0xbb, 0xcf, 0xc3, 0xa6, 0x88, 0x68, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x57, 0x74, 0x94, 0xb2, 0xcf, 0xcd, 0xae, 0x92, 0x72, 0x54, 0x37,
+  0x19, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xcf,
+  0xcc, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc9, 0xcc, 0xc8,
+  0xbb, 0xa7, 0x8d, 0x6e, 0x52, 0x35, 0x17, 0x00, 0x00, 0x1c, 0x3b, 0x59,
+  0x75, 0x94, 0xb0, 0xc4, 0xd2, 0xc9, 0xbc, 0xb8, 0xb8, 0xb8, 0xbc, 0xbc,
+  0xbc, 0xbf, 0xc0, 0xc3, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xcf, 0xcc, 0xc4, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xcc, 0xc5, 0xbb, 0xaa, 0x94, 0x7a, 0x60,
+  0x44, 0x27, 0x0b, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf,
+  0xcf, 0xcc, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x48,
+  0x54, 0x54, 0x54, 0x54, 0x48, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0x9c, 0x78, 0x58, 0x39,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x22,
+  0x3e, 0x58, 0x70, 0x89, 0x9c, 0xa9, 0xb4, 0xb8, 0xba, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb4, 0xb4, 0xb2, 0xb0, 0xac, 0xac, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x4e, 0x6c, 0x8b, 0xa8, 0xb0,
+  0xb0, 0xb0, 0x9b, 0x7a, 0x5e, 0x40, 0x2d, 0x2d, 0x2d, 0x2d, 0x2e, 0x4c,
+  0x69, 0x89, 0xa7, 0xb0, 0xb0, 0xb0, 0x9d, 0x7c, 0x5f, 0x42, 0x24, 0x06,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xad, 0xa8, 0x9e, 0x8e,
+  0x77, 0x5e, 0x44, 0x27, 0x0b, 0x00, 0x00, 0x12, 0x2e, 0x4b, 0x67, 0x84,
+  0x99, 0xa9, 0xb4, 0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb7, 0xb4, 0xb4, 0xb0,
+  0xb0, 0xac, 0xa8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xac, 0xa7, 0x9e, 0x90, 0x7a, 0x67, 0x4d, 0x34, 0x19,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x2d, 0x34, 0x35,
+  0x35, 0x34, 0x2d, 0x1b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x44,
+  0x5b, 0x6e, 0x7c, 0x8c, 0x94, 0x98, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x94,
+  0x94, 0x94, 0x90, 0x8e, 0x8c, 0x88, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0x38, 0x58, 0x77, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x70, 0x53, 0x35, 0x17, 0x0d, 0x0d, 0x0d, 0x23, 0x41, 0x5f, 0x7c,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x8b, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8b, 0x84, 0x72, 0x61, 0x4b,
+  0x33, 0x19, 0x00, 0x00, 0x00, 0x04, 0x20, 0x3c, 0x53, 0x6a, 0x7c, 0x8c,
+  0x94, 0x98, 0x9c, 0x98, 0x98, 0x98, 0x98, 0x94, 0x94, 0x90, 0x90, 0x8c,
+  0x89, 0x88, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x8d, 0x88, 0x7c, 0x72, 0x62, 0x4e, 0x3a, 0x21, 0x08, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x15, 0x15, 0x15, 0x15,
+  0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54, 0x36, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2e, 0x42, 0x54,
+  0x62, 0x6c, 0x73, 0x74, 0x78, 0x77, 0x74, 0x74, 0x74, 0x74, 0x70, 0x70,
+  0x6c, 0x6c, 0x68, 0x67, 0x64, 0x59, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x36, 0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x64,
+  0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x19, 0x36, 0x54, 0x6b, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x64, 0x49, 0x2a, 0x0b, 0x00, 0x00, 0x13, 0x32,
+  0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x68, 0x62, 0x55, 0x47, 0x34, 0x1e, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3d, 0x50, 0x60, 0x6c, 0x73, 0x74,
+  0x78, 0x75, 0x74, 0x74, 0x74, 0x70, 0x70, 0x6c, 0x6c, 0x68, 0x68, 0x64,
+  0x60, 0x4a, 0x2e, 0x10, 0x00, 0x00, 0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x68, 0x60, 0x55, 0x47, 0x36, 0x22, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x28, 0x37, 0x44, 0x4e,
+  0x54, 0x54, 0x58, 0x58, 0x54, 0x54, 0x54, 0x54, 0x50, 0x50, 0x4c, 0x4c,
+  0x48, 0x48, 0x44, 0x3e, 0x2c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x28, 0x3f, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x49, 0x37, 0x1e,
+  0x02, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x3f, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x49, 0x37, 0x1e, 0x02, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x48, 0x43, 0x39, 0x2b, 0x1b, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x25, 0x35, 0x44, 0x4e, 0x54, 0x54, 0x58, 0x58,
+  0x54, 0x54, 0x54, 0x52, 0x50, 0x4f, 0x4c, 0x4a, 0x48, 0x44, 0x42, 0x34,
+  0x1d, 0x03, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x48, 0x41,
+  0x38, 0x2b, 0x1c, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c,
+  0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2c, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x1b, 0x25, 0x2f, 0x34, 0x36,
+  0x39, 0x38, 0x35, 0x35, 0x35, 0x35, 0x31, 0x31, 0x2e, 0x2d, 0x29, 0x28,
+  0x25, 0x21, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24,
+  0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2a, 0x1e, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x24, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2a, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x29, 0x24, 0x1c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x19, 0x25, 0x2f, 0x34, 0x36, 0x39, 0x38, 0x35, 0x35,
+  0x35, 0x33, 0x31, 0x30, 0x2d, 0x2b, 0x29, 0x25, 0x23, 0x19, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x23, 0x1a, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x15, 0x17, 0x19, 0x19,
+  0x15, 0x15, 0x15, 0x15, 0x11, 0x11, 0x0f, 0x0d, 0x0a, 0x09, 0x05, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x10, 0x15, 0x17, 0x19, 0x19, 0x15, 0x15, 0x15, 0x14,
+  0x11, 0x10, 0x0d, 0x0c, 0x09, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x15, 0x1a,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14,
+  0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00,
+  0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x0a,
+  0x18, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x15, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1b, 0x10, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x15, 0x1f, 0x24, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x25, 0x20, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x14, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d, 0x2b, 0x33, 0x39, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b,
+  0x30, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x08, 0x21, 0x34,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x34, 0x21, 0x08, 0x00, 0x00,
+  0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3c, 0x34, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x37, 0x26, 0x0e, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x0c, 0x23, 0x35, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x00, 0x01,
+  0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3a, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x32,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x00, 0x00,
+  0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b,
+  0x15, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c,
+  0x34, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x25, 0x33, 0x3d,
+  0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x44, 0x3f, 0x36, 0x29, 0x1b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x33, 0x29, 0x1d, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x48,
+  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x28, 0x39, 0x47, 0x52, 0x58, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x34, 0x17, 0x00, 0x00, 0x0b, 0x29,
+  0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x4d, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x48,
+  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x53,
+  0x3b, 0x1e, 0x00, 0x00, 0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x01, 0x1d, 0x38, 0x50, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00, 0x0f, 0x2d, 0x48,
+  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x57, 0x42,
+  0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x32, 0x4b, 0x5b, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x0f, 0x2d,
+  0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x57, 0x42, 0x29, 0x0d,
+  0x17, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x34,
+  0x17, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x30, 0x42, 0x50, 0x5b, 0x63, 0x67,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x64, 0x5e,
+  0x54, 0x45, 0x34, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x48,
+  0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x52, 0x47, 0x38, 0x26, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x11,
+  0x29, 0x3f, 0x54, 0x63, 0x70, 0x78, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x60, 0x40, 0x21, 0x01, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a,
+  0x5c, 0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x60, 0x40, 0x21, 0x10, 0x2d, 0x48, 0x63, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34,
+  0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6e, 0x54, 0x37, 0x1b,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x40, 0x5d, 0x77, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x34, 0x54, 0x73,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6f, 0x54, 0x38, 0x1d, 0x1d, 0x3c,
+  0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x5c, 0x3c, 0x1d, 0x00,
+  0x00, 0x00, 0x16, 0x30, 0x48, 0x5b, 0x6c, 0x78, 0x84, 0x88, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x86, 0x7c, 0x70, 0x61,
+  0x4d, 0x35, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x78, 0x70, 0x63, 0x53, 0x3d, 0x26, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x05, 0x22, 0x3d, 0x56,
+  0x6c, 0x84, 0x90, 0x99, 0x9e, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41,
+  0x21, 0x20, 0x3c, 0x57, 0x73, 0x90, 0xa0, 0xa0, 0xa0, 0xa0, 0x90, 0x72,
+  0x57, 0x3b, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0,
+  0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c, 0x7c, 0x62, 0x45, 0x2b, 0x0e, 0x00,
+  0x00, 0x00, 0x17, 0x34, 0x50, 0x6b, 0x89, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0,
+  0xa0, 0xa0, 0xa0, 0x9d, 0x7c, 0x63, 0x48, 0x2d, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x09,
+  0x25, 0x42, 0x5b, 0x75, 0x8b, 0x99, 0xa3, 0xa8, 0xac, 0xac, 0xac, 0xac,
+  0xac, 0xac, 0xac, 0xac, 0xac, 0xa8, 0xa4, 0x9c, 0x8e, 0x78, 0x61, 0x49,
+  0x2d, 0x10, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e,
+  0x98, 0x90, 0x7c, 0x6a, 0x53, 0x3b, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x13, 0x30, 0x4c, 0x69, 0x86, 0x9c,
+  0xac, 0xb7, 0xbd, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x30,
+  0x4b, 0x67, 0x84, 0xa0, 0xbc, 0xc0, 0xb7, 0x9b, 0x7c, 0x62, 0x47, 0x2b,
+  0x10, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xc0, 0xc0, 0xc0, 0xab, 0x8e, 0x72, 0x55, 0x39, 0x1e, 0x02, 0x00, 0x0b,
+  0x27, 0x42, 0x5e, 0x7a, 0x97, 0xb4, 0xc0, 0xc0, 0xc0, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0,
+  0xc0, 0xac, 0x90, 0x73, 0x57, 0x3d, 0x20, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xc0, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x15, 0x33, 0x50,
+  0x6c, 0x8b, 0xa3, 0xb5, 0xc1, 0xc7, 0xcb, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xca, 0xc8, 0xc4, 0xb9, 0xa7, 0x91, 0x73, 0x57, 0x3b, 0x1d,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbd, 0xb7, 0xac,
+  0x99, 0x84, 0x67, 0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x1c, 0x3b, 0x59, 0x77, 0x95, 0xb0, 0xc8, 0xd6,
+  0xc5, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xb4, 0xb9, 0xcc, 0xdf,
+  0xd5, 0xbf, 0xb4, 0xb4, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb4, 0xb4, 0xb4, 0xb7, 0xc9, 0xdf,
+  0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x24, 0x40, 0x5b, 0x77,
+  0x94, 0xb0, 0xcb, 0xc2, 0xa7, 0x8b, 0x6e, 0x53, 0x37, 0x1c, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xdf,
+  0xd5, 0xb9, 0x9e, 0x84, 0x64, 0x49, 0x2d, 0x10, 0x00, 0x1a, 0x35, 0x52,
+  0x6c, 0x8b, 0xa7, 0xc3, 0xde, 0xdf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xdf, 0xd7, 0xbc,
+  0xa0, 0x86, 0x67, 0x4c, 0x30, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x1f, 0x3d, 0x5b, 0x78, 0x99,
+  0xb5, 0xcf, 0xd4, 0xbe, 0xae, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xac, 0xb9, 0xcf, 0xd4, 0xbc, 0xa0, 0x84, 0x63, 0x44, 0x25, 0x07, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb9, 0xc8, 0xd5, 0xc6, 0xae, 0x94,
+  0x73, 0x57, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x04, 0x23, 0x42, 0x60, 0x84, 0xa0, 0xbf, 0xdc, 0xc5, 0xad, 0x9b,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0x94, 0x94, 0x9f, 0xbb, 0xda, 0xc6, 0xa9,
+  0x94, 0x94, 0x94, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x94, 0x94, 0x94, 0x94, 0x9c, 0xb7, 0xd6, 0xc7, 0xa8,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x34, 0x50, 0x6b, 0x89, 0xa3, 0xbf,
+  0xce, 0xb4, 0x97, 0x7a, 0x5e, 0x43, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xf7, 0xe5, 0xc9,
+  0xac, 0x92, 0x73, 0x57, 0x3c, 0x20, 0x0d, 0x29, 0x45, 0x60, 0x7c, 0x9b,
+  0xb5, 0xd2, 0xee, 0xeb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xf7, 0xe7, 0xcb, 0xb0, 0x94,
+  0x77, 0x5b, 0x40, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x24, 0x44, 0x63, 0x84, 0xa3, 0xc1, 0xdc,
+  0xc0, 0xa7, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8e, 0xa2,
+  0xb9, 0xd5, 0xc8, 0xa9, 0x8c, 0x69, 0x4b, 0x2c, 0x0c, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x9d, 0xb0, 0xc8, 0xd9, 0xbc, 0x9d, 0x7c, 0x5e,
+  0x3f, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x3f, 0x1f, 0x00, 0x07,
+  0x26, 0x45, 0x64, 0x88, 0xa8, 0xc6, 0xd6, 0xb7, 0x9b, 0x7c, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6a, 0x50, 0x32,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x05, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x10, 0x2f,
+  0x4e, 0x6a, 0x70, 0x70, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70,
+  0x70, 0x70, 0x59, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x14, 0x33, 0x52,
+  0x6c, 0x70, 0x70, 0x70, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x44, 0x5e, 0x7a, 0x97, 0xb4, 0xce, 0xbf, 0xa3,
+  0x89, 0x6b, 0x4e, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xf7, 0xf3, 0xd8, 0xbc, 0xa0,
+  0x84, 0x67, 0x4b, 0x2e, 0x1d, 0x37, 0x54, 0x70, 0x8e, 0xa9, 0xc5, 0xe1,
+  0xfc, 0xeb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xf7, 0xf7, 0xdb, 0xc0, 0xa3, 0x89, 0x6b,
+  0x50, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x28, 0x48, 0x67, 0x88, 0xa8, 0xc7, 0xd4, 0xb4, 0x95,
+  0x77, 0x67, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x72, 0x90, 0xad, 0xcc,
+  0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x84, 0x9d, 0xba, 0xd8, 0xc3, 0xa4, 0x84, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x47, 0x31, 0x16, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xab, 0xc9, 0xcf, 0xb0, 0x90, 0x70, 0x52, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3d, 0x25, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x25, 0x25, 0x25, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e,
+  0x50, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50,
+  0x44, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x3f, 0x4f, 0x50,
+  0x50, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x53, 0x6e, 0x8d, 0xa7, 0xc3, 0xcb, 0xb0, 0x94, 0x77, 0x5b,
+  0x40, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xf7, 0xff, 0xe7, 0xcb, 0xb0, 0x94, 0x75,
+  0x59, 0x3e, 0x2b, 0x47, 0x63, 0x7c, 0x9d, 0xb9, 0xd4, 0xf0, 0xff, 0xeb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xf7, 0xed, 0xe7, 0xcf, 0xb4, 0x99, 0x7a, 0x60, 0x44,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6e, 0x50,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0x89, 0xa8, 0xc8, 0xd1, 0xb2,
+  0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50, 0x50, 0x54,
+  0x72, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x2b, 0x1a, 0x04, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x29, 0x27, 0x1d, 0x0a, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x10, 0x23, 0x2f, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x31, 0x29, 0x18,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x25, 0x30, 0x31, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x47,
+  0x62, 0x7c, 0x9b, 0xb7, 0xd3, 0xbb, 0xa0, 0x84, 0x67, 0x4b, 0x30, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xf7, 0xe9, 0xe3, 0xdb, 0xbe, 0xa2, 0x88, 0x69, 0x4c,
+  0x3b, 0x55, 0x72, 0x90, 0xab, 0xc7, 0xe3, 0xe4, 0xee, 0xeb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xe2, 0xd0, 0xc8, 0xcb, 0xc3, 0xa8, 0x8d, 0x6f, 0x54, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x25,
+  0x25, 0x25, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x31, 0x31, 0x31, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x34,
+  0x1d, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x31, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x37, 0x1f, 0x04, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x07, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x64, 0x64, 0x72, 0x90,
+  0xab, 0xc7, 0xc7, 0xab, 0x90, 0x72, 0x57, 0x3c, 0x20, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xdf, 0xcc, 0xc4, 0xc9, 0xcd, 0xb2, 0x95, 0x77, 0x5d, 0x49, 0x65,
+  0x84, 0x9e, 0xbb, 0xd3, 0xc5, 0xc5, 0xd3, 0xe8, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xce,
+  0xb5, 0xa8, 0xae, 0xc4, 0xb7, 0x9d, 0x7c, 0x63, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x05, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x11, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x49, 0x2c, 0x0d,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0,
+  0x90, 0x6c, 0x4c, 0x44, 0x5e, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x63, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa5, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0xa1, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc4, 0xa5, 0x89, 0x88, 0x88, 0x88, 0x9f, 0xbb, 0xd3,
+  0xb7, 0x9c, 0x7c, 0x63, 0x47, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xcc,
+  0xb3, 0xa4, 0xad, 0xc4, 0xc0, 0xa5, 0x89, 0x6b, 0x59, 0x73, 0x92, 0xae,
+  0xc9, 0xbc, 0xa7, 0xa7, 0xbc, 0xd7, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa5, 0x89,
+  0x99, 0xb5, 0xc7, 0xac, 0x90, 0x73, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44,
+  0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x2d, 0x2d, 0x2d, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc5, 0xa6, 0x8b, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c,
+  0x4c, 0x48, 0x68, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xce, 0xb5, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xb3, 0xcb, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xce, 0xb5, 0xa8, 0xa8, 0xa8, 0xa8, 0xb3, 0xcb, 0xc3, 0xa8, 0x8d,
+  0x6e, 0x54, 0x37, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86,
+  0x99, 0xb4, 0xd0, 0xb4, 0x97, 0x7a, 0x67, 0x86, 0xa2, 0xbc, 0xc7, 0xab,
+  0x90, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x89, 0xa5,
+  0xc0, 0xbc, 0xa0, 0x86, 0x67, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x54, 0x72, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xd0, 0xb8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa8, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x48,
+  0x68, 0x8c, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xe2, 0xd0, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xce,
+  0xe0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xe2,
+  0xd0, 0xc8, 0xc7, 0xc7, 0xc7, 0xce, 0xdb, 0xbc, 0x9c, 0x7a, 0x60, 0x44,
+  0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x89, 0xa5,
+  0xc0, 0xc3, 0xa7, 0x8b, 0x77, 0x94, 0xb0, 0xcc, 0xb7, 0x9c, 0x7c, 0x90,
+  0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x77, 0x95, 0xb0, 0xcb,
+  0xb0, 0x94, 0x77, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7,
+  0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x70, 0x7c, 0x9d, 0xba, 0xd8, 0xc3, 0xa4, 0x84, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xe5, 0xd2, 0xc8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x48, 0x68, 0x8c,
+  0xac, 0xb0, 0xb0, 0xb0, 0xbe, 0xcb, 0xcb, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd0, 0xb8,
+  0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xb6, 0xcd, 0xdf,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd0, 0xb8, 0xac,
+  0xac, 0xac, 0xac, 0xb6, 0xcd, 0xc2, 0xa5, 0x89, 0x6c, 0x50, 0x34, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x77, 0x95, 0xb0, 0xcc,
+  0xb5, 0x9b, 0x89, 0xa3, 0xbf, 0xc3, 0xa8, 0x8d, 0x6e, 0x90, 0xb0, 0xcf,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x69, 0x86, 0xa2, 0xbc, 0xc0, 0xa3,
+  0x89, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4,
+  0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc5, 0xa7, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x9b, 0xad, 0xc7, 0xdb, 0xbc, 0x9e, 0x7c, 0x5f, 0x40, 0x20, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xd0, 0xb8, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x48, 0x68, 0x8c, 0x90, 0x90,
+  0x90, 0x92, 0xab, 0xc9, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc5, 0xa6, 0x8d, 0x8c,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0xa2, 0xc1, 0xdf, 0xc0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc5, 0xa6, 0x8d, 0x8c, 0x8c,
+  0x8c, 0xa2, 0xbe, 0xd0, 0xb4, 0x99, 0x7a, 0x60, 0x44, 0x27, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x69, 0x86, 0xa2, 0xbd, 0xc7, 0xb0,
+  0xa8, 0xb5, 0xce, 0xb4, 0x99, 0x7a, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x73, 0x92, 0xac, 0xc9, 0xb4, 0x99, 0x7c,
+  0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xd3, 0xbc, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb7, 0xc5,
+  0xd8, 0xc9, 0xb0, 0x94, 0x74, 0x57, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc5, 0xa6,
+  0x8d, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c, 0x88,
+  0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x68, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x68, 0x68, 0x75, 0x92,
+  0xae, 0xcb, 0xc3, 0xa8, 0x8d, 0x6e, 0x53, 0x37, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x75, 0x92, 0xae, 0xc9, 0xcd, 0xc8, 0xd0,
+  0xc0, 0xa5, 0x89, 0x6c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x64, 0x84, 0x9d, 0xb9, 0xc3, 0xa8, 0x98, 0xa8, 0xc4,
+  0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xdf, 0xcc,
+  0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc0, 0xb9, 0xae,
+  0x9c, 0x84, 0x67, 0x4b, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x63, 0x4b, 0x2d, 0x0e,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0,
+  0x90, 0x6c, 0x4c, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x64, 0x88, 0xa8, 0xc7,
+  0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x00, 0x04, 0x16, 0x1f, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x1a, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x19, 0x1d, 0x19, 0x19, 0x19, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x4a, 0x65, 0x84, 0x9f, 0xbb,
+  0xd3, 0xb7, 0x9b, 0x7c, 0x62, 0x47, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20, 0x19,
+  0x09, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x65, 0x84, 0x9e, 0xb9, 0xd5, 0xdf, 0xcc, 0xb0, 0x95,
+  0x77, 0x5d, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x55, 0x70, 0x8e, 0xa9, 0xc4, 0xc0, 0xb8, 0xc0, 0xd4, 0xdf, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x15, 0x15, 0x15, 0x25, 0x44,
+  0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xcc, 0xb3, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa0, 0x9b, 0x92, 0x84, 0x6c,
+  0x56, 0x3c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x48, 0x48,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x37, 0x1f, 0x04, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c,
+  0x4c, 0x35, 0x35, 0x39, 0x39, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4,
+  0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x29, 0x29, 0x29, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x1a, 0x31, 0x3f, 0x41, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x40, 0x37, 0x23, 0x0a, 0x00, 0x00, 0x0e, 0x26, 0x37,
+  0x3c, 0x39, 0x39, 0x38, 0x35, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x57, 0x72, 0x90, 0xac, 0xc8, 0xc7,
+  0xab, 0x8e, 0x72, 0x55, 0x39, 0x1e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x35, 0x20, 0x07,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x55, 0x72, 0x8e, 0xab, 0xc0, 0xc0, 0xbd, 0xa2, 0x86, 0x69, 0x4c,
+  0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x45,
+  0x60, 0x7c, 0x99, 0xb5, 0xd0, 0xd7, 0xdd, 0xec, 0xdf, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x35, 0x35, 0x35, 0x35, 0x35, 0x46, 0x64, 0x88,
+  0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x78, 0x72, 0x65, 0x55, 0x3f, 0x29,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x27, 0x1d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xca, 0xcf, 0xb0, 0x90, 0x70, 0x57, 0x54,
+  0x54, 0x58, 0x58, 0x58, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x09, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x0c, 0x2b,
+  0x47, 0x5d, 0x60, 0x60, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x60, 0x60, 0x50, 0x35, 0x18, 0x00, 0x00, 0x1e, 0x3b, 0x53, 0x5c, 0x58,
+  0x58, 0x58, 0x54, 0x58, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x47, 0x63, 0x84, 0x9d, 0xb9, 0xd5, 0xbb, 0x9e,
+  0x84, 0x65, 0x49, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x4d, 0x32, 0x14, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x45,
+  0x62, 0x7c, 0x9b, 0xa0, 0xa0, 0xa0, 0x92, 0x75, 0x59, 0x4c, 0x6c, 0x90,
+  0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x50, 0x6c,
+  0x89, 0xa5, 0xc0, 0xdc, 0xf7, 0xff, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa9, 0xc8, 0xd0, 0xb1, 0x94,
+  0x70, 0x58, 0x54, 0x54, 0x54, 0x54, 0x54, 0x58, 0x6b, 0x8c, 0xac, 0xca,
+  0xcf, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x5f, 0x5b, 0x54, 0x49, 0x3b, 0x29, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46,
+  0x64, 0x88, 0xa8, 0xc6, 0xd6, 0xb7, 0x9b, 0x84, 0x74, 0x74, 0x74, 0x78,
+  0x78, 0x78, 0x78, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x84, 0x84, 0x84, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x84, 0x84, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7a, 0x78, 0x78, 0x75,
+  0x74, 0x75, 0x84, 0x9d, 0xb9, 0xd7, 0xc5, 0xa6, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x39, 0x54, 0x70, 0x8e, 0xa9, 0xc5, 0xc9, 0xad, 0x92, 0x73,
+  0x58, 0x3d, 0x20, 0x05, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x52, 0x6e,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x65, 0x49, 0x4c, 0x6c, 0x90, 0xb0, 0xcf,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x41, 0x5d, 0x77, 0x95,
+  0xb0, 0xcc, 0xe7, 0xff, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x07, 0x25, 0x44, 0x64, 0x88, 0xa6, 0xc5, 0xd7, 0xb9, 0x9d, 0x86, 0x77,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x7c, 0x97, 0xb4, 0xd0, 0xcc, 0xac,
+  0x8e, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x40, 0x3c, 0x35, 0x2c, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42, 0x60, 0x84,
+  0xa0, 0xbe, 0xdb, 0xc7, 0xb0, 0x9e, 0x98, 0x98, 0x98, 0x98, 0x9c, 0x9c,
+  0x9c, 0x9e, 0xb3, 0xce, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc0, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa4,
+  0xa4, 0xab, 0xc2, 0xde, 0xcc, 0xb3, 0xa4, 0xa4, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x9c, 0x9c, 0x98, 0x98, 0x98,
+  0x9e, 0xb0, 0xc9, 0xd9, 0xbc, 0xa0, 0x7c, 0x60, 0x40, 0x22, 0x03, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x29, 0x45, 0x61, 0x7c, 0x9b, 0xb6, 0xd2, 0xbc, 0xa0, 0x86, 0x67, 0x4c,
+  0x30, 0x14, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xcc, 0xb3, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0xa4, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x42, 0x57, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x50, 0x39, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x32, 0x4c, 0x69, 0x86, 0xa2, 0xbc,
+  0xd8, 0xef, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x03, 0x22,
+  0x40, 0x60, 0x7c, 0x9e, 0xbc, 0xd9, 0xc9, 0xb3, 0xa0, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x9e, 0xad, 0xc4, 0xde, 0xc3, 0xa6, 0x88, 0x67,
+  0x48, 0x28, 0x0a, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x20,
+  0x1c, 0x16, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x75, 0x94, 0xb0,
+  0xc4, 0xd2, 0xc9, 0xbc, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0xbc, 0xbc, 0xbd,
+  0xca, 0xca, 0xc7, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc3, 0xc8,
+  0xcf, 0xcf, 0xcf, 0xcc, 0xc4, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xbc, 0xb8, 0xb8, 0xb8, 0xbd, 0xca,
+  0xd1, 0xc4, 0xad, 0x94, 0x74, 0x57, 0x3a, 0x1b, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x35,
+  0x52, 0x6e, 0x8b, 0xa7, 0xc3, 0xcc, 0xb0, 0x94, 0x77, 0x5b, 0x3f, 0x24,
+  0x07, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xcf, 0xcc,
+  0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xbc, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xcf, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x2b, 0x3a, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x35, 0x2d, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x22, 0x3d, 0x59, 0x73, 0x92, 0xac, 0xc9, 0xcf,
+  0xcf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x1a, 0x38, 0x57,
+  0x73, 0x92, 0xad, 0xc2, 0xd0, 0xcb, 0xbe, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xbd, 0xc7, 0xd2, 0xc7, 0xb3, 0x99, 0x7a, 0x5e, 0x40, 0x22,
+  0x03, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4b, 0x67, 0x84, 0x99, 0xa9, 0xb4,
+  0xb8, 0xba, 0xb8, 0xb8, 0xb8, 0xb8, 0xb4, 0xb4, 0xb1, 0xb0, 0xac, 0xac,
+  0xa8, 0xa4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xb4, 0xb8, 0xb8, 0xb8, 0xba, 0xb8, 0xb2, 0xa9,
+  0x99, 0x84, 0x65, 0x4b, 0x2e, 0x10, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb0, 0xb0, 0xb0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x27, 0x42, 0x5e,
+  0x7a, 0x97, 0xb0, 0xb0, 0xb0, 0xa3, 0x88, 0x6b, 0x4e, 0x33, 0x17, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18,
+  0x2d, 0x4c, 0x6c, 0x90, 0xb0, 0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x2d, 0x49, 0x64, 0x84, 0x9d, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x10, 0x2d, 0x49, 0x65, 0x7c,
+  0x96, 0xa7, 0xb1, 0xb8, 0xb8, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xba, 0xb8, 0xb4, 0xa9, 0x9b, 0x86, 0x6b, 0x50, 0x34, 0x17, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x20, 0x3c, 0x53, 0x6a, 0x7c, 0x8c, 0x94, 0x98, 0x9c,
+  0x98, 0x98, 0x98, 0x98, 0x94, 0x94, 0x94, 0x90, 0x8d, 0x8c, 0x88, 0x84,
+  0x84, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x84, 0x60, 0x41, 0x21, 0x01, 0x1d, 0x3d, 0x5c,
+  0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0x94, 0x94, 0x98, 0x98, 0x98, 0x9c, 0x98, 0x94, 0x8c, 0x7c, 0x6a,
+  0x53, 0x39, 0x1f, 0x04, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x84, 0x60, 0x41, 0x21, 0x17, 0x34, 0x50, 0x6b, 0x89,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x5e, 0x3f, 0x20, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c,
+  0x6c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60, 0x41,
+  0x21, 0x1e, 0x39, 0x55, 0x70, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x02, 0x1e, 0x39, 0x50, 0x67, 0x7a, 0x8b,
+  0x94, 0x98, 0x99, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98,
+  0x94, 0x8d, 0x7c, 0x6c, 0x56, 0x3f, 0x25, 0x09, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50,
+  0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x26, 0x3d, 0x50, 0x60, 0x6c, 0x73, 0x74, 0x78, 0x77, 0x74,
+  0x74, 0x74, 0x74, 0x70, 0x70, 0x6c, 0x6c, 0x68, 0x64, 0x64, 0x60, 0x59,
+  0x44, 0x29, 0x0b, 0x00, 0x00, 0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x00, 0x0f, 0x2e,
+  0x4c, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x03, 0x23, 0x41, 0x5e, 0x6c, 0x70,
+  0x72, 0x74, 0x74, 0x74, 0x78, 0x74, 0x73, 0x6c, 0x60, 0x50, 0x3d, 0x26,
+  0x0e, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x09, 0x24, 0x40, 0x5b, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x00, 0x00, 0x13, 0x32, 0x50,
+  0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54, 0x36, 0x17, 0x00, 0x00,
+  0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2a, 0x49, 0x64, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x13, 0x32,
+  0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x0e,
+  0x29, 0x45, 0x5e, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x57, 0x3a,
+  0x1b, 0x00, 0x00, 0x00, 0x0d, 0x23, 0x3a, 0x4e, 0x5e, 0x6b, 0x70, 0x74,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x73, 0x6c,
+  0x62, 0x53, 0x3f, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50,
+  0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x25, 0x35, 0x44, 0x4e, 0x54, 0x54, 0x58, 0x58, 0x54, 0x54, 0x54,
+  0x54, 0x50, 0x50, 0x4c, 0x4c, 0x48, 0x46, 0x44, 0x41, 0x3b, 0x2d, 0x18,
+  0x00, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x43, 0x2e, 0x14, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x41, 0x2b, 0x10, 0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x41, 0x2b, 0x10, 0x00, 0x00, 0x17, 0x31, 0x45, 0x4c, 0x50, 0x54, 0x54,
+  0x54, 0x54, 0x58, 0x55, 0x54, 0x4c, 0x44, 0x35, 0x25, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x43, 0x2e, 0x14, 0x00, 0x15, 0x2f, 0x43, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3f, 0x28, 0x0d, 0x00, 0x00, 0x09, 0x25,
+  0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x37, 0x49, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x1a, 0x31,
+  0x45, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x41, 0x2b, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x22, 0x34, 0x42, 0x4c, 0x53, 0x54, 0x58, 0x58,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x54, 0x4e, 0x44, 0x37,
+  0x27, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x19, 0x25, 0x2f, 0x34, 0x36, 0x39, 0x38, 0x35, 0x35, 0x35, 0x35, 0x31,
+  0x31, 0x2d, 0x2d, 0x29, 0x27, 0x25, 0x21, 0x1d, 0x12, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27,
+  0x17, 0x01, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x15,
+  0x00, 0x00, 0x00, 0x04, 0x1a, 0x28, 0x2e, 0x31, 0x34, 0x35, 0x35, 0x36,
+  0x39, 0x37, 0x34, 0x2e, 0x25, 0x19, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17,
+  0x01, 0x00, 0x02, 0x17, 0x27, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x27, 0x17, 0x01, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2c, 0x24, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x1e, 0x2a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x29, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x05, 0x1a, 0x28, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x17, 0x24, 0x2d, 0x34, 0x35, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x34, 0x2f, 0x27, 0x1b, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x10, 0x15, 0x17, 0x19, 0x19, 0x15, 0x15, 0x15, 0x15, 0x11, 0x11, 0x0e,
+  0x0d, 0x09, 0x08, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x0f, 0x11, 0x15, 0x15, 0x15, 0x17, 0x19, 0x18,
+  0x15, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x0e, 0x14, 0x15, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x17, 0x15, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x15, 0x1f, 0x24, 0x28, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x25, 0x20, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x14,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x0f, 0x17, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x19, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x19,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x15, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x1c, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15,
+  0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b, 0x10, 0x00, 0x00, 0x00,
+  0x10, 0x1b, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00,
+  0x0c, 0x19, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x19,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1b,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x25,
+  0x33, 0x3d, 0x44, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+  0x48, 0x48, 0x44, 0x3f, 0x36, 0x29, 0x1b, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x39, 0x33, 0x29, 0x1d,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13,
+  0x22, 0x2d, 0x36, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x26, 0x37, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x34,
+  0x21, 0x08, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x00, 0x0e, 0x26, 0x37, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2d, 0x18, 0x00, 0x00, 0x00, 0x05, 0x1e,
+  0x32, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x1e, 0x32, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3a, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x05, 0x1e, 0x32, 0x3c, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15, 0x00, 0x15, 0x2b, 0x3a,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x30, 0x1b, 0x01, 0x0e, 0x26, 0x37,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x00,
+  0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x30,
+  0x1b, 0x02, 0x00, 0x03, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3b, 0x30, 0x1b, 0x01, 0x00, 0x00, 0x0e, 0x26, 0x37, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3c, 0x34, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3a, 0x2b, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1b, 0x30, 0x42, 0x50, 0x5b,
+  0x63, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68,
+  0x64, 0x5e, 0x54, 0x45, 0x34, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x58, 0x52, 0x47, 0x38, 0x26, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a, 0x2d, 0x3e, 0x4b,
+  0x54, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3b,
+  0x53, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x34, 0x17,
+  0x00, 0x00, 0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x50, 0x37, 0x1a, 0x00, 0x00, 0x1e, 0x3b, 0x53, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x59, 0x44, 0x29, 0x0b, 0x00, 0x00, 0x13, 0x30, 0x4b, 0x5b,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x57, 0x41, 0x25, 0x07, 0x00, 0x00,
+  0x00, 0x14, 0x30, 0x4b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x57,
+  0x41, 0x25, 0x07, 0x00, 0x00, 0x13, 0x30, 0x4b, 0x5b, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x57, 0x41, 0x25, 0x0a, 0x27, 0x42, 0x57, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d, 0x10, 0x1e, 0x3b, 0x53, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x37, 0x1a, 0x00, 0x00, 0x0f, 0x2d,
+  0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2e, 0x14,
+  0x00, 0x14, 0x30, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a,
+  0x48, 0x2d, 0x0f, 0x00, 0x00, 0x1e, 0x3b, 0x53, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x4d, 0x34, 0x17, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x45,
+  0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x57, 0x41, 0x25, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x30, 0x48, 0x5b, 0x6c, 0x78, 0x84, 0x88,
+  0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x89, 0x86, 0x7c,
+  0x70, 0x61, 0x4d, 0x35, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54,
+  0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x78, 0x70, 0x63, 0x53, 0x3d, 0x26, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x31, 0x47, 0x59, 0x69, 0x73, 0x78,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x5c, 0x3c, 0x1d, 0x00, 0x00,
+  0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40,
+  0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x19, 0x38, 0x58, 0x77, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x6c, 0x4e, 0x30, 0x11, 0x00, 0x00, 0x00, 0x1e,
+  0x3c, 0x5a, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6c, 0x4c, 0x2d,
+  0x0d, 0x00, 0x00, 0x19, 0x38, 0x58, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x6c, 0x4c, 0x2d, 0x12, 0x31, 0x50, 0x6e, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x73, 0x57, 0x38, 0x19, 0x26, 0x45, 0x64, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00, 0x15, 0x34, 0x54, 0x73,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x75, 0x5b, 0x3f, 0x25, 0x0a, 0x25,
+  0x40, 0x5b, 0x75, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34,
+  0x15, 0x00, 0x05, 0x25, 0x44, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7a, 0x5e, 0x42, 0x25, 0x09, 0x00, 0x00, 0x1d, 0x39, 0x55, 0x72, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x25, 0x42, 0x5b, 0x75, 0x8b, 0x99, 0xa3, 0xa8, 0xac, 0xac,
+  0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xa8, 0xa4, 0x9c, 0x8e, 0x78,
+  0x61, 0x49, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0x9e, 0x98, 0x90, 0x7c, 0x6a, 0x53, 0x3b, 0x20, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x2b, 0x45, 0x5e, 0x72, 0x88, 0x94, 0x9c, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x17, 0x36, 0x54, 0x70, 0x90, 0xa0, 0xa0, 0xa0,
+  0xa0, 0x95, 0x75, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x0a, 0x28, 0x46, 0x64,
+  0x84, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x65, 0x47, 0x29, 0x0a, 0x00,
+  0x00, 0x18, 0x37, 0x55, 0x73, 0x94, 0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0x72,
+  0x54, 0x35, 0x1a, 0x38, 0x58, 0x75, 0x97, 0xa0, 0xa0, 0xa0, 0x9d, 0x7c,
+  0x5f, 0x40, 0x22, 0x2d, 0x4c, 0x6c, 0x8c, 0xa0, 0xa0, 0xa0, 0xa0, 0x9c,
+  0x7a, 0x5c, 0x3d, 0x1f, 0x00, 0x00, 0x11, 0x30, 0x4c, 0x67, 0x84, 0x9e,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x88, 0x6b, 0x50, 0x35, 0x1b, 0x35, 0x50, 0x6c,
+  0x89, 0xa0, 0xa0, 0xa0, 0xa0, 0x9e, 0x84, 0x67, 0x4c, 0x30, 0x11, 0x00,
+  0x02, 0x21, 0x3e, 0x5b, 0x77, 0x95, 0xa0, 0xa0, 0xa0, 0xa0, 0x8b, 0x6c,
+  0x50, 0x34, 0x17, 0x00, 0x0e, 0x2b, 0x47, 0x63, 0x84, 0x9e, 0xa0, 0xa0,
+  0xa0, 0x9e, 0x84, 0x63, 0x47, 0x29, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x33, 0x50, 0x6c, 0x8b, 0xa3, 0xb5, 0xc1, 0xc7, 0xcb, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xca, 0xc8, 0xc4, 0xb9, 0xa7, 0x91, 0x73, 0x57,
+  0x3b, 0x1d, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xbd,
+  0xb7, 0xac, 0x99, 0x84, 0x67, 0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x39, 0x55, 0x72, 0x8b, 0xa2, 0xb1, 0xba, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc0, 0xc0, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x0d, 0x2b, 0x49, 0x65, 0x86, 0xa2, 0xc0, 0xc0, 0xbe, 0xa0,
+  0x84, 0x62, 0x45, 0x27, 0x09, 0x00, 0x15, 0x32, 0x50, 0x6e, 0x8e, 0xac,
+  0xc0, 0xc0, 0xb4, 0x97, 0x77, 0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x00, 0x0f,
+  0x2e, 0x4c, 0x6c, 0x8c, 0xa9, 0xc0, 0xc0, 0xb9, 0x9b, 0x78, 0x5a, 0x3b,
+  0x23, 0x41, 0x60, 0x7c, 0x9e, 0xbd, 0xc0, 0xc0, 0xa6, 0x88, 0x67, 0x48,
+  0x29, 0x35, 0x54, 0x72, 0x94, 0xb1, 0xc0, 0xc0, 0xb1, 0x94, 0x72, 0x54,
+  0x36, 0x17, 0x00, 0x00, 0x05, 0x21, 0x3c, 0x56, 0x70, 0x8e, 0xa8, 0xc0,
+  0xc0, 0xb3, 0x99, 0x7a, 0x60, 0x45, 0x2b, 0x45, 0x61, 0x7c, 0x99, 0xb4,
+  0xc0, 0xc0, 0xa8, 0x8d, 0x70, 0x56, 0x3c, 0x20, 0x05, 0x00, 0x00, 0x14,
+  0x30, 0x4c, 0x69, 0x88, 0xa2, 0xbe, 0xc0, 0xb5, 0x99, 0x7a, 0x5e, 0x42,
+  0x25, 0x07, 0x1c, 0x39, 0x55, 0x72, 0x90, 0xac, 0xc0, 0xc0, 0xab, 0x90,
+  0x72, 0x55, 0x39, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3d, 0x5b,
+  0x78, 0x99, 0xb5, 0xcf, 0xd4, 0xbe, 0xae, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xac, 0xb9, 0xcf, 0xd4, 0xbc, 0xa0, 0x84, 0x63, 0x44, 0x25,
+  0x07, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd5, 0xbf,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb9, 0xc8, 0xd5, 0xc6,
+  0xae, 0x94, 0x73, 0x57, 0x38, 0x19, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44,
+  0x62, 0x84, 0x9e, 0xb8, 0xcd, 0xd4, 0xc0, 0xb5, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb7, 0xc9, 0xdf, 0xd8, 0xc1, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x02, 0x1f, 0x3d, 0x5a, 0x78, 0x97, 0xb5, 0xd3, 0xc8, 0xab, 0x8d, 0x6c,
+  0x4f, 0x31, 0x13, 0x01, 0x1f, 0x3d, 0x5b, 0x78, 0x98, 0xb6, 0xd4, 0xc6,
+  0xa9, 0x8c, 0x6c, 0x4e, 0x31, 0x14, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44,
+  0x63, 0x84, 0xa2, 0xc1, 0xde, 0xc0, 0xa1, 0x84, 0x62, 0x43, 0x2b, 0x49,
+  0x68, 0x88, 0xa7, 0xc5, 0xdf, 0xcc, 0xad, 0x90, 0x70, 0x50, 0x32, 0x3b,
+  0x5a, 0x78, 0x9b, 0xb9, 0xd8, 0xc8, 0xa8, 0x8b, 0x6b, 0x4c, 0x2d, 0x0e,
+  0x00, 0x00, 0x00, 0x10, 0x2a, 0x45, 0x60, 0x7a, 0x96, 0xb2, 0xcc, 0xc3,
+  0xa9, 0x8e, 0x72, 0x56, 0x3c, 0x57, 0x72, 0x8e, 0xa9, 0xc4, 0xcc, 0xb0,
+  0x96, 0x7a, 0x60, 0x44, 0x2a, 0x10, 0x00, 0x00, 0x00, 0x05, 0x22, 0x3e,
+  0x5b, 0x75, 0x94, 0xb0, 0xcc, 0xc3, 0xa7, 0x8b, 0x6c, 0x4e, 0x32, 0x16,
+  0x29, 0x45, 0x62, 0x84, 0x9e, 0xbb, 0xd5, 0xb9, 0x9d, 0x7c, 0x63, 0x47,
+  0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x84, 0xa3,
+  0xc1, 0xdc, 0xc0, 0xa7, 0x92, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x8e, 0xa2, 0xb9, 0xd5, 0xc8, 0xa9, 0x8c, 0x69, 0x4b, 0x2c, 0x0c, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc6, 0xa9, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9d, 0xb0, 0xc8, 0xd9, 0xbc, 0x9d,
+  0x7c, 0x5e, 0x3f, 0x20, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x4c, 0x6b, 0x8c,
+  0xa9, 0xc8, 0xd9, 0xbe, 0xa7, 0x97, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9c, 0xb7,
+  0xd6, 0xca, 0xac, 0x95, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x14,
+  0x32, 0x4f, 0x6c, 0x8d, 0xa9, 0xc8, 0xd3, 0xb5, 0x97, 0x77, 0x59, 0x3b,
+  0x1d, 0x0b, 0x29, 0x47, 0x65, 0x86, 0xa3, 0xc1, 0xd9, 0xbb, 0x9e, 0x7c,
+  0x60, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x5b, 0x78,
+  0x99, 0xb8, 0xd7, 0xc8, 0xa8, 0x8b, 0x68, 0x4a, 0x33, 0x52, 0x70, 0x90,
+  0xae, 0xcd, 0xec, 0xd5, 0xb6, 0x98, 0x77, 0x58, 0x3a, 0x43, 0x62, 0x84,
+  0xa1, 0xc0, 0xdd, 0xbf, 0xa1, 0x84, 0x62, 0x43, 0x24, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x34, 0x4e, 0x69, 0x86, 0xa0, 0xbb, 0xd4, 0xb9, 0x9e,
+  0x84, 0x67, 0x4c, 0x67, 0x84, 0x9f, 0xb9, 0xd5, 0xbb, 0xa0, 0x86, 0x69,
+  0x4e, 0x34, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x4b, 0x67,
+  0x86, 0xa2, 0xbe, 0xd2, 0xb4, 0x97, 0x78, 0x5d, 0x40, 0x24, 0x37, 0x54,
+  0x70, 0x8e, 0xab, 0xc8, 0xc7, 0xab, 0x8e, 0x70, 0x54, 0x37, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x28, 0x48, 0x67, 0x88, 0xa8, 0xc7, 0xd4,
+  0xb4, 0x95, 0x77, 0x67, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x72, 0x90,
+  0xad, 0xcc, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x84, 0x9d, 0xba, 0xd8, 0xc3, 0xa4, 0x84, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x92, 0xb0, 0xd0,
+  0xcb, 0xae, 0x92, 0x77, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x5b, 0x3d, 0x1f, 0x00, 0x00, 0x00, 0x04, 0x23, 0x42,
+  0x60, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x59, 0x3b, 0x1c,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x09, 0x27, 0x44,
+  0x62, 0x84, 0x9e, 0xbc, 0xdb, 0xbf, 0xa1, 0x84, 0x63, 0x46, 0x28, 0x16,
+  0x33, 0x52, 0x70, 0x90, 0xad, 0xcb, 0xce, 0xb0, 0x94, 0x73, 0x55, 0x38,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x53, 0x70, 0x92, 0xb0,
+  0xce, 0xce, 0xb0, 0x90, 0x70, 0x52, 0x3b, 0x59, 0x78, 0x98, 0xb7, 0xd6,
+  0xf5, 0xdd, 0xbe, 0xa0, 0x84, 0x60, 0x42, 0x4a, 0x68, 0x8b, 0xa8, 0xc8,
+  0xd5, 0xb7, 0x98, 0x78, 0x59, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x22, 0x3e, 0x58, 0x72, 0x8e, 0xaa, 0xc4, 0xca, 0xae, 0x94, 0x77,
+  0x5d, 0x77, 0x94, 0xb0, 0xcb, 0xc4, 0xaa, 0x8e, 0x72, 0x58, 0x3d, 0x22,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x3d, 0x59, 0x75, 0x94,
+  0xb0, 0xcc, 0xc2, 0xa5, 0x89, 0x6b, 0x4e, 0x32, 0x45, 0x62, 0x7c, 0x9d,
+  0xb9, 0xd5, 0xb9, 0x9d, 0x7c, 0x62, 0x45, 0x29, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6e, 0x50, 0x44, 0x44, 0x44, 0x44, 0x44, 0x48, 0x68, 0x89, 0xa8, 0xc8,
+  0xd1, 0xb2, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x54, 0x72, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25,
+  0x05, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8,
+  0x88, 0x65, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x44, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x19, 0x34, 0x49, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x12, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x39, 0x57, 0x74,
+  0x94, 0xb1, 0xce, 0xc9, 0xac, 0x8e, 0x6e, 0x50, 0x32, 0x21, 0x3f, 0x5d,
+  0x78, 0x99, 0xb7, 0xd5, 0xc3, 0xa5, 0x88, 0x68, 0x4b, 0x2d, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x4a, 0x68, 0x89, 0xa8, 0xc6, 0xd6,
+  0xb7, 0x98, 0x77, 0x58, 0x43, 0x62, 0x84, 0xa1, 0xbf, 0xdd, 0xd7, 0xdc,
+  0xc6, 0xa8, 0x89, 0x68, 0x4a, 0x52, 0x70, 0x90, 0xb0, 0xce, 0xcd, 0xae,
+  0x90, 0x70, 0x52, 0x33, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x2c, 0x47, 0x62, 0x7c, 0x99, 0xb3, 0xce, 0xc0, 0xa5, 0x8b, 0x6c, 0x8b,
+  0xa5, 0xc0, 0xce, 0xb3, 0x99, 0x7c, 0x62, 0x47, 0x2c, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2e, 0x4b, 0x67, 0x86, 0xa2, 0xbc,
+  0xd0, 0xb4, 0x97, 0x78, 0x5d, 0x40, 0x54, 0x70, 0x8e, 0xab, 0xc7, 0xc5,
+  0xaa, 0x8e, 0x70, 0x54, 0x37, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x25, 0x25, 0x25, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4,
+  0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x31, 0x31, 0x31, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64,
+  0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x3d, 0x3a, 0x33, 0x31, 0x29,
+  0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1d, 0x2c, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x18, 0x01, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x4b, 0x69, 0x88, 0xa6,
+  0xc3, 0xd4, 0xb6, 0x98, 0x78, 0x5a, 0x3c, 0x2b, 0x49, 0x67, 0x88, 0xa5,
+  0xc2, 0xd5, 0xb7, 0x99, 0x7a, 0x5d, 0x3f, 0x22, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x23, 0x42, 0x60, 0x7c, 0xa0, 0xbe, 0xdd, 0xbe, 0xa0,
+  0x7c, 0x60, 0x4b, 0x69, 0x8b, 0xa8, 0xc8, 0xc2, 0xb8, 0xbe, 0xce, 0xb0,
+  0x92, 0x70, 0x53, 0x58, 0x77, 0x98, 0xb7, 0xd6, 0xc5, 0xa7, 0x88, 0x68,
+  0x49, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x36,
+  0x50, 0x6b, 0x88, 0xa2, 0xbd, 0xd0, 0xb5, 0x9b, 0x7c, 0x9b, 0xb5, 0xd0,
+  0xbd, 0xa2, 0x88, 0x6b, 0x50, 0x36, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x20, 0x3d, 0x59, 0x73, 0x92, 0xae, 0xcb, 0xc2,
+  0xa5, 0x89, 0x6b, 0x4c, 0x60, 0x7c, 0x9d, 0xb9, 0xd3, 0xb7, 0x9b, 0x7c,
+  0x62, 0x45, 0x29, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x05, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x19, 0x19, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc8, 0xa8, 0x8b, 0x6c, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x5c, 0x58, 0x52, 0x45, 0x36, 0x23, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x11,
+  0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x22, 0x40, 0x5e, 0x7a, 0x9b, 0xb9, 0xd5,
+  0xc0, 0xa2, 0x84, 0x64, 0x47, 0x35, 0x53, 0x70, 0x90, 0xae, 0xcd, 0xca,
+  0xac, 0x8e, 0x70, 0x52, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x3a, 0x58, 0x77, 0x97, 0xb5, 0xd4, 0xc5, 0xa7, 0x88, 0x67,
+  0x54, 0x72, 0x94, 0xb1, 0xc7, 0xab, 0x98, 0xa5, 0xc0, 0xb8, 0x99, 0x78,
+  0x5a, 0x60, 0x7c, 0xa0, 0xbe, 0xdc, 0xbd, 0x9e, 0x7c, 0x5f, 0x41, 0x23,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x3f, 0x5b,
+  0x75, 0x91, 0xab, 0xc7, 0xc5, 0xad, 0xa0, 0xad, 0xc7, 0xc7, 0xab, 0x91,
+  0x75, 0x5b, 0x3f, 0x25, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x2d, 0x49, 0x65, 0x84, 0xa0, 0xbc, 0xd0, 0xb2, 0x95,
+  0x77, 0x5b, 0x6e, 0x8d, 0xa9, 0xc6, 0xc5, 0xa9, 0x8d, 0x6e, 0x52, 0x36,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05,
+  0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x39, 0x39, 0x39, 0x39, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x90, 0xb0, 0xcf, 0xd0, 0xb4, 0x9c, 0x88, 0x84, 0x84, 0x84, 0x84,
+  0x84, 0x84, 0x7c, 0x7c, 0x78, 0x70, 0x62, 0x50, 0x3a, 0x23, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x70, 0x90, 0xad, 0xcb, 0xca, 0xac,
+  0x90, 0x70, 0x52, 0x40, 0x5e, 0x7a, 0x9b, 0xb9, 0xd7, 0xbf, 0xa1, 0x84,
+  0x64, 0x46, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x31, 0x50, 0x6e, 0x90, 0xad, 0xcb, 0xcc, 0xad, 0x90, 0x6e, 0x5b, 0x78,
+  0x9b, 0xb9, 0xbe, 0xa0, 0x7c, 0x98, 0xb6, 0xc0, 0xa2, 0x84, 0x63, 0x67,
+  0x88, 0xa7, 0xc5, 0xd3, 0xb4, 0x95, 0x75, 0x58, 0x38, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e, 0x49, 0x63, 0x7c,
+  0x9b, 0xb5, 0xcf, 0xc7, 0xc0, 0xc7, 0xcf, 0xb5, 0x9b, 0x7c, 0x63, 0x49,
+  0x2e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x1e, 0x3b, 0x57, 0x73, 0x92, 0xae, 0xcb, 0xc0, 0xa3, 0x88, 0x69,
+  0x7c, 0x9b, 0xb7, 0xd3, 0xb7, 0x9b, 0x7c, 0x60, 0x44, 0x27, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44,
+  0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x5b, 0x74, 0x94, 0xb4, 0xd3, 0xc7, 0xa8,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x0c, 0x2c, 0x4b, 0x69, 0x8b,
+  0xa8, 0xc6, 0xe0, 0xc9, 0xb3, 0xa5, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0xa0, 0xa0, 0x98, 0x8e, 0x7c, 0x67, 0x50, 0x35, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x29, 0x47, 0x65, 0x84, 0xa2, 0xbf, 0xd5, 0xb7, 0x99, 0x78,
+  0x5b, 0x4a, 0x68, 0x88, 0xa6, 0xc3, 0xd0, 0xb4, 0x95, 0x77, 0x59, 0x3b,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x47,
+  0x65, 0x88, 0xa5, 0xc4, 0xd4, 0xb4, 0x95, 0x74, 0x64, 0x84, 0xa3, 0xc1,
+  0xb5, 0x97, 0x75, 0x90, 0xad, 0xc8, 0xa9, 0x8c, 0x6b, 0x6e, 0x90, 0xad,
+  0xcc, 0xca, 0xac, 0x8e, 0x6c, 0x4f, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x37, 0x53, 0x6c, 0x89, 0xa3,
+  0xbf, 0xdb, 0xdf, 0xdb, 0xbf, 0xa3, 0x89, 0x6c, 0x53, 0x37, 0x1d, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x2d, 0x49, 0x65, 0x84, 0xa0, 0xbc, 0xce, 0xb2, 0x95, 0x77, 0x8d, 0xa9,
+  0xc5, 0xc4, 0xa9, 0x8d, 0x6e, 0x52, 0x35, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88,
+  0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x89, 0xa0, 0xbc, 0xdb, 0xc3, 0xa4, 0x84, 0x62,
+  0x43, 0x24, 0x04, 0x00, 0x00, 0x06, 0x24, 0x42, 0x60, 0x7c, 0x9c, 0xb5,
+  0xc9, 0xd4, 0xce, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc0, 0xbe,
+  0xb7, 0xaa, 0x96, 0x7c, 0x60, 0x44, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x1e, 0x3c, 0x59, 0x77, 0x97, 0xb4, 0xd2, 0xc1, 0xa3, 0x86, 0x65, 0x54,
+  0x72, 0x92, 0xb0, 0xce, 0xc5, 0xa8, 0x8b, 0x6b, 0x4e, 0x30, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x3f, 0x5e, 0x7c,
+  0x9c, 0xbb, 0xda, 0xbc, 0x9d, 0x7c, 0x6c, 0x8c, 0xab, 0xc9, 0xac, 0x8e,
+  0x6e, 0x88, 0xa6, 0xc4, 0xb2, 0x94, 0x73, 0x74, 0x95, 0xb4, 0xd4, 0xc3,
+  0xa4, 0x86, 0x64, 0x46, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0x27, 0x41, 0x5b, 0x77, 0x94, 0xb4, 0xd3,
+  0xf3, 0xd3, 0xb4, 0x94, 0x77, 0x5b, 0x41, 0x27, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x3b,
+  0x57, 0x73, 0x90, 0xac, 0xc9, 0xc0, 0xa3, 0x89, 0x9b, 0xb7, 0xd2, 0xb5,
+  0x99, 0x7c, 0x60, 0x44, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7,
+  0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc9, 0xad, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x9c, 0xa3, 0xb5, 0xcc, 0xd7, 0xba, 0x9c, 0x7c, 0x5d, 0x3f, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0x37, 0x54, 0x6e, 0x89, 0x9d, 0xac, 0xb4,
+  0xb9, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc2, 0xd4, 0xc3,
+  0xa9, 0x8d, 0x6e, 0x50, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31,
+  0x4e, 0x6c, 0x8c, 0xa9, 0xc6, 0xcb, 0xae, 0x90, 0x70, 0x5f, 0x7c, 0x9c,
+  0xba, 0xd8, 0xbb, 0x9d, 0x7c, 0x60, 0x42, 0x24, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x74, 0x94, 0xb4,
+  0xd2, 0xc4, 0xa4, 0x86, 0x74, 0x94, 0xb4, 0xc3, 0xa4, 0x86, 0x65, 0x7c,
+  0x9d, 0xbc, 0xba, 0x9c, 0x7a, 0x7c, 0x9d, 0xbc, 0xd9, 0xba, 0x9c, 0x7a,
+  0x5d, 0x3f, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x31, 0x4b, 0x65, 0x84, 0x9c, 0xb7, 0xd6, 0xef, 0xd6,
+  0xb7, 0x9c, 0x84, 0x65, 0x4b, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2d, 0x48, 0x63,
+  0x84, 0x9e, 0xbb, 0xce, 0xb5, 0xa8, 0xb0, 0xc7, 0xc3, 0xa7, 0x8b, 0x6c,
+  0x50, 0x35, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4,
+  0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xda, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xc0, 0xce, 0xce, 0xc1, 0xab, 0x90, 0x72, 0x54, 0x36, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x28, 0x42, 0x59, 0x6f, 0x84, 0x8e, 0x95, 0x9b, 0x9c,
+  0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa7, 0xc2, 0xd3, 0xb5, 0x97,
+  0x75, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44, 0x60,
+  0x7c, 0x9e, 0xbb, 0xd7, 0xb9, 0x9b, 0x7a, 0x69, 0x89, 0xa7, 0xc5, 0xcd,
+  0xb0, 0x92, 0x72, 0x55, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6c, 0x8c, 0xab, 0xc9, 0xca,
+  0xac, 0x8d, 0x7c, 0x9c, 0xbb, 0xba, 0x9c, 0x7c, 0x5d, 0x74, 0x94, 0xb4,
+  0xc3, 0xa4, 0x86, 0x86, 0xa4, 0xc4, 0xd0, 0xb1, 0x94, 0x73, 0x54, 0x36,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0x27, 0x42, 0x5d, 0x77, 0x94, 0xad, 0xc8, 0xd5, 0xcf, 0xd5, 0xc8, 0xad,
+  0x94, 0x77, 0x5d, 0x42, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x39, 0x55, 0x72, 0x90,
+  0xac, 0xc9, 0xd0, 0xc8, 0xcd, 0xd2, 0xb5, 0x99, 0x7a, 0x5e, 0x42, 0x25,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xda, 0xc4, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xc9, 0xdb, 0xde, 0xc4,
+  0xb0, 0xa5, 0x95, 0x7c, 0x63, 0x47, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x2c, 0x42, 0x55, 0x63, 0x6e, 0x74, 0x78, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x7a, 0x5c,
+  0x3c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x55, 0x73, 0x94,
+  0xb0, 0xce, 0xc3, 0xa5, 0x88, 0x73, 0x94, 0xb1, 0xcf, 0xc2, 0xa5, 0x88,
+  0x67, 0x4a, 0x2c, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x26, 0x45, 0x64, 0x84, 0xa2, 0xc1, 0xd1, 0xb2, 0x94,
+  0x88, 0xa5, 0xc4, 0xb2, 0x94, 0x73, 0x54, 0x6c, 0x8c, 0xab, 0xc9, 0xac,
+  0x8d, 0x8d, 0xac, 0xca, 0xc8, 0xa9, 0x8c, 0x6b, 0x4c, 0x2d, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1e, 0x38, 0x53,
+  0x6e, 0x8b, 0xa5, 0xbf, 0xcf, 0xb9, 0xb0, 0xb9, 0xcf, 0xbf, 0xa5, 0x8b,
+  0x6c, 0x53, 0x38, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x47, 0x63, 0x84, 0x9e, 0xbb,
+  0xd6, 0xe7, 0xde, 0xc3, 0xa7, 0x8b, 0x6c, 0x50, 0x34, 0x17, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x15, 0x15, 0x15,
+  0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc9, 0xad,
+  0x99, 0x98, 0x98, 0x98, 0x98, 0x9d, 0xb3, 0xce, 0xd4, 0xb5, 0x97, 0x89,
+  0x78, 0x67, 0x50, 0x37, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15,
+  0x22, 0x29, 0x39, 0x46, 0x50, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x15, 0x15, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2d, 0x4b, 0x68, 0x88, 0xa5, 0xc3,
+  0xcd, 0xae, 0x92, 0x7c, 0x9d, 0xbb, 0xd4, 0xb6, 0x99, 0x78, 0x5d, 0x3f,
+  0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0x3c, 0x5b, 0x78, 0x9b, 0xb9, 0xd7, 0xbc, 0xa2, 0x99, 0xae,
+  0xc8, 0xa9, 0x8c, 0x6b, 0x4c, 0x64, 0x84, 0xa2, 0xc1, 0xb5, 0x9d, 0x9d,
+  0xb5, 0xd3, 0xc0, 0xa1, 0x84, 0x62, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x4a, 0x64, 0x7c, 0x9b,
+  0xb6, 0xd0, 0xbd, 0xa2, 0x90, 0xa2, 0xbd, 0xd0, 0xb5, 0x9b, 0x7c, 0x64,
+  0x4a, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x55, 0x72, 0x90, 0xab, 0xc7, 0xe3,
+  0xd0, 0xb4, 0x97, 0x7a, 0x5e, 0x42, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x35, 0x35, 0x35, 0x35, 0x35, 0x46,
+  0x64, 0x88, 0xa8, 0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x74,
+  0x74, 0x74, 0x74, 0x88, 0xa3, 0xc0, 0xd5, 0xb6, 0x99, 0x7a, 0x60, 0x4d,
+  0x3a, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x40, 0x44,
+  0x44, 0x41, 0x41, 0x3f, 0x3d, 0x3d, 0x39, 0x39, 0x39, 0x39, 0x39, 0x58,
+  0x78, 0x9c, 0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x42, 0x35, 0x35, 0x35, 0x35, 0x46, 0x64, 0x88, 0xa8,
+  0xc7, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x22, 0x3f, 0x5d, 0x7a, 0x99, 0xb7, 0xd5, 0xba,
+  0x9d, 0x92, 0xa9, 0xc5, 0xc9, 0xab, 0x8e, 0x6e, 0x50, 0x33, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x35, 0x53, 0x70, 0x92, 0xb0, 0xcf, 0xcf, 0xbc, 0xb8, 0xc4, 0xc0, 0xa1,
+  0x84, 0x62, 0x44, 0x5b, 0x78, 0x9b, 0xb9, 0xc9, 0xba, 0xba, 0xc9, 0xd6,
+  0xb7, 0x99, 0x78, 0x5a, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x27, 0x41, 0x5b, 0x75, 0x92, 0xac, 0xc7, 0xc7,
+  0xac, 0x92, 0x75, 0x92, 0xac, 0xc7, 0xc7, 0xac, 0x92, 0x75, 0x5b, 0x41,
+  0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x2b, 0x47, 0x62, 0x7c, 0x9d, 0xba, 0xd9, 0xc5, 0xa6,
+  0x89, 0x6b, 0x50, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa9, 0xc8, 0xd0,
+  0xb1, 0x94, 0x70, 0x58, 0x54, 0x54, 0x54, 0x54, 0x54, 0x58, 0x6b, 0x8c,
+  0xac, 0xca, 0xcf, 0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x54, 0x54,
+  0x5b, 0x77, 0x94, 0xb0, 0xcc, 0xc3, 0xa9, 0x8d, 0x6f, 0x54, 0x38, 0x1d,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x42, 0x5b, 0x64, 0x64, 0x60,
+  0x60, 0x5d, 0x5c, 0x5c, 0x58, 0x58, 0x58, 0x57, 0x54, 0x5d, 0x7a, 0x9c,
+  0xbc, 0xdb, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x34, 0x54, 0x73, 0x94, 0xb4, 0xd3, 0xc6, 0xa8, 0x88,
+  0x67, 0x57, 0x54, 0x54, 0x54, 0x54, 0x58, 0x6b, 0x8c, 0xac, 0xca, 0xcf,
+  0xb0, 0x90, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x17, 0x34, 0x52, 0x70, 0x8e, 0xac, 0xca, 0xc9, 0xb5, 0xb0,
+  0xbe, 0xd5, 0xbe, 0xa0, 0x84, 0x63, 0x45, 0x28, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x4b,
+  0x69, 0x89, 0xa8, 0xc6, 0xe5, 0xdb, 0xd8, 0xd6, 0xb7, 0x98, 0x78, 0x5a,
+  0x3b, 0x53, 0x70, 0x92, 0xb0, 0xce, 0xd9, 0xd9, 0xe3, 0xce, 0xb0, 0x90,
+  0x70, 0x52, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x1e, 0x38, 0x53, 0x6c, 0x89, 0xa3, 0xbe, 0xd0, 0xb6, 0x9b, 0x7c,
+  0x64, 0x7c, 0x9b, 0xb6, 0xd0, 0xbe, 0xa3, 0x89, 0x6c, 0x53, 0x38, 0x1d,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x37, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x24, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x25, 0x44, 0x64, 0x88, 0xa6, 0xc5, 0xd7, 0xb9, 0x9d,
+  0x86, 0x77, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x7c, 0x97, 0xb4, 0xd0,
+  0xcc, 0xac, 0x8e, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x35, 0x4c, 0x67,
+  0x86, 0xa2, 0xbc, 0xd3, 0xb7, 0x9d, 0x7c, 0x63, 0x48, 0x2d, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88, 0x88, 0x84, 0x84, 0x7c,
+  0x7c, 0x7c, 0x78, 0x78, 0x78, 0x74, 0x74, 0x78, 0x8b, 0xa5, 0xc3, 0xda,
+  0xbb, 0x9c, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x92, 0xb0, 0xd0, 0xcd, 0xb0, 0x94, 0x7c, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x75, 0x7c, 0x97, 0xb4, 0xd0, 0xcc, 0xac, 0x8e,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x29, 0x46, 0x64, 0x84, 0xa1, 0xbf, 0xdc, 0xd3, 0xd0, 0xd9, 0xd0,
+  0xb2, 0x95, 0x75, 0x58, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x42, 0x60, 0x84,
+  0xa0, 0xbe, 0xdd, 0xf9, 0xec, 0xcd, 0xae, 0x90, 0x70, 0x52, 0x33, 0x4a,
+  0x68, 0x89, 0xa8, 0xc6, 0xe4, 0xf8, 0xe4, 0xc5, 0xa7, 0x88, 0x68, 0x4a,
+  0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2e,
+  0x49, 0x64, 0x7c, 0x9b, 0xb5, 0xcf, 0xc0, 0xa5, 0x8b, 0x6e, 0x53, 0x6e,
+  0x8b, 0xa5, 0xc0, 0xcf, 0xb5, 0x9b, 0x7c, 0x63, 0x49, 0x2e, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x22, 0x40, 0x60, 0x7c, 0x9e, 0xbc, 0xd9, 0xc9, 0xb3, 0xa0, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x9e, 0xad, 0xc4, 0xde, 0xc3, 0xa6,
+  0x88, 0x67, 0x48, 0x28, 0x0a, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x3d, 0x59, 0x73, 0x92,
+  0xae, 0xc9, 0xc7, 0xac, 0x90, 0x73, 0x57, 0x3d, 0x20, 0x05, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa5, 0xa4, 0xa4, 0xa0, 0xa0, 0x9e,
+  0x9c, 0x9c, 0x9c, 0x98, 0x98, 0x98, 0xa3, 0xb8, 0xd0, 0xd0, 0xb4, 0x94,
+  0x74, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c,
+  0x4c, 0x6b, 0x8c, 0xa9, 0xc7, 0xdb, 0xc1, 0xaa, 0x9c, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x9e, 0xad, 0xc4, 0xde, 0xc3, 0xa6, 0x88, 0x67, 0x48,
+  0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x3b, 0x59, 0x77, 0x95, 0xb4, 0xd0, 0xef, 0xef, 0xe2, 0xc5, 0xa7, 0x8b,
+  0x6b, 0x4c, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3a, 0x58, 0x77, 0x98, 0xb6,
+  0xd4, 0xef, 0xe3, 0xc5, 0xa6, 0x88, 0x68, 0x49, 0x2b, 0x42, 0x60, 0x7c,
+  0xa0, 0xbe, 0xdd, 0xef, 0xdc, 0xbd, 0x9e, 0x7c, 0x60, 0x41, 0x23, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x25, 0x40, 0x5b, 0x75,
+  0x92, 0xac, 0xc7, 0xc9, 0xae, 0x94, 0x77, 0x5d, 0x42, 0x5d, 0x77, 0x94,
+  0xae, 0xc9, 0xc7, 0xac, 0x91, 0x75, 0x5b, 0x40, 0x25, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x38, 0x57, 0x73, 0x92, 0xad, 0xc2, 0xd0, 0xcb, 0xbe, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xb8, 0xb8, 0xbd, 0xc7, 0xd2, 0xc7, 0xb3, 0x99, 0x7a, 0x5e,
+  0x40, 0x22, 0x03, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x2d, 0x49, 0x65, 0x84, 0x9e, 0xbb,
+  0xcf, 0xbc, 0xa0, 0x86, 0x67, 0x4c, 0x30, 0x15, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xc3, 0xc3, 0xc0, 0xc0, 0xbd, 0xbc, 0xbc,
+  0xbc, 0xb8, 0xb8, 0xb8, 0xc0, 0xcf, 0xce, 0xbe, 0xa5, 0x8b, 0x6b, 0x4e,
+  0x2f, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44, 0x62,
+  0x7c, 0x9c, 0xb5, 0xc9, 0xd3, 0xc5, 0xbc, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xbd, 0xc7, 0xd2, 0xc7, 0xb3, 0x99, 0x7a, 0x5e, 0x40, 0x22, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x30, 0x4e,
+  0x6b, 0x8b, 0xa8, 0xc5, 0xcf, 0xcf, 0xcf, 0xba, 0x9c, 0x7c, 0x5f, 0x42,
+  0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x6e, 0x90, 0xad, 0xcc, 0xcf,
+  0xcf, 0xbc, 0x9e, 0x7c, 0x5f, 0x40, 0x22, 0x3a, 0x58, 0x77, 0x97, 0xb5,
+  0xcf, 0xcf, 0xcf, 0xb5, 0x97, 0x75, 0x58, 0x38, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x37, 0x52, 0x6c, 0x89, 0xa2, 0xbd,
+  0xcf, 0xb8, 0x9e, 0x84, 0x67, 0x4c, 0x31, 0x4c, 0x67, 0x84, 0x9e, 0xb8,
+  0xcf, 0xbd, 0xa2, 0x89, 0x6c, 0x52, 0x37, 0x1d, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xcf, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2d, 0x49,
+  0x65, 0x7c, 0x96, 0xa7, 0xb1, 0xb8, 0xb8, 0xbc, 0xc3, 0xd7, 0xd7, 0xcf,
+  0xbf, 0xbc, 0xba, 0xb8, 0xb4, 0xa9, 0x9b, 0x86, 0x6b, 0x50, 0x34, 0x17,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x1e, 0x3b, 0x55, 0x72, 0x8e, 0xab, 0xb0, 0xb0,
+  0xb0, 0x94, 0x77, 0x5b, 0x40, 0x24, 0x06, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xa8, 0xac, 0xac, 0xb0, 0xb0, 0xb4, 0xb4, 0xb4, 0xb8, 0xb8,
+  0xb8, 0xb9, 0xb8, 0xb7, 0xb0, 0xa3, 0x91, 0x77, 0x5e, 0x42, 0x24, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb0, 0xb0, 0xb0, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x54, 0x6e, 0x89,
+  0x9d, 0xab, 0xb4, 0xb8, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xba,
+  0xb8, 0xb4, 0xa9, 0x9b, 0x86, 0x6b, 0x50, 0x34, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x42, 0x60, 0x7c,
+  0x9d, 0xb0, 0xb0, 0xb0, 0xb0, 0xae, 0x90, 0x72, 0x54, 0x36, 0x19, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x29, 0x48, 0x67, 0x88, 0xa6, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x95, 0x74, 0x57, 0x38, 0x1a, 0x31, 0x50, 0x6e, 0x8e, 0xac, 0xb0, 0xb0,
+  0xb0, 0xac, 0x8e, 0x6c, 0x4f, 0x31, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x2e, 0x49, 0x63, 0x7c, 0x99, 0xb0, 0xb0, 0xb0, 0xa7,
+  0x8d, 0x70, 0x55, 0x3b, 0x20, 0x3b, 0x55, 0x70, 0x8d, 0xa7, 0xb0, 0xb0,
+  0xb0, 0x99, 0x7c, 0x63, 0x49, 0x2e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0,
+  0xb0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x39, 0x50, 0x67,
+  0x7a, 0x8b, 0x94, 0x98, 0x99, 0x9c, 0xaa, 0xc5, 0xd8, 0xbb, 0xa2, 0x9c,
+  0x9c, 0x98, 0x94, 0x8d, 0x7c, 0x6c, 0x56, 0x3f, 0x25, 0x09, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60,
+  0x41, 0x21, 0x0e, 0x2b, 0x47, 0x62, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x89, 0x6b, 0x4c, 0x2c, 0x0d, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x88,
+  0x88, 0x8c, 0x8c, 0x90, 0x90, 0x94, 0x94, 0x95, 0x98, 0x98, 0x98, 0x9b,
+  0x98, 0x98, 0x92, 0x88, 0x77, 0x61, 0x4b, 0x32, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x42, 0x59, 0x6f, 0x84, 0x8e,
+  0x94, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x98, 0x94,
+  0x8d, 0x7c, 0x6c, 0x56, 0x3f, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x37, 0x55, 0x72, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x86, 0x67, 0x49, 0x2b, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x22, 0x40, 0x5e, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x6c,
+  0x4f, 0x30, 0x11, 0x28, 0x47, 0x65, 0x88, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x86, 0x65, 0x47, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x38, 0x58, 0x75, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7a, 0x5e,
+  0x44, 0x2a, 0x0e, 0x2a, 0x44, 0x5e, 0x7a, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x75, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x23, 0x3a, 0x4e, 0x5e, 0x6b,
+  0x70, 0x74, 0x78, 0x7c, 0xa0, 0xc0, 0xd3, 0xb4, 0x94, 0x78, 0x78, 0x74,
+  0x73, 0x6c, 0x62, 0x53, 0x3f, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f,
+  0x00, 0x1b, 0x37, 0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x64,
+  0x49, 0x2a, 0x0b, 0x00, 0x00, 0x05, 0x23, 0x40, 0x59, 0x64, 0x65, 0x68,
+  0x6b, 0x6c, 0x6e, 0x70, 0x70, 0x74, 0x74, 0x74, 0x74, 0x78, 0x78, 0x74,
+  0x70, 0x68, 0x5b, 0x4b, 0x34, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x2e, 0x4c, 0x67, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x5e, 0x41, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x2c, 0x42, 0x55, 0x63, 0x6c, 0x74, 0x74,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x73, 0x6c, 0x62,
+  0x53, 0x3f, 0x29, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x2c, 0x49, 0x64, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x37, 0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x27,
+  0x09, 0x21, 0x3e, 0x5b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b,
+  0x3d, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x36,
+  0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x67, 0x4e, 0x34, 0x19,
+  0x00, 0x19, 0x34, 0x4e, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b,
+  0x54, 0x36, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x32, 0x50, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b,
+  0x3d, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0x34, 0x42, 0x4c, 0x53, 0x54,
+  0x5b, 0x78, 0x9c, 0xbb, 0xd5, 0xb6, 0x99, 0x7c, 0x78, 0x78, 0x78, 0x5f,
+  0x44, 0x37, 0x27, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c,
+  0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x0d,
+  0x28, 0x3f, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x49, 0x37, 0x1e,
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x2c, 0x3e, 0x44, 0x47, 0x48, 0x4c, 0x4c,
+  0x50, 0x50, 0x50, 0x54, 0x54, 0x54, 0x54, 0x58, 0x58, 0x54, 0x52, 0x4a,
+  0x3e, 0x30, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x21, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x45, 0x31, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x29, 0x39, 0x45, 0x4f, 0x54, 0x55, 0x58, 0x58,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x54, 0x4e, 0x44, 0x37, 0x27,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x1e, 0x37, 0x49, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x43, 0x2e, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x3f,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00, 0x14,
+  0x2e, 0x43, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x3f, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x3a, 0x22, 0x08, 0x00, 0x08,
+  0x22, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3f, 0x28,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x25, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x24, 0x2d, 0x34, 0x37, 0x55, 0x73,
+  0x94, 0xae, 0xc9, 0xc4, 0xad, 0x9d, 0x9c, 0x9c, 0x84, 0x60, 0x41, 0x21,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00, 0x12, 0x24,
+  0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2a, 0x1e, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x21, 0x25, 0x28, 0x29, 0x2c, 0x2d, 0x30, 0x31,
+  0x31, 0x35, 0x35, 0x35, 0x35, 0x39, 0x39, 0x35, 0x33, 0x2c, 0x22, 0x14,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x28, 0x1a,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x1c, 0x28, 0x30, 0x35, 0x37, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x36, 0x34, 0x2f, 0x27, 0x1b, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x1e, 0x2a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27,
+  0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x2c, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07, 0x00, 0x01, 0x17, 0x27,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x2c, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2b, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x0d, 0x20,
+  0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x24, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22,
+  0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x14, 0x2d, 0x4b, 0x67, 0x84, 0x9c,
+  0xae, 0xba, 0xbc, 0xbc, 0xb9, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x05, 0x08, 0x09, 0x0d, 0x0d, 0x11, 0x11, 0x11, 0x15,
+  0x15, 0x15, 0x16, 0x19, 0x19, 0x15, 0x14, 0x0d, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x10, 0x15, 0x18, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x17, 0x15, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x3b, 0x55, 0x6c, 0x84, 0x92, 0x9c,
+  0x9c, 0x9c, 0x9b, 0x98, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x29, 0x3f, 0x55, 0x67, 0x73, 0x78, 0x78, 0x78,
+  0x78, 0x74, 0x70, 0x5d, 0x3f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x29, 0x3b, 0x4a, 0x54, 0x58, 0x5b, 0x58, 0x58, 0x54,
+  0x50, 0x47, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x20, 0x2d, 0x36, 0x39, 0x3c, 0x39, 0x39, 0x35, 0x32, 0x2b,
+  0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x0f, 0x17, 0x1a, 0x1c, 0x19, 0x19, 0x16, 0x13, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x09, 0x09,
+  0x09, 0x06, 0x05, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x1b, 0x24, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x1e, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x23, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00, 0x0a,
+  0x1d, 0x27, 0x29, 0x29, 0x29, 0x29, 0x29, 0x28, 0x20, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x0b, 0x0d, 0x11,
+  0x13, 0x15, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19, 0x17, 0x10, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x17,
+  0x23, 0x2b, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x2b, 0x1a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1c, 0x1d, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x17, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x0f, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x17, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x18, 0x22, 0x27, 0x29, 0x29, 0x29, 0x25,
+  0x25, 0x24, 0x21, 0x21, 0x1c, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x38, 0x29, 0x12, 0x00, 0x00, 0x05, 0x20, 0x36, 0x43,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3b, 0x26,
+  0x0c, 0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3c,
+  0x34, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x1d, 0x34, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x3d, 0x29, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x1e, 0x32, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35,
+  0x23, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3b, 0x2d, 0x18, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3c, 0x26, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x21, 0x28, 0x2a, 0x2d, 0x31, 0x32, 0x35,
+  0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x2e, 0x22, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3b, 0x30, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x34, 0x41, 0x4a,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x47, 0x31, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3c, 0x34, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x20,
+  0x2d, 0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36,
+  0x2e, 0x22, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x27, 0x35, 0x40, 0x46, 0x48, 0x48, 0x48, 0x44, 0x44, 0x43,
+  0x41, 0x41, 0x3c, 0x32, 0x1e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x55, 0x3e, 0x22, 0x04, 0x00, 0x11, 0x30, 0x4c, 0x62, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x53, 0x37, 0x19, 0x00,
+  0x0b, 0x29, 0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x4d, 0x34,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x2c, 0x49, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x56, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x33, 0x4b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x50, 0x38, 0x1d,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x44, 0x59,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x59, 0x44, 0x29, 0x0b, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x67, 0x53, 0x37, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x2c, 0x3e, 0x47, 0x49, 0x4c, 0x50, 0x50, 0x54, 0x54, 0x58,
+  0x58, 0x58, 0x58, 0x58, 0x54, 0x4c, 0x3e, 0x2c, 0x18, 0x02, 0x00, 0x00,
+  0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48,
+  0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3d, 0x50, 0x5e, 0x68, 0x6e, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x3f,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x29, 0x44, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x4d, 0x34, 0x17, 0x00, 0x00, 0x00, 0x02, 0x18, 0x2c, 0x3d, 0x4b, 0x54,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x4c, 0x3e,
+  0x2d, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2c,
+  0x41, 0x52, 0x5e, 0x64, 0x68, 0x68, 0x68, 0x64, 0x64, 0x62, 0x60, 0x60,
+  0x5b, 0x4b, 0x30, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x5e, 0x41, 0x24, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x43,
+  0x5e, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x63, 0x49, 0x2d, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x70,
+  0x50, 0x31, 0x11, 0x00, 0x11, 0x30, 0x50, 0x6e, 0x8b, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x7c, 0x60, 0x42, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21,
+  0x3e, 0x59, 0x65, 0x68, 0x6c, 0x70, 0x70, 0x74, 0x74, 0x78, 0x78, 0x78,
+  0x78, 0x78, 0x74, 0x69, 0x59, 0x45, 0x2f, 0x15, 0x00, 0x00, 0x00, 0x1d,
+  0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x21, 0x3c, 0x53, 0x6a, 0x7a, 0x89, 0x90, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7a, 0x5c, 0x3c,
+  0x1d, 0x00, 0x00, 0x00, 0x15, 0x2f, 0x45, 0x58, 0x67, 0x73, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x73, 0x69, 0x59, 0x45, 0x2f,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2a, 0x42, 0x59, 0x6c,
+  0x7c, 0x88, 0x8c, 0x8c, 0x8b, 0x88, 0x88, 0x84, 0x84, 0x84, 0x77, 0x58,
+  0x38, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x0d, 0x2c, 0x49, 0x67,
+  0x86, 0xa0, 0xa0, 0xa0, 0xa0, 0x89, 0x6b, 0x4e, 0x30, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x38, 0x54, 0x6e, 0x8b,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x91, 0x73, 0x59, 0x3e, 0x22, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x94, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x0a, 0x27, 0x43, 0x5e, 0x77, 0x94, 0xac, 0xac, 0xa8, 0x8b,
+  0x6b, 0x4e, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0x8c, 0x90, 0x90, 0x94, 0x98, 0x98, 0x9b, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x94, 0x88, 0x72, 0x5b, 0x41, 0x27, 0x0b, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x30, 0x4c, 0x67, 0x84, 0x97, 0xa7, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x0b, 0x27, 0x42, 0x5b, 0x72, 0x86, 0x94, 0x9b, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x94, 0x88, 0x72, 0x5b, 0x43, 0x29, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x3b, 0x56, 0x6f, 0x89, 0x9b, 0xa6,
+  0xac, 0xac, 0xa8, 0xa8, 0xa8, 0xa4, 0xa4, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x02, 0x20, 0x3d, 0x5b, 0x77, 0x97,
+  0xb4, 0xc0, 0xb4, 0x95, 0x77, 0x5a, 0x3d, 0x20, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x49, 0x63, 0x7c, 0x9c, 0xb7, 0xc0,
+  0xc0, 0xbc, 0xa2, 0x86, 0x69, 0x4e, 0x33, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00,
+  0x00, 0x17, 0x32, 0x4c, 0x67, 0x84, 0x9e, 0xb8, 0xb4, 0x95, 0x75, 0x58,
+  0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xae, 0xb0, 0xb4, 0xb6, 0xb8, 0xb9, 0xbc, 0xbc, 0xbc, 0xba, 0xb2, 0xa0,
+  0x89, 0x6c, 0x52, 0x35, 0x17, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xc0, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x16, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x5a,
+  0x77, 0x95, 0xb0, 0xc3, 0xce, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xbc, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xc0, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x18,
+  0x35, 0x52, 0x6e, 0x89, 0x9f, 0xb0, 0xb9, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xbc, 0xba, 0xb2, 0xa2, 0x8b, 0x6f, 0x54, 0x37, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x2a, 0x49, 0x65, 0x84, 0x9e, 0xb5, 0xc4, 0xca, 0xc8,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xbb, 0xcf,
+  0xdf, 0xdf, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xd0, 0xb8, 0xac, 0xac, 0xac, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x14, 0x31, 0x4e, 0x6c, 0x8b, 0xa8, 0xc5,
+  0xc0, 0xa2, 0x86, 0x67, 0x49, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac, 0xac,
+  0xb2, 0xc7, 0xe2, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x07, 0x22, 0x3e, 0x59, 0x73, 0x91, 0xac, 0xbc, 0xa5, 0xa2, 0xb6,
+  0xb2, 0x96, 0x78, 0x5e, 0x43, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x06,
+  0x20, 0x3b, 0x56, 0x70, 0x8d, 0xa7, 0xbe, 0xa0, 0x84, 0x62, 0x45, 0x27,
+  0x09, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xb5, 0xb4,
+  0xb0, 0xb0, 0xac, 0xac, 0xac, 0xac, 0xb9, 0xcc, 0xcc, 0xb5, 0x9b, 0x7a,
+  0x5d, 0x3f, 0x1f, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x38, 0x39, 0x39, 0x39, 0x39, 0x35, 0x2c,
+  0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa2,
+  0xc0, 0xdb, 0xc1, 0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x09, 0x17,
+  0x23, 0x2b, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x02, 0x21, 0x3f, 0x5e,
+  0x7c, 0x9b, 0xb5, 0xcc, 0xc6, 0xb4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb2,
+  0xc6, 0xcd, 0xb7, 0x9d, 0x7c, 0x60, 0x42, 0x23, 0x04, 0x00, 0x00, 0x00,
+  0x12, 0x31, 0x50, 0x70, 0x90, 0xae, 0xca, 0xd3, 0xbb, 0xab, 0xa4, 0xa4,
+  0xa4, 0xa5, 0xa8, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0xbf, 0xdd, 0xdd,
+  0xc3, 0xab, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc5, 0xa6, 0x8d, 0x8c, 0x8c, 0x8c, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x07, 0x25, 0x42, 0x60, 0x7c, 0x9c, 0xb9, 0xcc, 0xae,
+  0x92, 0x73, 0x55, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0xb9,
+  0xd8, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x17,
+  0x33, 0x4e, 0x69, 0x86, 0xa2, 0xbc, 0xab, 0x90, 0x8b, 0xa5, 0xc0, 0xa7,
+  0x8b, 0x6e, 0x54, 0x38, 0x1d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x10, 0x2a,
+  0x44, 0x5e, 0x78, 0x96, 0xa8, 0xa8, 0x8d, 0x6c, 0x4f, 0x31, 0x13, 0x00,
+  0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x98, 0x97, 0x94, 0x90, 0x90,
+  0x8d, 0x8c, 0x8c, 0x8e, 0x9f, 0xb9, 0xd5, 0xc3, 0xa4, 0x84, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x49, 0x3b, 0x29,
+  0x13, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa8, 0xc8, 0xce,
+  0xb0, 0x94, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x5f, 0x40, 0x20, 0x01, 0x00, 0x00, 0x00, 0x10, 0x23, 0x34, 0x41, 0x4a,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x07, 0x26, 0x45, 0x64, 0x88, 0xa5,
+  0xc4, 0xd2, 0xb5, 0x99, 0x89, 0x88, 0x88, 0x88, 0x88, 0x99, 0xb4, 0xd0,
+  0xc6, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x0e, 0x1e, 0x35,
+  0x54, 0x74, 0x97, 0xb5, 0xd4, 0xc4, 0xa7, 0x8e, 0x84, 0x84, 0x84, 0x88,
+  0x88, 0x8c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x84, 0x9e, 0xbd, 0xdc, 0xc8, 0xb0, 0x96,
+  0x7c, 0x63, 0x46, 0x27, 0x08, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x68, 0x68, 0x68, 0x68, 0x55, 0x38, 0x1a, 0x00,
+  0x00, 0x00, 0x19, 0x36, 0x54, 0x70, 0x90, 0xac, 0xca, 0xbb, 0x9e, 0x84,
+  0x62, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x0d, 0x28, 0x43, 0x5e,
+  0x78, 0x96, 0xb2, 0xb6, 0x9b, 0x7c, 0x77, 0x95, 0xb0, 0xb7, 0x9c, 0x7c,
+  0x63, 0x49, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6a,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x67, 0x4c, 0x2e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x19, 0x33, 0x4e,
+  0x69, 0x86, 0x88, 0x88, 0x88, 0x77, 0x58, 0x38, 0x19, 0x00, 0x00, 0x00,
+  0x05, 0x24, 0x44, 0x63, 0x78, 0x74, 0x74, 0x70, 0x70, 0x6c, 0x6c, 0x68,
+  0x68, 0x72, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x6c,
+  0x73, 0x75, 0x78, 0x78, 0x78, 0x78, 0x72, 0x65, 0x55, 0x3f, 0x29, 0x11,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x4d, 0x35,
+  0x19, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3d, 0x50, 0x5e, 0x68, 0x6e, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xab, 0xc9, 0xcb,
+  0xac, 0x8c, 0x6c, 0x64, 0x64, 0x64, 0x6b, 0x8c, 0xa9, 0xc8, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x0c, 0x26, 0x3b, 0x44, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x7c, 0x62, 0x60, 0x60, 0x64, 0x65, 0x68,
+  0x67, 0x52, 0x35, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x65, 0x7c, 0x99, 0xb0, 0xca, 0xcc, 0xb3, 0x9c, 0x84, 0x69, 0x50,
+  0x37, 0x1d, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x48, 0x48, 0x48, 0x3e, 0x29, 0x0e, 0x00, 0x00, 0x00,
+  0x0d, 0x2b, 0x47, 0x64, 0x84, 0xa1, 0xbe, 0xc8, 0xab, 0x8e, 0x6e, 0x52,
+  0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1f,
+  0x37, 0x46, 0x48, 0x48, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x02, 0x1d, 0x38, 0x54, 0x6e, 0x8b, 0xa7,
+  0xc2, 0xa5, 0x8b, 0x6e, 0x69, 0x86, 0xa0, 0xbc, 0xac, 0x91, 0x73, 0x59,
+  0x3e, 0x22, 0x07, 0x00, 0x00, 0x00, 0x07, 0x23, 0x3d, 0x4e, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4c,
+  0x3a, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x3d, 0x56, 0x64,
+  0x64, 0x64, 0x64, 0x63, 0x50, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x38, 0x50, 0x58, 0x5f, 0x64, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x6c,
+  0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd8, 0xb8, 0x99, 0x89, 0x90, 0x94, 0x98,
+  0x9c, 0x9c, 0x9c, 0x9b, 0x92, 0x84, 0x6c, 0x56, 0x3d, 0x21, 0x05, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x32, 0x20, 0x09, 0x00,
+  0x00, 0x05, 0x21, 0x3c, 0x53, 0x6a, 0x7a, 0x89, 0x90, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x9c, 0xb7, 0xd6, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x58, 0x58, 0x58, 0x64, 0x88, 0xa8, 0xc7, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x19, 0x37, 0x53, 0x64, 0x64, 0x74, 0x98, 0xb8,
+  0xd7, 0xc0, 0xa0, 0x7c, 0x64, 0x64, 0x64, 0x64, 0x64, 0x59, 0x48, 0x3c,
+  0x25, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x18, 0x29, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x49, 0x61, 0x7a,
+  0x94, 0xad, 0xc4, 0xcf, 0xb8, 0x9f, 0x88, 0x6c, 0x54, 0x3c, 0x23, 0x0b,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x29, 0x29, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x3b, 0x59, 0x75, 0x95, 0xb2, 0xcf, 0xb7, 0x9b, 0x7a, 0x5e, 0x41, 0x24,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27,
+  0x29, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x12, 0x2d, 0x49, 0x63, 0x7c, 0x9c, 0xb7, 0xb2, 0x96,
+  0x78, 0x5e, 0x58, 0x73, 0x91, 0xac, 0xbc, 0xa2, 0x86, 0x69, 0x4e, 0x33,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x2f, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2e, 0x21, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x29, 0x3d, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x38, 0x23, 0x09, 0x00, 0x00, 0x00, 0x12, 0x2c, 0x45, 0x5b,
+  0x6e, 0x7c, 0x88, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x94, 0xb1,
+  0xd0, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdf, 0xc4, 0xae, 0xa8, 0xae, 0xb4, 0xb8, 0xbc, 0xbc,
+  0xbc, 0xb9, 0xae, 0x9c, 0x86, 0x67, 0x4c, 0x2e, 0x11, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x19,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x14, 0x07, 0x00, 0x00, 0x00, 0x14,
+  0x30, 0x4c, 0x67, 0x84, 0x97, 0xa7, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb7, 0xc9, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x78, 0x78,
+  0x78, 0x78, 0x78, 0x88, 0xa8, 0xc7, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x88, 0x88, 0x99, 0xb8, 0xd8, 0xc0,
+  0xa1, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x64, 0x44, 0x25, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x11, 0x11, 0x11, 0x11, 0x15, 0x2c, 0x45, 0x5e, 0x75, 0x91, 0xa8, 0xc1,
+  0xd4, 0xbb, 0xa3, 0x8b, 0x70, 0x59, 0x3f, 0x28, 0x10, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x4c,
+  0x69, 0x89, 0xa6, 0xc3, 0xc3, 0xa7, 0x89, 0x6b, 0x4e, 0x30, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x05, 0x22, 0x3e, 0x59, 0x73, 0x91, 0xac, 0xb8, 0xa2, 0x86, 0x69, 0x4e,
+  0x49, 0x63, 0x7c, 0x9d, 0xb7, 0xb2, 0x96, 0x78, 0x5e, 0x43, 0x27, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0f, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x1f, 0x25, 0x25, 0x25, 0x25, 0x24,
+  0x1c, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x20, 0x3d, 0x58, 0x72, 0x8b, 0x9c,
+  0xa6, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xac, 0xae, 0xc1, 0xdb, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xdf, 0xd1, 0xc0, 0xb8, 0xb4, 0xb2, 0xb0, 0xb0, 0xb2, 0xc0, 0xd4,
+  0xc9, 0xb0, 0x94, 0x75, 0x58, 0x38, 0x1a, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x3c, 0x5a,
+  0x77, 0x95, 0xb0, 0xc3, 0xce, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbf, 0xcf, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xd0, 0xb4, 0x9e, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x9c, 0x9d, 0xb0, 0xcd, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa8, 0xae, 0xc4, 0xe0, 0xcb, 0xb3, 0xa8,
+  0xa8, 0xa8, 0xa8, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x29, 0x41, 0x59, 0x72, 0x8b, 0xa5, 0xbd, 0xd4, 0xc0, 0xa7,
+  0x8e, 0x75, 0x5b, 0x44, 0x2c, 0x13, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x23, 0x40, 0x5e, 0x7a,
+  0x99, 0xb7, 0xd0, 0xb4, 0x95, 0x77, 0x5a, 0x3d, 0x20, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x0c, 0x2c,
+  0x4b, 0x69, 0x86, 0x98, 0x98, 0x98, 0x92, 0x75, 0x59, 0x3e, 0x38, 0x54,
+  0x6f, 0x8d, 0x98, 0x98, 0x98, 0x8b, 0x6e, 0x52, 0x33, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0x2c, 0x4a, 0x67, 0x86, 0xa0, 0xb6, 0xc5, 0xca,
+  0xbc, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8, 0xba, 0xc9, 0xe1, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdc,
+  0xbe, 0xa5, 0x98, 0x94, 0x94, 0x90, 0x90, 0x95, 0xa7, 0xc2, 0xdb, 0xbd,
+  0x9e, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x15, 0x15, 0x19, 0x19, 0x1d,
+  0x1f, 0x21, 0x1c, 0x0e, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa2,
+  0xc0, 0xdb, 0xc1, 0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xa2, 0xbb,
+  0xd8, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xe0, 0xca, 0xbd, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xc7, 0xc7, 0xc7, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xc8, 0xd7, 0xee, 0xdd, 0xcb, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x25,
+  0x3d, 0x56, 0x6c, 0x89, 0xa0, 0xb8, 0xd1, 0xc3, 0xab, 0x94, 0x77, 0x61,
+  0x48, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x52, 0x6e, 0x8e, 0xab,
+  0xc9, 0xc0, 0xa2, 0x86, 0x67, 0x49, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x0c, 0x2c, 0x4b, 0x69,
+  0x74, 0x74, 0x74, 0x74, 0x74, 0x64, 0x49, 0x2e, 0x29, 0x44, 0x5e, 0x74,
+  0x74, 0x74, 0x74, 0x74, 0x6f, 0x53, 0x34, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x34, 0x54, 0x72, 0x92, 0xb0, 0xcc, 0xcb, 0xb3, 0x9e, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x9d, 0xb5, 0xd3, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x78, 0x74, 0x70, 0x6c, 0x6c, 0x78, 0x97, 0xb5, 0xd4, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x31, 0x35, 0x35, 0x38, 0x39, 0x3d, 0x3d, 0x41,
+  0x39, 0x26, 0x0e, 0x00, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa8, 0xc8, 0xce,
+  0xb0, 0x94, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x78, 0x94, 0xb4, 0xd3, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xd5, 0xbb, 0xa9, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xa4, 0xab, 0xc2, 0xde, 0xc9, 0xb0, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4,
+  0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x39, 0x50, 0x6a,
+  0x84, 0x9c, 0xb5, 0xcc, 0xc8, 0xb0, 0x96, 0x7c, 0x64, 0x4c, 0x34, 0x1b,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x28, 0x45, 0x63, 0x84, 0x9e, 0xbc, 0xcc,
+  0xae, 0x92, 0x73, 0x55, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x05, 0x22, 0x3c, 0x50, 0x54, 0x54,
+  0x54, 0x54, 0x54, 0x4c, 0x37, 0x1e, 0x19, 0x33, 0x4a, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x53, 0x42, 0x29, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x38, 0x58, 0x75, 0x98, 0xb8, 0xd7, 0xbf, 0xa1, 0x86, 0x74, 0x74, 0x74,
+  0x74, 0x74, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x50, 0x4c, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x50, 0x50, 0x54, 0x54, 0x58, 0x58, 0x5c, 0x5c, 0x60, 0x53, 0x39,
+  0x1c, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x58, 0x58, 0x58, 0x58, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcc,
+  0xac, 0x8e, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x84, 0x84,
+  0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x64,
+  0x44, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x1d, 0x34, 0x4d, 0x65, 0x7c, 0x99, 0xb0,
+  0xc9, 0xcc, 0xb3, 0x9c, 0x84, 0x69, 0x50, 0x37, 0x20, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x39, 0x57, 0x73, 0x94, 0xb0, 0xcd, 0xbb, 0x9e,
+  0x84, 0x62, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x10, 0x25, 0x32, 0x35, 0x35, 0x35, 0x35,
+  0x35, 0x30, 0x20, 0x0a, 0x07, 0x1d, 0x2e, 0x35, 0x35, 0x35, 0x35, 0x35,
+  0x34, 0x29, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58,
+  0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x59, 0x55, 0x58, 0x5f, 0x6c,
+  0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xca, 0xcc, 0xad, 0x90, 0x75, 0x70,
+  0x70, 0x74, 0x74, 0x75, 0x78, 0x7c, 0x7c, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x39, 0x39, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5b,
+  0x42, 0x24, 0x06, 0x00, 0x18, 0x35, 0x50, 0x60, 0x60, 0x74, 0x98, 0xb8,
+  0xd7, 0xc0, 0xa0, 0x7c, 0x60, 0x60, 0x60, 0x60, 0x60, 0x56, 0x3d, 0x1f,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0x31, 0x49, 0x61, 0x7a, 0x94, 0xad, 0xc4, 0xcf, 0xb8,
+  0x9f, 0x88, 0x6c, 0x54, 0x3c, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x2d, 0x4b, 0x67, 0x88, 0xa3, 0xc1, 0xc8, 0xab, 0x8e, 0x6e,
+  0x52, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x09, 0x13, 0x15, 0x15, 0x15, 0x15, 0x15, 0x11,
+  0x05, 0x00, 0x00, 0x03, 0x10, 0x15, 0x15, 0x15, 0x15, 0x15, 0x14, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x58, 0x78, 0x9b,
+  0xb9, 0xd8, 0xbf, 0xa1, 0x86, 0x74, 0x74, 0x78, 0x7c, 0x88, 0x94, 0xb1,
+  0xd0, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x08, 0x27,
+  0x46, 0x64, 0x88, 0xa6, 0xc5, 0xd7, 0xbc, 0xa5, 0x94, 0x94, 0x94, 0x94,
+  0x98, 0x98, 0x9c, 0x9c, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xca, 0xcc, 0xac, 0x8e, 0x72, 0x6c,
+  0x6c, 0x6c, 0x70, 0x70, 0x73, 0x74, 0x78, 0x78, 0x73, 0x54, 0x34, 0x16,
+  0x00, 0x00, 0x0a, 0x23, 0x37, 0x40, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x41, 0x41, 0x41, 0x41, 0x3b, 0x29, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x2c, 0x45, 0x5e, 0x75, 0x91, 0xa8, 0xc1, 0xd4, 0xbb, 0xa3, 0x8b, 0x70,
+  0x59, 0x3f, 0x28, 0x10, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x21, 0x3e, 0x5b, 0x78, 0x97, 0xb5, 0xd2, 0xb7, 0x9b, 0x7a, 0x5e, 0x41,
+  0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x35, 0x54, 0x74, 0x95, 0xb4, 0xd3,
+  0xcb, 0xb3, 0xa0, 0x98, 0x98, 0x9c, 0xa0, 0xa6, 0xae, 0xc1, 0xda, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x03, 0x22, 0x40, 0x5f,
+  0x7c, 0x9c, 0xb6, 0xcc, 0xd1, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xb8,
+  0xbc, 0xbc, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x31, 0x50, 0x70,
+  0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x08, 0x27,
+  0x46, 0x64, 0x88, 0xa6, 0xc5, 0xd5, 0xb9, 0x9f, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x94, 0x94, 0x98, 0x98, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x00, 0x0b, 0x1a, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x21, 0x21, 0x21, 0x1d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x29, 0x41, 0x59,
+  0x72, 0x8b, 0xa5, 0xbd, 0xd4, 0xc0, 0xa7, 0x8e, 0x75, 0x5b, 0x44, 0x2c,
+  0x21, 0x21, 0x21, 0x21, 0x21, 0x1e, 0x12, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32,
+  0x4f, 0x6c, 0x8c, 0xa9, 0xc6, 0xc3, 0xa7, 0x89, 0x6b, 0x4e, 0x30, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x30, 0x4f, 0x6c, 0x8d, 0xa9, 0xc2, 0xd3, 0xcb,
+  0xbc, 0xb8, 0xb8, 0xbb, 0xb7, 0xa7, 0x9c, 0xad, 0xc9, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x19, 0x36, 0x54, 0x6e, 0x8b,
+  0xa0, 0xb0, 0xb8, 0xbb, 0xb8, 0xb8, 0xb8, 0xb4, 0xb4, 0xb0, 0xae, 0xac,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x31, 0x50, 0x70, 0x94, 0xb4,
+  0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x03, 0x22, 0x40, 0x5f,
+  0x7c, 0x9c, 0xb6, 0xcc, 0xcc, 0xb9, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb4,
+  0xb4, 0xb8, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x25, 0x3d, 0x56, 0x6c, 0x89, 0xa0,
+  0xb8, 0xd1, 0xc3, 0xab, 0x94, 0x77, 0x61, 0x48, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x41, 0x41, 0x3c, 0x2c, 0x14, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x44, 0x60,
+  0x7c, 0x9d, 0xba, 0xd0, 0xb4, 0x95, 0x77, 0x5a, 0x3d, 0x20, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x27, 0x44, 0x60, 0x7a, 0x96, 0xa9, 0xb4, 0xb8, 0xb9, 0xb6,
+  0xb0, 0xa6, 0x9b, 0x8b, 0x84, 0xa1, 0xb0, 0xb0, 0xa8, 0x88, 0x64, 0x44,
+  0x25, 0x05, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x3d, 0x3d, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x0d, 0x28, 0x42, 0x5b, 0x72, 0x86, 0x92,
+  0x98, 0x9c, 0x98, 0x98, 0x98, 0x94, 0x94, 0x90, 0x90, 0x8c, 0x88, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x3d, 0x40, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x19, 0x36, 0x54, 0x6e, 0x8b,
+  0xa0, 0xb0, 0xb8, 0xbb, 0xb8, 0xb8, 0xb8, 0xb5, 0xb4, 0xb1, 0xb0, 0xac,
+  0xa9, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x35, 0x50, 0x6a, 0x84, 0x9c, 0xb5, 0xcc, 0xcd,
+  0xb0, 0x96, 0x7c, 0x64, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0x58, 0x40, 0x23, 0x05, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x37, 0x54, 0x72, 0x90,
+  0xae, 0xcb, 0xc0, 0xa2, 0x86, 0x67, 0x49, 0x2d, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x35, 0x4e, 0x67, 0x7a, 0x8d, 0x95, 0x99, 0x9b, 0x98, 0x90, 0x88,
+  0x7a, 0x6e, 0x78, 0x90, 0x90, 0x90, 0x90, 0x88, 0x64, 0x44, 0x25, 0x05,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x72, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x45, 0x58, 0x67, 0x72, 0x74, 0x78,
+  0x74, 0x74, 0x74, 0x73, 0x70, 0x70, 0x6c, 0x68, 0x67, 0x64, 0x56, 0x3b,
+  0x1d, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x69, 0x5c, 0x5c, 0x60, 0x64, 0x70, 0x94, 0xb4, 0xd3, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x0d, 0x28, 0x42, 0x5b, 0x72, 0x86, 0x92,
+  0x98, 0x9c, 0x98, 0x98, 0x98, 0x97, 0x94, 0x94, 0x90, 0x8c, 0x8c, 0x88,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x99, 0xb0, 0xc9, 0xe1, 0xc8, 0xa8, 0x89,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x49, 0x65, 0x84, 0xa2, 0xbf,
+  0xcc, 0xae, 0x92, 0x73, 0x55, 0x39, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22,
+  0x3a, 0x4e, 0x60, 0x6c, 0x74, 0x78, 0x78, 0x74, 0x70, 0x68, 0x5e, 0x54,
+  0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5e, 0x41, 0x23, 0x03, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x86, 0x9d, 0xba, 0xd8, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x02, 0x18, 0x2c, 0x3d, 0x4a, 0x54, 0x57, 0x58, 0x55, 0x54,
+  0x54, 0x54, 0x50, 0x50, 0x4c, 0x49, 0x48, 0x44, 0x3d, 0x29, 0x10, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xca, 0xcf, 0xb2, 0x95, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x88, 0x8d, 0x9c, 0xb7, 0xd6, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x45, 0x58, 0x67, 0x72, 0x74, 0x78,
+  0x74, 0x74, 0x74, 0x74, 0x70, 0x70, 0x6c, 0x6c, 0x68, 0x64, 0x62, 0x4c,
+  0x30, 0x11, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdd, 0xed, 0xd0, 0xb5, 0xa5, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x1e, 0x3c, 0x59, 0x77, 0x95, 0xb4, 0xd0, 0xbb,
+  0x9e, 0x84, 0x62, 0x45, 0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0x35,
+  0x44, 0x4f, 0x54, 0x58, 0x58, 0x54, 0x50, 0x4a, 0x40, 0x3f, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x45, 0x31, 0x17, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xdd, 0xc0, 0xa8, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa1,
+  0xb3, 0xc9, 0xd3, 0xb7, 0x99, 0x78, 0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x20, 0x2c, 0x34, 0x38, 0x39, 0x37, 0x35, 0x35, 0x34,
+  0x31, 0x31, 0x2d, 0x2a, 0x28, 0x25, 0x1f, 0x11, 0x00, 0x00, 0x08, 0x27,
+  0x46, 0x64, 0x88, 0xa6, 0xc5, 0xdc, 0xc1, 0xab, 0xa0, 0xa0, 0xa0, 0xa0,
+  0xa5, 0xac, 0xb5, 0xc9, 0xdf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x02, 0x18, 0x2c, 0x3d, 0x4a, 0x54, 0x57, 0x58, 0x55, 0x54,
+  0x54, 0x54, 0x50, 0x50, 0x4c, 0x4c, 0x48, 0x44, 0x43, 0x36, 0x20, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc0,
+  0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xcf, 0xcf, 0xcf, 0xce, 0xc4, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x30, 0x4e, 0x6b, 0x89, 0xa7, 0xc4, 0xc8, 0xab, 0x8e,
+  0x6e, 0x52, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x19, 0x27, 0x30,
+  0x35, 0x39, 0x39, 0x35, 0x32, 0x2b, 0x22, 0x24, 0x2c, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x28, 0x1a, 0x04, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xcf, 0xcf, 0xc4, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xcb, 0xca,
+  0xbd, 0xa7, 0x8d, 0x6e, 0x52, 0x33, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x0e, 0x15, 0x18, 0x19, 0x18, 0x15, 0x15, 0x15, 0x11, 0x11,
+  0x0d, 0x0b, 0x09, 0x05, 0x01, 0x00, 0x00, 0x00, 0x03, 0x22, 0x40, 0x5f,
+  0x7c, 0x9c, 0xb6, 0xcc, 0xd7, 0xc7, 0xc0, 0xc0, 0xc0, 0xc0, 0xb4, 0xa3,
+  0xa2, 0xb5, 0xcf, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x20, 0x2c, 0x34, 0x38, 0x39, 0x37, 0x35, 0x35, 0x35,
+  0x31, 0x31, 0x2d, 0x2d, 0x29, 0x25, 0x24, 0x1b, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xcf, 0xc0, 0xa0, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x24, 0x41, 0x5e, 0x7c, 0x9b, 0xb0, 0xb0, 0xb0, 0x9b, 0x7a, 0x5e,
+  0x41, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x15, 0x19,
+  0x19, 0x16, 0x13, 0x0c, 0x04, 0x06, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0xa2, 0x91,
+  0x77, 0x5e, 0x44, 0x27, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x36, 0x54, 0x6e, 0x8b,
+  0xa0, 0xb0, 0xb8, 0xbc, 0xb8, 0xb5, 0xad, 0xa3, 0x97, 0x89, 0x89, 0xa8,
+  0xb0, 0xb0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x0e, 0x15, 0x18, 0x19, 0x18, 0x15, 0x15, 0x15, 0x12, 0x11,
+  0x0e, 0x0d, 0x09, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb0, 0xb0, 0xb0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x35, 0x52, 0x70, 0x8e, 0x90, 0x90, 0x90, 0x90, 0x89, 0x6b, 0x4c, 0x2c,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8c, 0x84, 0x75, 0x61, 0x4b,
+  0x33, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x42, 0x5b, 0x72, 0x86, 0x92,
+  0x98, 0x9c, 0x98, 0x97, 0x90, 0x88, 0x78, 0x6b, 0x84, 0x90, 0x90, 0x90,
+  0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x45,
+  0x61, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x64, 0x49, 0x2a, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x64, 0x59, 0x49, 0x34, 0x1e, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x45, 0x58, 0x67, 0x72, 0x74, 0x78,
+  0x78, 0x74, 0x6e, 0x67, 0x5b, 0x58, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x57, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x32, 0x50, 0x69,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47,
+  0x34, 0x1b, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x09, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x34, 0x47, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x49, 0x37, 0x1e, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x46, 0x3c, 0x2e, 0x1d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x18, 0x2c, 0x3d, 0x4a, 0x54, 0x57, 0x58, 0x58, 0x54,
+  0x50, 0x48, 0x3e, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x41, 0x2b,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x3c, 0x4b, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x41, 0x2b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x29, 0x29, 0x22, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2a, 0x1e, 0x0a, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27,
+  0x29, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x25,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2c, 0x27, 0x1e, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x20, 0x2c, 0x34, 0x38, 0x39, 0x39, 0x35, 0x31, 0x29,
+  0x21, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x48,
+  0x48, 0x48, 0x3e, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x0e, 0x15, 0x18, 0x19, 0x19, 0x15, 0x12, 0x0a, 0x02, 0x07,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x68, 0x68, 0x68, 0x68,
+  0x55, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x74,
+  0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xb8, 0xd7, 0xc5, 0xa6, 0x8d, 0x8c, 0x8c, 0x8c, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x9b, 0xb9,
+  0xd8, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8,
+  0xd7, 0xd0, 0xb8, 0xac, 0xac, 0xac, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac, 0xac, 0xb2, 0xc7, 0xe2, 0xc3,
+  0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31,
+  0x50, 0x70, 0x94, 0xb4, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc3, 0xa4, 0x84,
+  0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70,
+  0x94, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa4, 0x84, 0x60, 0x41,
+  0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x60, 0x41, 0x21, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e,
+  0x4a, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+  0x53, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x49, 0x60, 0x64, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x56, 0x3b, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1d, 0x34, 0x42,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3b, 0x26,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x1d, 0x34, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x3d, 0x29, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x23, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1e, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x19, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x1f, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x17, 0x23, 0x2b, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x30, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x14, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x23, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x16, 0x24, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x26, 0x1b, 0x07, 0x00,
+  0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x14,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1c, 0x14, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x04, 0x0d, 0x14, 0x19,
+  0x19, 0x19, 0x17, 0x0f, 0x05, 0x00, 0x02, 0x0b, 0x12, 0x18, 0x19, 0x19,
+  0x19, 0x14, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x04, 0x0d, 0x14, 0x19,
+  0x19, 0x19, 0x19, 0x18, 0x11, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x0f, 0x16, 0x19, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x16, 0x0f, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b,
+  0x04, 0x0d, 0x14, 0x19, 0x19, 0x19, 0x19, 0x18, 0x11, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x17, 0x23, 0x2b, 0x30,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x30, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x0b, 0x03, 0x0d, 0x14, 0x19, 0x19, 0x19, 0x18, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x34,
+  0x41, 0x4a, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x4f, 0x3f, 0x27, 0x0b, 0x00, 0x00, 0x08, 0x21, 0x34,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x30, 0x1b, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x40,
+  0x2c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2f, 0x42,
+  0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x45, 0x34, 0x1c, 0x00, 0x00, 0x08,
+  0x21, 0x34, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x30, 0x1b, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b,
+  0x30, 0x1b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x29, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x22, 0x2c, 0x33, 0x38, 0x39, 0x39,
+  0x36, 0x2d, 0x22, 0x16, 0x21, 0x2a, 0x31, 0x37, 0x39, 0x39, 0x39, 0x33,
+  0x29, 0x1b, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x29, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x22, 0x2c, 0x33, 0x38, 0x39, 0x39,
+  0x39, 0x37, 0x30, 0x24, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0x20, 0x2d, 0x35, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x35, 0x2d, 0x22, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x18, 0x29, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x22, 0x2c,
+  0x33, 0x38, 0x39, 0x39, 0x39, 0x37, 0x30, 0x24, 0x15, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x23, 0x34, 0x41, 0x4a, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4f, 0x3f,
+  0x27, 0x0b, 0x00, 0x00, 0x01, 0x18, 0x29, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x29, 0x21, 0x2c, 0x34, 0x39, 0x39, 0x39, 0x37, 0x2a, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x26, 0x3d, 0x50, 0x5e, 0x68,
+  0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x6c, 0x52, 0x33, 0x14, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x5c, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x2d, 0x4b, 0x63, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x58, 0x3c, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x40, 0x5b, 0x68, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x61, 0x47, 0x29, 0x0a, 0x00, 0x17, 0x34, 0x4d,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d, 0x0f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x34, 0x4d, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x5a, 0x48, 0x2d,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x44, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x44, 0x40, 0x4a, 0x52, 0x58, 0x58, 0x58, 0x54, 0x4b,
+  0x3e, 0x33, 0x3f, 0x49, 0x50, 0x55, 0x58, 0x58, 0x58, 0x52, 0x45, 0x37,
+  0x23, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x44, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x44, 0x40, 0x4a, 0x52, 0x58, 0x58, 0x58, 0x58, 0x55,
+  0x4e, 0x40, 0x2f, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 0x2c,
+  0x3d, 0x4b, 0x54, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
+  0x58, 0x54, 0x4b, 0x3e, 0x2c, 0x18, 0x02, 0x00, 0x00, 0x00, 0x12, 0x2d,
+  0x44, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x44, 0x40, 0x4a, 0x52, 0x58,
+  0x58, 0x58, 0x58, 0x55, 0x4e, 0x40, 0x2f, 0x1b, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x26, 0x3d, 0x50, 0x5e, 0x68, 0x6e, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6c, 0x52, 0x33, 0x14,
+  0x00, 0x00, 0x12, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x44,
+  0x3e, 0x4a, 0x53, 0x58, 0x58, 0x58, 0x55, 0x42, 0x27, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x21, 0x3c, 0x53, 0x6a, 0x7a, 0x89, 0x90, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c,
+  0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x73, 0x54, 0x34, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x5b, 0x5e, 0x68, 0x70, 0x77, 0x78, 0x78, 0x73, 0x69, 0x58, 0x50,
+  0x5d, 0x67, 0x70, 0x74, 0x78, 0x78, 0x78, 0x70, 0x62, 0x50, 0x3a, 0x23,
+  0x0a, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x5b, 0x5e, 0x68, 0x70, 0x77, 0x78, 0x78, 0x78, 0x74, 0x6b, 0x5b,
+  0x48, 0x31, 0x19, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2f, 0x45, 0x58, 0x67,
+  0x73, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x73,
+  0x69, 0x59, 0x45, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x5b, 0x5e, 0x68, 0x70, 0x77, 0x78, 0x78,
+  0x78, 0x74, 0x6b, 0x5b, 0x48, 0x31, 0x19, 0x00, 0x00, 0x00, 0x05, 0x21,
+  0x3c, 0x53, 0x6a, 0x7a, 0x89, 0x90, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5b, 0x5b, 0x67,
+  0x70, 0x78, 0x78, 0x78, 0x6e, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x30, 0x4c, 0x67, 0x84, 0x97, 0xa7, 0xb0, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xac, 0xac, 0xac, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xac, 0xac, 0xac, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0,
+  0xa0, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94, 0x94, 0x94, 0x84, 0x6c,
+  0x7a, 0x88, 0x92, 0x98, 0x9c, 0x9c, 0x94, 0x86, 0x72, 0x6c, 0x78, 0x88,
+  0x90, 0x97, 0x9c, 0x9c, 0x98, 0x8e, 0x7c, 0x67, 0x50, 0x36, 0x1b, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94, 0x94, 0x94, 0x84, 0x6c,
+  0x7a, 0x88, 0x92, 0x98, 0x9c, 0x9c, 0x9c, 0x95, 0x89, 0x75, 0x5e, 0x44,
+  0x2a, 0x0e, 0x00, 0x00, 0x0b, 0x27, 0x42, 0x5b, 0x72, 0x86, 0x94, 0x9b,
+  0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9b, 0x94, 0x88, 0x72,
+  0x5b, 0x42, 0x28, 0x0d, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94,
+  0x94, 0x94, 0x84, 0x6c, 0x7a, 0x88, 0x92, 0x98, 0x9c, 0x9c, 0x9c, 0x95,
+  0x89, 0x75, 0x5e, 0x44, 0x2a, 0x0e, 0x00, 0x00, 0x14, 0x30, 0x4c, 0x67,
+  0x84, 0x97, 0xa7, 0xb0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0x94, 0x94, 0x94, 0x94, 0x84, 0x65, 0x75, 0x88, 0x92, 0x98,
+  0x9c, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x3c, 0x5a, 0x77, 0x95, 0xb0, 0xc3, 0xce, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xbc, 0xc3, 0xd3, 0xd3, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x19, 0x19, 0x19, 0x19, 0x19, 0x18, 0x11, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xc7, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x04, 0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x10, 0x07, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xc0, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xb4, 0xa9, 0x8c, 0x8b, 0x99, 0xa6,
+  0xb0, 0xb7, 0xbc, 0xba, 0xb1, 0xa0, 0x89, 0x89, 0x99, 0xa5, 0xae, 0xb5,
+  0xbb, 0xbc, 0xb7, 0xab, 0x96, 0x7c, 0x62, 0x45, 0x28, 0x0a, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xb4, 0xa9, 0x8c, 0x8b, 0x99, 0xa6,
+  0xb0, 0xb7, 0xbc, 0xbc, 0xbb, 0xb4, 0xa2, 0x8d, 0x70, 0x55, 0x38, 0x1a,
+  0x00, 0x00, 0x18, 0x35, 0x52, 0x6e, 0x89, 0x9f, 0xb0, 0xb9, 0xbc, 0xbc,
+  0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xb9, 0xb1, 0xa0, 0x8b, 0x6e, 0x54,
+  0x36, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xb4, 0xa9,
+  0x8c, 0x8b, 0x99, 0xa6, 0xb0, 0xb7, 0xbc, 0xbc, 0xbb, 0xb4, 0xa2, 0x8d,
+  0x70, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x1e, 0x3c, 0x5a, 0x77, 0x95, 0xb0,
+  0xc3, 0xce, 0xc5, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xc3, 0xd3, 0xd3,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xb4, 0xb4, 0xa8, 0x88, 0x7c, 0x94, 0xa3, 0xb0, 0xb8, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x84, 0xa2, 0xc0, 0xdb, 0xc1, 0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
+  0xaa, 0xc5, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x38,
+  0x39, 0x39, 0x39, 0x39, 0x37, 0x30, 0x24, 0x15, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x15, 0x31, 0x50, 0x70, 0x94, 0xa8, 0xa8, 0xa8, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xa8, 0xa8, 0xa8, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x15, 0x1f, 0x2d, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2f, 0x23,
+  0x10, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd2, 0xb6, 0xa2, 0xa5, 0xb5, 0xbc, 0xbc, 0xbc,
+  0xc5, 0xd7, 0xcc, 0xb5, 0xa2, 0xa3, 0xb4, 0xc0, 0xbc, 0xbc, 0xbf, 0xcd,
+  0xd5, 0xc3, 0xaa, 0x8e, 0x6e, 0x50, 0x31, 0x12, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd2, 0xb6, 0xa2, 0xa5, 0xb5, 0xbd, 0xbc, 0xbc,
+  0xbc, 0xc3, 0xd4, 0xcf, 0xb8, 0x9e, 0x7c, 0x60, 0x42, 0x23, 0x04, 0x02,
+  0x21, 0x3f, 0x5e, 0x7c, 0x9b, 0xb5, 0xcc, 0xcf, 0xbc, 0xb1, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb1, 0xbb, 0xcf, 0xcc, 0xb6, 0x9c, 0x7c, 0x5f, 0x41, 0x23,
+  0x03, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd2, 0xb6, 0xa2, 0xa5,
+  0xb5, 0xbd, 0xbc, 0xbc, 0xbc, 0xc3, 0xd4, 0xcf, 0xb8, 0x9e, 0x7c, 0x60,
+  0x42, 0x23, 0x04, 0x05, 0x25, 0x44, 0x64, 0x84, 0xa2, 0xc0, 0xdb, 0xc1,
+  0xaa, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0xaa, 0xc5, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xcd, 0xae, 0x94, 0x99, 0xad, 0xbe, 0xc6, 0xc3, 0xb4, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa8,
+  0xc8, 0xce, 0xb0, 0x94, 0x7c, 0x78, 0x78, 0x78, 0x78, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x54, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x55, 0x4e, 0x40, 0x2f, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x06,
+  0x1e, 0x32, 0x3c, 0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x1d,
+  0x37, 0x4b, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e, 0x3d, 0x23, 0x07,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xdf, 0xc9, 0xb4, 0xa9, 0xa3, 0x9d, 0x9c, 0x9c, 0xaa, 0xc1,
+  0xdc, 0xcd, 0xbe, 0xae, 0xa7, 0xa0, 0x9c, 0x9c, 0xa2, 0xb5, 0xcd, 0xd4,
+  0xb5, 0x97, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xdf, 0xc9, 0xb4, 0xa9, 0xa3, 0x9e, 0x9c, 0x9c, 0x9c, 0xa8,
+  0xbe, 0xd9, 0xc6, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09, 0x07, 0x26, 0x45,
+  0x64, 0x88, 0xa5, 0xc4, 0xd5, 0xb9, 0xa2, 0x94, 0x90, 0x90, 0x90, 0x90,
+  0x94, 0xa2, 0xb9, 0xd5, 0xc5, 0xa7, 0x88, 0x65, 0x47, 0x28, 0x08, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc9, 0xb4, 0xa9, 0xa3, 0x9e,
+  0x9c, 0x9c, 0x9c, 0xa8, 0xbe, 0xd9, 0xc6, 0xa8, 0x88, 0x68, 0x48, 0x29,
+  0x09, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa8, 0xc8, 0xce, 0xb0, 0x94, 0x7c,
+  0x78, 0x78, 0x78, 0x78, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd9, 0xc1,
+  0xb1, 0xb4, 0xb0, 0xa9, 0xa8, 0xa4, 0xa4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x58, 0x58, 0x58, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x6c, 0x73, 0x75, 0x78, 0x78, 0x78, 0x78,
+  0x74, 0x6b, 0x5b, 0x48, 0x31, 0x19, 0x00, 0x00, 0x00, 0x15, 0x32, 0x4b,
+  0x5b, 0x5c, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x56, 0x3b, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x3e, 0x59, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x5e, 0x45, 0x28, 0x0a, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x2d, 0x49, 0x63,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6a, 0x4e, 0x2f, 0x10, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd9, 0xba, 0x9d, 0x8c, 0x84, 0x7c, 0x78, 0x7c, 0x95, 0xb2, 0xd1, 0xc9,
+  0xab, 0x92, 0x88, 0x84, 0x78, 0x78, 0x89, 0xa2, 0xc0, 0xd8, 0xb8, 0x99,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd9, 0xba, 0x9d, 0x8c, 0x84, 0x7c, 0x78, 0x78, 0x7a, 0x92, 0xae, 0xcd,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xab, 0xc9, 0xcc, 0xad, 0x90, 0x73, 0x6c, 0x6c, 0x6c, 0x6c, 0x72, 0x8e,
+  0xac, 0xcc, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd9, 0xba, 0x9d, 0x8c, 0x84, 0x7c, 0x78, 0x78,
+  0x7a, 0x92, 0xae, 0xcd, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x58, 0x58,
+  0x58, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xde, 0xc2, 0xaa, 0x9c,
+  0x92, 0x8c, 0x88, 0x84, 0x84, 0x84, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x39, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd8,
+  0xb8, 0x99, 0x89, 0x90, 0x94, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x95, 0x89,
+  0x75, 0x5e, 0x44, 0x2a, 0x0e, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x77, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x24, 0x44, 0x63, 0x7c, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x3e, 0x59, 0x73, 0x91, 0x94,
+  0x94, 0x94, 0x94, 0x8b, 0x6c, 0x4f, 0x30, 0x10, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x63, 0x5c, 0x58, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88,
+  0x68, 0x60, 0x5b, 0x5a, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x63, 0x5c, 0x58, 0x58, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x4c, 0x4c, 0x4c, 0x4c, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x63, 0x5c, 0x58, 0x58, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x39, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x7c, 0x72, 0x69,
+  0x64, 0x60, 0x60, 0x60, 0x5d, 0x47, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc4, 0xae,
+  0xa8, 0xae, 0xb4, 0xb8, 0xbc, 0xbc, 0xbc, 0xbb, 0xb4, 0xa2, 0x8d, 0x70,
+  0x55, 0x38, 0x1a, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa0, 0xa0, 0xa0, 0xa0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x4e, 0x69, 0x86, 0xa2, 0xb4, 0xb4, 0xb0,
+  0x95, 0x77, 0x5d, 0x42, 0x25, 0x09, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x3d, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x3c, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x3d, 0x39, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x2d, 0x2d, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x3d, 0x39, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x4b, 0x44, 0x42,
+  0x41, 0x41, 0x3f, 0x31, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xd1, 0xc0, 0xb8, 0xb4,
+  0xb4, 0xb0, 0xb0, 0xb0, 0xbb, 0xcf, 0xcf, 0xb8, 0x9e, 0x7c, 0x60, 0x42,
+  0x23, 0x04, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc0, 0xc0, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x43, 0x5e, 0x78, 0x96, 0xb2, 0xcc, 0xbc, 0xa0, 0x86, 0x67,
+  0x4c, 0x32, 0x16, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58,
+  0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x25, 0x23, 0x21, 0x21,
+  0x1f, 0x16, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x31, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdc, 0xbe, 0xa5, 0x98, 0x94, 0x94, 0x90,
+  0x90, 0x92, 0xa2, 0xb9, 0xd5, 0xc6, 0xa8, 0x88, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb4, 0xc6, 0xdf, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x53, 0x6e, 0x8b, 0xa7, 0xc2, 0xc7, 0xab, 0x90, 0x73, 0x58, 0x3d, 0x21,
+  0x06, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c,
+  0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x9c,
+  0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x04, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x50, 0x50, 0x52, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x78, 0x74, 0x70, 0x6c, 0x6c, 0x72,
+  0x8e, 0xac, 0xcc, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x99, 0xb6, 0xd5, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x63, 0x7c,
+  0x9b, 0xb7, 0xd2, 0xb7, 0x9c, 0x7c, 0x63, 0x48, 0x2d, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c, 0x90, 0xb0,
+  0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb,
+  0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x31, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcc,
+  0xad, 0x90, 0x73, 0x70, 0x70, 0x70, 0x74, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x50, 0x4e, 0x4c, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1b, 0x3a, 0x57,
+  0x6c, 0x6c, 0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x70, 0x73, 0x90, 0xab, 0xc7,
+  0xc2, 0xa7, 0x8b, 0x6e, 0x54, 0x37, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7,
+  0xa8, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x31, 0x31, 0x48, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x3d, 0x3d, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x50, 0x50,
+  0x54, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x28, 0x47, 0x65, 0x88, 0xa7, 0xc5, 0xd7, 0xbb, 0xa2,
+  0x94, 0x94, 0x94, 0x94, 0x98, 0x9c, 0xaa, 0xc5, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x2f, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x50,
+  0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xda, 0xbb, 0x9f, 0x94, 0x94, 0x94, 0xa2, 0xbc, 0xcd, 0xb2, 0x97,
+  0x78, 0x5e, 0x43, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88,
+  0x64, 0x44, 0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58,
+  0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x50, 0x50, 0x50, 0x50, 0x68, 0x8c, 0xac, 0xcb,
+  0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x5c, 0x5c, 0x5c, 0x5c, 0x68, 0x8c,
+  0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xca, 0xcc, 0xad, 0x90, 0x75, 0x70, 0x70, 0x74, 0x75,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x23, 0x41, 0x5f, 0x7c, 0x9d, 0xb7, 0xcd, 0xcf, 0xbc, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb7, 0xbb, 0xc3, 0xd7, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x15, 0x25, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf,
+  0xcc, 0xb9, 0xb4, 0xb4, 0xb4, 0xbb, 0xcf, 0xbf, 0xa2, 0x88, 0x6a, 0x4e,
+  0x33, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44,
+  0x39, 0x58, 0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68,
+  0x48, 0x29, 0x09, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xa9, 0xc8, 0xcd, 0xae,
+  0x90, 0x75, 0x70, 0x70, 0x70, 0x70, 0x75, 0x90, 0xad, 0xcc, 0xca, 0xac,
+  0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x94, 0xb0, 0xce,
+  0xc8, 0xa9, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x08, 0x27, 0x46, 0x64, 0x88,
+  0xa6, 0xc5, 0xd7, 0xbc, 0xa5, 0x94, 0x94, 0x94, 0x94, 0x98, 0x9c, 0xaa,
+  0xc5, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x37, 0x54, 0x6f, 0x8b, 0xa2, 0xb1, 0xb8, 0xbc, 0xbc, 0xb8, 0xb5, 0xb0,
+  0xac, 0xa8, 0xb3, 0xcb, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xcf, 0xbc,
+  0xb8, 0xb8, 0xb8, 0xc0, 0xd4, 0xbd, 0x9e, 0x84, 0x64, 0x49, 0x2d, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x4c, 0x6c, 0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58,
+  0x78, 0x9c, 0xbc, 0xdb, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29,
+  0x09, 0x07, 0x25, 0x44, 0x64, 0x88, 0xa5, 0xc3, 0xd7, 0xbc, 0xa5, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0xa2, 0xbb, 0xd7, 0xc4, 0xa6, 0x88, 0x64,
+  0x46, 0x27, 0x08, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdd, 0xc0,
+  0xa8, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xab, 0xc1, 0xdb, 0xc0, 0xa3,
+  0x84, 0x64, 0x44, 0x25, 0x07, 0x03, 0x22, 0x40, 0x5f, 0x7c, 0x9c, 0xb6,
+  0xcc, 0xd1, 0xbe, 0xb4, 0xb4, 0xb4, 0xb4, 0xb8, 0xbc, 0xc3, 0xd7, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x29, 0x43,
+  0x5b, 0x72, 0x88, 0x94, 0x99, 0x9c, 0x9c, 0x98, 0x97, 0x92, 0x8c, 0x88,
+  0xa1, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdb, 0xbc, 0xa2, 0x98, 0x98,
+  0x98, 0xa8, 0xc2, 0xc9, 0xac, 0x92, 0x73, 0x57, 0x3d, 0x20, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c,
+  0x90, 0xb0, 0xcf, 0xc7, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x9c,
+  0xbc, 0xcf, 0xbc, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48,
+  0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x02,
+  0x21, 0x3f, 0x5d, 0x7a, 0x99, 0xb4, 0xca, 0xd1, 0xbe, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xbe, 0xcf, 0xcb, 0xb5, 0x9b, 0x7c, 0x5e, 0x40, 0x22,
+  0x03, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xd4, 0xc4, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc7, 0xcc, 0xc2, 0xae, 0x95, 0x77, 0x5b,
+  0x3d, 0x1f, 0x00, 0x00, 0x19, 0x36, 0x54, 0x6e, 0x8b, 0xa0, 0xb0, 0xb8,
+  0xbc, 0xb8, 0xb8, 0xb4, 0xb0, 0xab, 0xa8, 0xb3, 0xcb, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xcf, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x37, 0x4b, 0x59,
+  0x69, 0x73, 0x78, 0x78, 0x78, 0x77, 0x74, 0x70, 0x6c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x74, 0x7a, 0x97,
+  0xb4, 0xce, 0xbc, 0xa0, 0x86, 0x67, 0x4b, 0x30, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x34, 0x29, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xb0, 0xb0, 0xb0, 0x98, 0x74, 0x54, 0x35, 0x4c, 0x6c, 0x90, 0xb0,
+  0xb0, 0xb0, 0xa8, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x9c, 0xb0, 0xb0,
+  0xb0, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xb0, 0xb0, 0xb0, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c,
+  0xac, 0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x17, 0x34,
+  0x50, 0x6c, 0x89, 0x9e, 0xae, 0xb7, 0xba, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xba, 0xb7, 0xae, 0x9f, 0x89, 0x6c, 0x52, 0x35, 0x18, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xdf, 0xc9, 0xb5, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xac, 0xa5, 0x96, 0x84, 0x67, 0x4c, 0x30, 0x14,
+  0x00, 0x00, 0x0d, 0x28, 0x42, 0x5b, 0x72, 0x86, 0x92, 0x98, 0x9c, 0x99,
+  0x98, 0x94, 0x90, 0x8c, 0x88, 0xa1, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x63, 0x70, 0x70, 0x6c,
+  0x6b, 0x68, 0x68, 0x64, 0x64, 0x64, 0x64, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x6b, 0x89, 0xa3, 0xc0,
+  0xcb, 0xb0, 0x94, 0x75, 0x5b, 0x3e, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x55, 0x54,
+  0x53, 0x42, 0x29, 0x0c, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x74, 0x54, 0x35, 0x4c, 0x6c, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x88, 0x64, 0x44, 0x39, 0x58, 0x78, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0x90, 0x90,
+  0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x09, 0x25, 0x40, 0x59,
+  0x6f, 0x84, 0x90, 0x98, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c,
+  0x98, 0x90, 0x84, 0x6f, 0x59, 0x41, 0x27, 0x0b, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd9, 0xba, 0x9d, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x8e, 0x88, 0x78, 0x67, 0x53, 0x3b, 0x21, 0x05, 0x00, 0x00,
+  0x00, 0x16, 0x2f, 0x45, 0x58, 0x67, 0x72, 0x74, 0x78, 0x78, 0x74, 0x73,
+  0x70, 0x69, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0x90, 0x90, 0x8c, 0x8c,
+  0x88, 0x88, 0x88, 0x88, 0x86, 0x91, 0xa9, 0xc5, 0xd4, 0xb4, 0x95, 0x74,
+  0x54, 0x35, 0x15, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x5b, 0x77, 0x95, 0xb0, 0xcc, 0xbe,
+  0xa3, 0x88, 0x69, 0x4e, 0x32, 0x16, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xc0, 0xd8, 0xb9, 0x9b, 0x84, 0x74, 0x74, 0x6f, 0x53,
+  0x34, 0x14, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x69, 0x50, 0x32, 0x49, 0x64, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x5e, 0x41, 0x36, 0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6b, 0x54,
+  0x36, 0x17, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x69, 0x50, 0x32, 0x26, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x00, 0x14, 0x2c, 0x42, 0x56, 0x65,
+  0x70, 0x74, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x74, 0x70,
+  0x65, 0x57, 0x42, 0x2c, 0x15, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x67, 0x5d, 0x4e, 0x3c, 0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x18, 0x2c, 0x3d, 0x4a, 0x54, 0x57, 0x58, 0x58, 0x54, 0x54, 0x50, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x50, 0x32,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xb0, 0xac, 0xac, 0xa8, 0xa8,
+  0xa8, 0xa8, 0xa4, 0xac, 0xbe, 0xd5, 0xc9, 0xac, 0x90, 0x70, 0x50, 0x31,
+  0x11, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xb4, 0xd3, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x4c, 0x67, 0x86, 0xa2, 0xbd, 0xce, 0xb2, 0x96,
+  0x78, 0x5d, 0x41, 0x25, 0x09, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0x9c, 0xbb, 0xd9, 0xc7, 0xb0, 0x9d, 0x98, 0x98, 0x74, 0x54, 0x35, 0x15,
+  0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b,
+  0x3c, 0x25, 0x37, 0x49, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x45, 0x31,
+  0x28, 0x3f, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x3f, 0x28, 0x0d,
+  0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b,
+  0x3c, 0x25, 0x1b, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47,
+  0x34, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2a, 0x3b, 0x49, 0x52, 0x54,
+  0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x54, 0x52, 0x49, 0x3b,
+  0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0,
+  0xd7, 0xb8, 0x98, 0x74, 0x54, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x48,
+  0x3f, 0x32, 0x22, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x20, 0x2c, 0x34, 0x38, 0x39, 0x39, 0x35, 0x34, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x10, 0x2b,
+  0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x3c, 0x25, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x29, 0x48, 0x68, 0x8c, 0xac, 0xb9, 0xbc, 0xc0, 0xc0, 0xc3, 0xc3, 0xc6,
+  0xc4, 0xc7, 0xc7, 0xc1, 0xb3, 0x9c, 0x84, 0x63, 0x47, 0x29, 0x0b, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xcf,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x07, 0x09,
+  0x09, 0x25, 0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xb8, 0x98,
+  0x74, 0x54, 0x3d, 0x59, 0x75, 0x92, 0xae, 0xca, 0xc2, 0xa5, 0x89, 0x6c,
+  0x50, 0x34, 0x19, 0x00, 0x00, 0x00, 0x18, 0x37, 0x55, 0x73, 0x92, 0xad,
+  0xc6, 0xd5, 0xc8, 0xbb, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00,
+  0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10,
+  0x1e, 0x2a, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x28, 0x1a, 0x12, 0x24,
+  0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x24, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10,
+  0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1e, 0x2b, 0x33, 0x36, 0x39, 0x39,
+  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x36, 0x33, 0x2b, 0x1e, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8,
+  0x98, 0x74, 0x54, 0x35, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x28, 0x21, 0x16,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0e,
+  0x15, 0x18, 0x19, 0x19, 0x15, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48,
+  0x68, 0x8c, 0x98, 0x9b, 0x9c, 0xa0, 0xa0, 0xa4, 0xa4, 0xa8, 0xa8, 0xa8,
+  0xa8, 0xa3, 0x97, 0x86, 0x6c, 0x55, 0x39, 0x1d, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0x98, 0x74, 0x54, 0x35, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb0, 0xb0, 0xb0, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x07, 0x1b, 0x26, 0x29, 0x29, 0x29,
+  0x44, 0x64, 0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0x98, 0x74, 0x54,
+  0x35, 0x49, 0x65, 0x84, 0x9e, 0xb0, 0xb0, 0xb0, 0x99, 0x7a, 0x60, 0x44,
+  0x27, 0x0a, 0x00, 0x00, 0x0f, 0x2d, 0x49, 0x65, 0x84, 0x99, 0xac, 0xb7,
+  0xb8, 0xb8, 0xb4, 0x98, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x02, 0x0b,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x06, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00,
+  0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0c, 0x14, 0x17, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x19, 0x17, 0x14, 0x0c, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xc0, 0xb8, 0x98, 0x74,
+  0x54, 0x35, 0x15, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0x98,
+  0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x27, 0x46, 0x63, 0x70,
+  0x74, 0x78, 0x78, 0x7c, 0x84, 0x84, 0x84, 0x88, 0x88, 0x88, 0x88, 0x84,
+  0x78, 0x6b, 0x56, 0x3f, 0x29, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68,
+  0x8c, 0x90, 0x90, 0x90, 0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x1c, 0x34, 0x45, 0x48, 0x48, 0x48, 0x48, 0x64,
+  0x88, 0xa8, 0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0x90, 0x90, 0x90, 0x90, 0x90, 0x74, 0x54, 0x35, 0x3b,
+  0x56, 0x72, 0x90, 0x90, 0x90, 0x90, 0x90, 0x8d, 0x6e, 0x50, 0x30, 0x11,
+  0x00, 0x00, 0x02, 0x1e, 0x39, 0x53, 0x6a, 0x7c, 0x90, 0x98, 0x98, 0x98,
+  0x95, 0x92, 0x74, 0x54, 0x35, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xa0, 0xa0, 0xa0, 0x98, 0x74, 0x54, 0x35,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x3c, 0x5b, 0x77, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x72, 0x54,
+  0x34, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x37, 0x4b, 0x53, 0x54, 0x58,
+  0x5b, 0x5c, 0x60, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64, 0x63, 0x5b, 0x4e,
+  0x3f, 0x29, 0x13, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x50, 0x32, 0x26, 0x45, 0x61, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x26, 0x07, 0x00, 0x00, 0x00, 0x0f,
+  0x2e, 0x4c, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x5b, 0x3d, 0x1f,
+  0x00, 0x0a, 0x29, 0x47, 0x61, 0x68, 0x68, 0x68, 0x68, 0x6b, 0x88, 0xa8,
+  0xc7, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x1b, 0x3a, 0x57,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x69, 0x50, 0x32, 0x2b, 0x47, 0x61,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x67, 0x4c, 0x2e, 0x0f, 0x00, 0x00,
+  0x00, 0x0e, 0x26, 0x3d, 0x53, 0x63, 0x70, 0x74, 0x77, 0x74, 0x74, 0x70,
+  0x69, 0x50, 0x32, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c,
+  0x5c, 0x7a, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x72, 0x54, 0x34, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x32, 0x4b, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x45, 0x2b, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x2d, 0x34, 0x35, 0x39, 0x3c, 0x3d,
+  0x41, 0x41, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x3d, 0x32, 0x24, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4b, 0x3c, 0x25, 0x1b, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3a,
+  0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x43, 0x2e, 0x14, 0x00, 0x0d,
+  0x2d, 0x4c, 0x6c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x99, 0xb2, 0xce, 0xcc,
+  0xad, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x3c, 0x25, 0x1c, 0x34, 0x47, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4a, 0x3a, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x26, 0x38, 0x47, 0x52, 0x55, 0x58, 0x54, 0x54, 0x50, 0x4b, 0x3c,
+  0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x5c,
+  0x5c, 0x5c, 0x5c, 0x5c, 0x5c, 0x59, 0x45, 0x2b, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x32,
+  0x3c, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3b, 0x2d, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x0e, 0x14, 0x16, 0x19, 0x1c, 0x1d, 0x21, 0x21,
+  0x23, 0x25, 0x25, 0x25, 0x25, 0x24, 0x1f, 0x15, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2c, 0x22, 0x10, 0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x29, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x27, 0x17, 0x01, 0x00, 0x0d, 0x2d, 0x4c,
+  0x6c, 0x90, 0xac, 0xac, 0xac, 0xac, 0xb4, 0xc6, 0xda, 0xc2, 0xa5, 0x88,
+  0x68, 0x48, 0x29, 0x0a, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2c, 0x22, 0x10, 0x07, 0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2b, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0x1d, 0x29, 0x33, 0x37, 0x38, 0x35, 0x35, 0x31, 0x2c, 0x22, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x34, 0x3c, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x3b, 0x2d, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x15, 0x1c, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05,
+  0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x09, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x90,
+  0xb0, 0xc3, 0xc4, 0xc7, 0xc7, 0xc6, 0xbe, 0xad, 0x96, 0x78, 0x5d, 0x40,
+  0x22, 0x04, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0c, 0x05, 0x00, 0x00, 0x00, 0x0a, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x14, 0x18, 0x19, 0x15, 0x15, 0x11, 0x0d, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x17, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d,
+  0x1d, 0x1c, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x90, 0xa0, 0xa4,
+  0xa5, 0xa8, 0xa8, 0xa8, 0xa1, 0x94, 0x7c, 0x67, 0x4e, 0x32, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x2d, 0x4c, 0x6c, 0x7c, 0x84, 0x84, 0x88, 0x88,
+  0x88, 0x88, 0x84, 0x75, 0x67, 0x53, 0x3b, 0x22, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x25, 0x41, 0x57, 0x5c, 0x60, 0x60, 0x64, 0x64, 0x64, 0x64,
+  0x60, 0x59, 0x4c, 0x3a, 0x26, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x2b, 0x3a, 0x3d, 0x41, 0x41, 0x44, 0x44, 0x44, 0x44, 0x42, 0x3b,
+  0x30, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x1b, 0x1d, 0x21, 0x21, 0x25, 0x25, 0x25, 0x25, 0x23, 0x1d, 0x12, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x05, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x0b, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x09, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x07, 0x00, 0x00, 0x04, 0x0e,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x0d, 0x02, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x0c, 0x00, 0x00, 0x02, 0x0d, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x10, 0x07, 0x00, 0x00, 0x0c, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16,
+  0x22, 0x2a, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x30, 0x25, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x1b, 0x26, 0x29, 0x29, 0x29, 0x29, 0x29, 0x27, 0x1d, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x29, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x2f, 0x23, 0x10, 0x0a, 0x1f, 0x2d, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x2d, 0x1f, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x27,
+  0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x1a, 0x04, 0x00, 0x10,
+  0x23, 0x2f, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1f, 0x0a, 0x00,
+  0x00, 0x00, 0x15, 0x27, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2c,
+  0x1d, 0x07, 0x1a, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x2b, 0x1a,
+  0x07, 0x1d, 0x2c, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x18,
+  0x01, 0x00, 0x00, 0x00, 0x13, 0x25, 0x30, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x2f, 0x23, 0x10, 0x1a, 0x2b, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x2c, 0x1d, 0x07, 0x00, 0x00, 0x00, 0x15, 0x27, 0x30, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x2b, 0x1a, 0x04, 0x00, 0x10, 0x23, 0x2f, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x2d, 0x1f, 0x0a, 0x00, 0x00, 0x01, 0x18,
+  0x29, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+  0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x29, 0x18, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x14, 0x1e, 0x23, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x22, 0x15, 0x02, 0x00, 0x00, 0x00, 0x03, 0x14, 0x1c, 0x1d,
+  0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x19,
+  0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x22, 0x1c, 0x10, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x15,
+  0x1f, 0x21, 0x21, 0x20, 0x1a, 0x0e, 0x00, 0x00, 0x0e, 0x1a, 0x1c, 0x15,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1f, 0x31, 0x3f, 0x49,
+  0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x4f, 0x3f, 0x28, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x34,
+  0x45, 0x48, 0x48, 0x48, 0x48, 0x48, 0x46, 0x37, 0x1f, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x2d, 0x44, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x4e, 0x3d, 0x25, 0x1d, 0x37, 0x4b, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x4b, 0x37, 0x1d, 0x00, 0x00, 0x0e, 0x2a, 0x42, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x47, 0x31, 0x16, 0x09, 0x25, 0x3d, 0x4e,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4b, 0x37, 0x1d, 0x00, 0x00, 0x0e,
+  0x2a, 0x42, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x49, 0x34, 0x19,
+  0x31, 0x47, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x47, 0x31, 0x19, 0x34,
+  0x49, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x12, 0x00,
+  0x00, 0x0b, 0x27, 0x3f, 0x4f, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4e,
+  0x3d, 0x23, 0x31, 0x47, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x49,
+  0x34, 0x19, 0x00, 0x00, 0x0e, 0x2a, 0x42, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x47, 0x31, 0x16, 0x09, 0x25, 0x3d, 0x4e, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x4b, 0x37, 0x1d, 0x00, 0x00, 0x12, 0x2d, 0x44, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+  0x50, 0x50, 0x50, 0x50, 0x44, 0x2d, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x23, 0x32, 0x3c, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x40, 0x2f, 0x16, 0x00, 0x00, 0x01, 0x1b, 0x30, 0x3b, 0x3d, 0x3d, 0x3d,
+  0x3d, 0x3d, 0x3d, 0x35, 0x23, 0x0b, 0x00, 0x02, 0x1d, 0x34, 0x42, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x41, 0x3a, 0x2e, 0x1e, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x32, 0x3d, 0x41,
+  0x41, 0x40, 0x38, 0x2b, 0x1b, 0x13, 0x29, 0x38, 0x3c, 0x32, 0x1e, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x21, 0x37, 0x4b, 0x5d, 0x68, 0x6c, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6c, 0x54,
+  0x36, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x47, 0x61, 0x68,
+  0x68, 0x68, 0x68, 0x68, 0x63, 0x4b, 0x2d, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x6a, 0x50, 0x32, 0x27, 0x46, 0x63, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x63, 0x46, 0x27, 0x08, 0x00, 0x18, 0x37, 0x55, 0x6e, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x5d, 0x3f, 0x21, 0x14, 0x32, 0x50, 0x6a, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x18, 0x37, 0x55,
+  0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x44, 0x25, 0x3f, 0x5d,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x5d, 0x40, 0x24, 0x42, 0x60, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x59, 0x3b, 0x1c, 0x00, 0x00, 0x14,
+  0x33, 0x52, 0x6c, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x6a, 0x4e, 0x32,
+  0x42, 0x5d, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x60, 0x42, 0x23,
+  0x04, 0x00, 0x18, 0x37, 0x55, 0x6e, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x5d, 0x40, 0x22, 0x14, 0x32, 0x50, 0x6a, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x63, 0x46, 0x27, 0x08, 0x00, 0x1c, 0x3b, 0x59, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+  0x70, 0x70, 0x59, 0x3b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x29, 0x3e, 0x4e, 0x5a, 0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x5b, 0x42,
+  0x24, 0x06, 0x00, 0x0f, 0x2d, 0x48, 0x5a, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x50, 0x37, 0x1a, 0x00, 0x0d, 0x2c, 0x49, 0x60, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x60, 0x57, 0x4a, 0x38, 0x23, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x29, 0x3d, 0x4e, 0x5b, 0x60, 0x60, 0x5f,
+  0x55, 0x47, 0x36, 0x2a, 0x3f, 0x55, 0x5b, 0x4b, 0x34, 0x1e, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0x35, 0x4d, 0x64, 0x77, 0x88, 0x90, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x78, 0x58, 0x39, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2f, 0x4e, 0x6c, 0x8c, 0x8c, 0x8c,
+  0x8c, 0x8c, 0x70, 0x50, 0x31, 0x11, 0x10, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94, 0x94, 0x94, 0x94, 0x74, 0x54,
+  0x35, 0x29, 0x48, 0x68, 0x8c, 0x94, 0x94, 0x94, 0x94, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x19, 0x38, 0x58, 0x75, 0x94, 0x94, 0x94, 0x94, 0x94,
+  0x88, 0x67, 0x49, 0x2b, 0x1e, 0x3c, 0x5a, 0x78, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x84, 0x65, 0x47, 0x28, 0x08, 0x00, 0x19, 0x38, 0x58, 0x77, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x8c, 0x6c, 0x4c, 0x2e, 0x48, 0x67, 0x88, 0x94,
+  0x94, 0x94, 0x94, 0x88, 0x68, 0x49, 0x2d, 0x4c, 0x6b, 0x8b, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x78, 0x59, 0x3b, 0x1c, 0x00, 0x00, 0x14, 0x34, 0x53,
+  0x6f, 0x8d, 0x94, 0x94, 0x94, 0x94, 0x94, 0x78, 0x5e, 0x42, 0x50, 0x6c,
+  0x8b, 0x94, 0x94, 0x94, 0x94, 0x94, 0x7c, 0x60, 0x42, 0x23, 0x04, 0x00,
+  0x19, 0x38, 0x58, 0x75, 0x94, 0x94, 0x94, 0x94, 0x94, 0x88, 0x68, 0x4b,
+  0x2d, 0x1d, 0x3b, 0x5a, 0x78, 0x94, 0x94, 0x94, 0x94, 0x94, 0x86, 0x65,
+  0x47, 0x28, 0x08, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94, 0x94, 0x94, 0x94,
+  0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x7c,
+  0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0x3f, 0x56,
+  0x6a, 0x78, 0x84, 0x88, 0x88, 0x88, 0x88, 0x88, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x15, 0x34, 0x54, 0x73, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x60,
+  0x40, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x84, 0x74, 0x64, 0x50, 0x3a, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x29, 0x3f, 0x56, 0x6a, 0x78, 0x84, 0x84, 0x7c, 0x72, 0x62,
+  0x50, 0x47, 0x56, 0x6c, 0x77, 0x61, 0x4b, 0x33, 0x1b, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x29, 0x45, 0x61, 0x7a, 0x94, 0xa5, 0xae, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00,
+  0x00, 0x01, 0x18, 0x29, 0x34, 0x54, 0x72, 0x94, 0xac, 0xac, 0xac, 0x94,
+  0x70, 0x50, 0x31, 0x31, 0x2f, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xb4, 0xb4, 0x98, 0x74, 0x54, 0x35, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xb4, 0xb4, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x11, 0x30, 0x4c, 0x6b, 0x8b, 0xa7, 0xb4, 0xb4, 0xae, 0x90, 0x70,
+  0x53, 0x35, 0x27, 0x45, 0x64, 0x84, 0xa2, 0xb4, 0xb4, 0xb4, 0x97, 0x77,
+  0x5a, 0x3c, 0x1e, 0x01, 0x00, 0x13, 0x31, 0x4f, 0x6c, 0x8d, 0xac, 0xb4,
+  0xb4, 0xb2, 0x94, 0x74, 0x55, 0x37, 0x50, 0x70, 0x90, 0xad, 0xb4, 0xb4,
+  0xae, 0x90, 0x70, 0x52, 0x36, 0x54, 0x73, 0x94, 0xb1, 0xb4, 0xb4, 0xac,
+  0x8e, 0x6e, 0x50, 0x32, 0x14, 0x00, 0x00, 0x0c, 0x29, 0x44, 0x5e, 0x7a,
+  0x97, 0xb2, 0xb4, 0xb4, 0xa5, 0x8b, 0x6c, 0x50, 0x5e, 0x7a, 0x99, 0xb4,
+  0xb4, 0xb4, 0xa3, 0x89, 0x6c, 0x50, 0x35, 0x19, 0x00, 0x00, 0x11, 0x2e,
+  0x4c, 0x69, 0x88, 0xa5, 0xb4, 0xb4, 0xb0, 0x94, 0x73, 0x55, 0x37, 0x27,
+  0x45, 0x63, 0x84, 0xa1, 0xb4, 0xb4, 0xb4, 0x98, 0x78, 0x5a, 0x3d, 0x1f,
+  0x01, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xb4, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x54, 0x6c, 0x86, 0x97,
+  0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa8, 0xa8, 0xa8, 0xa6, 0xa0, 0x92,
+  0x7c, 0x67, 0x4c, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x23,
+  0x3d, 0x56, 0x6c, 0x86, 0x97, 0xa3, 0xa4, 0x9e, 0x8e, 0x7c, 0x6b, 0x65,
+  0x70, 0x86, 0x91, 0x77, 0x5e, 0x48, 0x31, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x33, 0x52,
+  0x70, 0x8e, 0xa9, 0xbf, 0xcd, 0xc5, 0xb9, 0xb8, 0xb8, 0xb8, 0xb8, 0xb8,
+  0xb8, 0xb8, 0xb8, 0x9c, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x12,
+  0x2d, 0x44, 0x50, 0x58, 0x78, 0x98, 0xb8, 0xcb, 0xb4, 0x94, 0x70, 0x50,
+  0x50, 0x50, 0x4e, 0x3d, 0x23, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd3, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x06,
+  0x24, 0x42, 0x5f, 0x7c, 0x9d, 0xba, 0xd3, 0xb9, 0x9b, 0x7a, 0x5d, 0x3f,
+  0x31, 0x4f, 0x6c, 0x8d, 0xab, 0xc9, 0xc7, 0xa9, 0x8c, 0x6c, 0x4f, 0x31,
+  0x14, 0x00, 0x00, 0x09, 0x27, 0x46, 0x64, 0x84, 0xa2, 0xc0, 0xd3, 0xbb,
+  0x9c, 0x7c, 0x5e, 0x3f, 0x59, 0x78, 0x98, 0xb6, 0xd3, 0xd3, 0xb7, 0x99,
+  0x78, 0x5a, 0x3f, 0x5d, 0x7a, 0x9c, 0xba, 0xd3, 0xc1, 0xa3, 0x86, 0x64,
+  0x46, 0x28, 0x0a, 0x00, 0x00, 0x00, 0x19, 0x34, 0x4e, 0x6a, 0x86, 0xa2,
+  0xbc, 0xd2, 0xb5, 0x99, 0x7a, 0x5e, 0x6e, 0x8d, 0xa7, 0xc3, 0xc9, 0xae,
+  0x94, 0x75, 0x5b, 0x40, 0x25, 0x0a, 0x00, 0x00, 0x05, 0x22, 0x40, 0x5d,
+  0x7a, 0x99, 0xb6, 0xd3, 0xbb, 0x9d, 0x7c, 0x60, 0x42, 0x30, 0x4e, 0x6c,
+  0x8d, 0xab, 0xc9, 0xc9, 0xab, 0x8d, 0x6c, 0x50, 0x32, 0x14, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0xbc, 0xc8, 0xd3, 0xd3, 0xd3, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x29, 0x47, 0x63, 0x84, 0x9c, 0xb2, 0xc0, 0xc6,
+  0xc7, 0xc7, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xb4, 0xc7, 0xc7, 0xc5, 0xbc, 0xac, 0x94, 0x77,
+  0x5b, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x50, 0x6a,
+  0x86, 0x9c, 0xb0, 0xc1, 0xc3, 0xbb, 0xaa, 0x99, 0x8c, 0x88, 0x90, 0x9e,
+  0xa7, 0x8e, 0x75, 0x5e, 0x41, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x58, 0x78, 0x99,
+  0xb7, 0xd5, 0xc5, 0xad, 0x9b, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x98,
+  0x98, 0x98, 0x78, 0x58, 0x39, 0x19, 0x00, 0x00, 0x00, 0x1c, 0x3b, 0x59,
+  0x70, 0x70, 0x7c, 0x9e, 0xbd, 0xd3, 0xb4, 0x94, 0x70, 0x70, 0x70, 0x70,
+  0x6a, 0x4e, 0x2f, 0x10, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x19, 0x37,
+  0x54, 0x72, 0x92, 0xae, 0xcd, 0xc3, 0xa4, 0x86, 0x65, 0x47, 0x3b, 0x59,
+  0x77, 0x97, 0xb5, 0xd3, 0xbc, 0x9e, 0x7c, 0x62, 0x44, 0x25, 0x09, 0x00,
+  0x00, 0x00, 0x1e, 0x3c, 0x5a, 0x78, 0x98, 0xb7, 0xd5, 0xc4, 0xa5, 0x88,
+  0x67, 0x48, 0x62, 0x84, 0xa0, 0xbf, 0xdd, 0xde, 0xc0, 0xa1, 0x84, 0x63,
+  0x47, 0x65, 0x86, 0xa4, 0xc3, 0xd7, 0xb8, 0x99, 0x78, 0x5b, 0x3d, 0x1f,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x23, 0x3e, 0x59, 0x73, 0x91, 0xac, 0xc7,
+  0xc3, 0xa7, 0x8d, 0x6e, 0x7c, 0x9b, 0xb7, 0xd3, 0xb9, 0x9e, 0x84, 0x65,
+  0x4b, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x50, 0x6e, 0x8d,
+  0xab, 0xc7, 0xc6, 0xa8, 0x8b, 0x6c, 0x4e, 0x3a, 0x58, 0x75, 0x95, 0xb4,
+  0xd2, 0xbe, 0xa0, 0x84, 0x63, 0x45, 0x27, 0x09, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9c, 0x9d, 0xb0,
+  0xcd, 0xe8, 0xd4, 0xbe, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x30, 0x50, 0x6e, 0x90, 0xac, 0xc8, 0xdd, 0xc6, 0xb4, 0xac,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xac, 0xac, 0xb7, 0xcc, 0xd8, 0xc0, 0xa3, 0x88, 0x65, 0x47,
+  0x28, 0x08, 0x00, 0x00, 0x00, 0x03, 0x23, 0x41, 0x5e, 0x7a, 0x97, 0xb0,
+  0xc5, 0xba, 0xb8, 0xb9, 0xc3, 0xb4, 0xa9, 0xa8, 0xad, 0xb9, 0xb7, 0x9d,
+  0x7c, 0x62, 0x43, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xbe, 0xd8,
+  0xb9, 0x9b, 0x7c, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x6f, 0x55, 0x37, 0x18, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x94,
+  0x94, 0xa5, 0xc3, 0xd6, 0xb7, 0x9c, 0x94, 0x94, 0x94, 0x94, 0x70, 0x50,
+  0x31, 0x11, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x0e, 0x2c, 0x49, 0x67,
+  0x88, 0xa3, 0xc1, 0xcb, 0xad, 0x90, 0x70, 0x52, 0x44, 0x63, 0x84, 0xa1,
+  0xbf, 0xce, 0xb1, 0x94, 0x73, 0x57, 0x38, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x33, 0x52, 0x70, 0x90, 0xad, 0xcb, 0xcc, 0xad, 0x90, 0x70, 0x50,
+  0x6b, 0x8b, 0xa8, 0xc8, 0xcd, 0xcd, 0xc8, 0xa9, 0x8c, 0x6c, 0x50, 0x6e,
+  0x8e, 0xac, 0xcb, 0xcd, 0xae, 0x90, 0x70, 0x53, 0x34, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x12, 0x2d, 0x49, 0x63, 0x7c, 0x9c, 0xb7, 0xd2, 0xb7,
+  0x9b, 0x7c, 0x8e, 0xa9, 0xc5, 0xc3, 0xa9, 0x8e, 0x70, 0x55, 0x3b, 0x1f,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x45, 0x62, 0x7c, 0x9e, 0xbb,
+  0xd2, 0xb4, 0x95, 0x75, 0x59, 0x42, 0x60, 0x7c, 0xa0, 0xbe, 0xd0, 0xb2,
+  0x95, 0x75, 0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x5b, 0x77,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x89, 0xa8, 0xc8, 0xd1,
+  0xbb, 0xa7, 0x91, 0x77, 0x5b, 0x3c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x95, 0xb4, 0xd4, 0xcc, 0xb0, 0x99, 0x8c, 0x8c, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x8c,
+  0x8c, 0x8e, 0x9f, 0xb9, 0xd5, 0xcb, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x05, 0x25, 0x44, 0x64, 0x86, 0x9c, 0xb3, 0xa9, 0x9c,
+  0x98, 0x9b, 0xa8, 0xb8, 0xc8, 0xc7, 0xcb, 0xbb, 0xa5, 0x8b, 0x6f, 0x54,
+  0x37, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x75, 0x63, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x5f, 0x55, 0x53, 0x42,
+  0x2a, 0x0e, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xb4, 0xbd,
+  0xd2, 0xe2, 0xc9, 0xb7, 0xb4, 0xb4, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x02, 0x21, 0x3e, 0x5b, 0x78, 0x99,
+  0xb6, 0xd3, 0xb7, 0x99, 0x78, 0x5b, 0x4e, 0x6c, 0x8c, 0xa9, 0xc8, 0xc3,
+  0xa5, 0x88, 0x69, 0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29,
+  0x47, 0x65, 0x86, 0xa4, 0xc3, 0xd5, 0xb6, 0x98, 0x78, 0x59, 0x73, 0x94,
+  0xb1, 0xc1, 0xae, 0xae, 0xc1, 0xb2, 0x94, 0x74, 0x58, 0x77, 0x97, 0xb5,
+  0xd4, 0xc4, 0xa5, 0x88, 0x67, 0x49, 0x2b, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x1d, 0x38, 0x54, 0x6e, 0x8b, 0xa7, 0xc2, 0xc5, 0xa9, 0x92,
+  0x9d, 0xb9, 0xce, 0xb4, 0x99, 0x7a, 0x60, 0x45, 0x2a, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x38, 0x55, 0x72, 0x92, 0xae, 0xcc, 0xbe,
+  0xa1, 0x84, 0x63, 0x4c, 0x6b, 0x8b, 0xa8, 0xc6, 0xc5, 0xa8, 0x8b, 0x6b,
+  0x4c, 0x30, 0x11, 0x00, 0x00, 0x00, 0x15, 0x32, 0x4b, 0x58, 0x58, 0x58,
+  0x58, 0x58, 0x58, 0x5b, 0x72, 0x8b, 0x9f, 0xb5, 0xd0, 0xbb, 0xa5, 0x8e,
+  0x77, 0x61, 0x4b, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x6b, 0x68, 0x68, 0x5e, 0x44,
+  0x25, 0x07, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x0e, 0x2d, 0x4b, 0x63, 0x68, 0x68, 0x70,
+  0x90, 0xad, 0xcc, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x00, 0x01, 0x1f, 0x3d, 0x56, 0x6c, 0x86, 0x9c, 0x8e, 0x7c, 0x74, 0x7a,
+  0x8d, 0x9e, 0xac, 0xb4, 0xb0, 0xa2, 0x8e, 0x75, 0x5e, 0x43, 0x29, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9d, 0xbc, 0xdc, 0xbe, 0xa2, 0x8d, 0x84,
+  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x7c, 0x73, 0x63, 0x4d, 0x37, 0x1f,
+  0x04, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xbc, 0xc5, 0xda, 0xe6,
+  0xcf, 0xbf, 0xbc, 0xbc, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54,
+  0x35, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x15, 0x33, 0x50, 0x6e, 0x8d, 0xab, 0xc9,
+  0xc1, 0xa3, 0x84, 0x64, 0x58, 0x75, 0x95, 0xb4, 0xd2, 0xb7, 0x9b, 0x7a,
+  0x5d, 0x40, 0x22, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, 0x3f, 0x5d,
+  0x7a, 0x9b, 0xb9, 0xd7, 0xbf, 0xa0, 0x84, 0x62, 0x7c, 0x9c, 0xba, 0xb1,
+  0x94, 0x94, 0xb0, 0xbb, 0x9d, 0x7c, 0x60, 0x7c, 0xa0, 0xbe, 0xd8, 0xba,
+  0x9c, 0x7c, 0x5e, 0x3f, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x28, 0x43, 0x5e, 0x78, 0x96, 0xb2, 0xcc, 0xbe, 0xb0, 0xb5, 0xc9,
+  0xbe, 0xa3, 0x89, 0x6b, 0x50, 0x35, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x2c, 0x49, 0x67, 0x86, 0xa2, 0xc0, 0xc9, 0xac, 0x8e,
+  0x6e, 0x55, 0x73, 0x94, 0xb2, 0xd0, 0xbb, 0x9d, 0x7c, 0x60, 0x42, 0x24,
+  0x06, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x30, 0x38, 0x39, 0x39, 0x39, 0x48,
+  0x5e, 0x72, 0x8b, 0xa2, 0xb6, 0xcc, 0xbb, 0xa5, 0x8e, 0x75, 0x61, 0x4b,
+  0x34, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x48, 0x48, 0x44, 0x31, 0x19, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x04, 0x1f, 0x37, 0x46, 0x48, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x29, 0x3f, 0x56, 0x6c, 0x89, 0x75, 0x61, 0x54, 0x60, 0x70, 0x84,
+  0x90, 0x94, 0x92, 0x88, 0x75, 0x5e, 0x48, 0x31, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x38, 0x58, 0x75, 0x97, 0xb4, 0xcf, 0xcf, 0xb8, 0xa9, 0xa4, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0x9e, 0x91, 0x7a, 0x64, 0x4b, 0x30, 0x14, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9c, 0x9c, 0xad, 0xc9, 0xd8, 0xbb, 0xa2,
+  0x9c, 0x9c, 0x9c, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x00, 0x0a, 0x27, 0x45, 0x63, 0x84, 0xa0, 0xbe, 0xca, 0xac,
+  0x8e, 0x6e, 0x62, 0x84, 0xa0, 0xbe, 0xca, 0xac, 0x90, 0x70, 0x52, 0x35,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x35, 0x53, 0x70, 0x92,
+  0xb0, 0xce, 0xc8, 0xa8, 0x8b, 0x6b, 0x86, 0xa4, 0xc3, 0xa7, 0x89, 0x88,
+  0xa6, 0xc4, 0xa5, 0x88, 0x69, 0x89, 0xa8, 0xc6, 0xcf, 0xb0, 0x92, 0x72,
+  0x54, 0x36, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x33, 0x4e, 0x69, 0x86, 0xa2, 0xbc, 0xd9, 0xd0, 0xd3, 0xcb, 0xae, 0x94,
+  0x75, 0x5b, 0x40, 0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x20, 0x3d, 0x5a, 0x77, 0x97, 0xb4, 0xd0, 0xb6, 0x99, 0x78, 0x5f,
+  0x7c, 0x9d, 0xbb, 0xce, 0xb0, 0x92, 0x73, 0x55, 0x37, 0x19, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x13, 0x19, 0x1e, 0x33, 0x48, 0x5e, 0x75, 0x8b,
+  0xa2, 0xb8, 0xcf, 0xb8, 0xa2, 0x8e, 0x75, 0x5e, 0x48, 0x34, 0x1e, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x29, 0x25, 0x19, 0x05, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x0a, 0x1d, 0x27, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x29, 0x40, 0x59, 0x6c, 0x5e, 0x48, 0x36, 0x44, 0x55, 0x63, 0x6e, 0x70,
+  0x70, 0x69, 0x5b, 0x48, 0x31, 0x1b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x31, 0x4e,
+  0x6b, 0x89, 0xa2, 0xb7, 0xc4, 0xc7, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+  0xc3, 0xc3, 0xbb, 0xaa, 0x94, 0x75, 0x5a, 0x3c, 0x1e, 0x00, 0x00, 0x1c,
+  0x3c, 0x5b, 0x77, 0x78, 0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94, 0x78, 0x78,
+  0x78, 0x78, 0x6e, 0x50, 0x30, 0x11, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c,
+  0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x3a, 0x58, 0x75, 0x94, 0xb2, 0xd0, 0xb6, 0x98, 0x78,
+  0x6b, 0x8b, 0xa8, 0xc8, 0xbf, 0xa2, 0x84, 0x64, 0x47, 0x29, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x4a, 0x68, 0x88, 0xa6, 0xc4,
+  0xd0, 0xb1, 0x94, 0x73, 0x8e, 0xac, 0xbc, 0x9e, 0x7c, 0x7c, 0x9d, 0xbb,
+  0xad, 0x90, 0x72, 0x92, 0xb0, 0xcf, 0xc5, 0xa7, 0x89, 0x69, 0x4b, 0x2c,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x40,
+  0x5b, 0x75, 0x98, 0xb8, 0xd7, 0xef, 0xe3, 0xc3, 0xa4, 0x84, 0x67, 0x4c,
+  0x32, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x31, 0x4e, 0x6b, 0x8b, 0xa7, 0xc5, 0xc1, 0xa3, 0x86, 0x68, 0x88, 0xa6,
+  0xc5, 0xc3, 0xa5, 0x88, 0x68, 0x4a, 0x2d, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x1e, 0x34, 0x4b, 0x5e, 0x75, 0x8e, 0xa5, 0xb8, 0xcc,
+  0xb8, 0xa2, 0x8b, 0x72, 0x5e, 0x48, 0x31, 0x1b, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2c,
+  0x41, 0x4c, 0x45, 0x31, 0x1b, 0x2a, 0x39, 0x47, 0x50, 0x50, 0x50, 0x4b,
+  0x3e, 0x2e, 0x1b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x40, 0x5b, 0x72,
+  0x8b, 0x9b, 0xa4, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xb8,
+  0xd2, 0xbe, 0xa2, 0x84, 0x64, 0x45, 0x26, 0x07, 0x00, 0x15, 0x32, 0x4b,
+  0x58, 0x60, 0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94, 0x70, 0x58, 0x58, 0x58,
+  0x55, 0x42, 0x27, 0x0a, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0,
+  0xc0, 0xd7, 0xb8, 0x98, 0x74, 0x54, 0x35, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0x2e, 0x4c, 0x6b, 0x89, 0xa7, 0xc5, 0xc0, 0xa1, 0x84, 0x74, 0x94,
+  0xb2, 0xd0, 0xb4, 0x97, 0x77, 0x59, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x22, 0x40, 0x5e, 0x7c, 0x9d, 0xbb, 0xd9, 0xba,
+  0x9c, 0x7c, 0x97, 0xb5, 0xb2, 0x94, 0x74, 0x73, 0x94, 0xb1, 0xb6, 0x98,
+  0x7a, 0x9b, 0xb9, 0xd8, 0xbc, 0x9d, 0x7c, 0x5f, 0x41, 0x23, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x35, 0x50, 0x6b, 0x89,
+  0xa2, 0xbe, 0xd9, 0xd0, 0xd3, 0xcb, 0xb0, 0x94, 0x77, 0x5d, 0x42, 0x27,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x24, 0x42,
+  0x5f, 0x7c, 0x9b, 0xb9, 0xcc, 0xae, 0x90, 0x72, 0x92, 0xb0, 0xce, 0xb9,
+  0x9b, 0x7a, 0x5d, 0x40, 0x22, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x20, 0x34, 0x4b, 0x61, 0x77, 0x8e, 0xa5, 0xbb, 0xcc, 0xb5, 0x9f, 0x8b,
+  0x72, 0x5b, 0x47, 0x31, 0x1d, 0x1c, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2d,
+  0x28, 0x1a, 0x05, 0x0e, 0x1d, 0x29, 0x30, 0x31, 0x31, 0x2c, 0x22, 0x14,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x31, 0x45, 0x5b, 0x6e, 0x7c,
+  0x86, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8b, 0xa8, 0xc8, 0xc9,
+  0xab, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x06, 0x1e, 0x30, 0x41, 0x60,
+  0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x39, 0x39, 0x37, 0x2a,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7,
+  0xb8, 0x98, 0x74, 0x54, 0x3d, 0x3f, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcb,
+  0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24,
+  0x41, 0x5f, 0x7c, 0x9c, 0xba, 0xc9, 0xab, 0x8d, 0x7c, 0x9e, 0xbc, 0xc6,
+  0xa9, 0x8c, 0x6c, 0x4e, 0x31, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x37, 0x55, 0x73, 0x94, 0xb1, 0xcf, 0xc3, 0xa5, 0x90,
+  0xa0, 0xbe, 0xa9, 0x8c, 0x6b, 0x69, 0x8b, 0xa8, 0xbf, 0xa2, 0x90, 0xa3,
+  0xc1, 0xd0, 0xb2, 0x94, 0x74, 0x57, 0x38, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x45, 0x61, 0x7a, 0x99, 0xb4, 0xce,
+  0xbe, 0xb0, 0xb5, 0xc9, 0xc0, 0xa5, 0x8b, 0x6e, 0x53, 0x38, 0x1d, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x35, 0x53, 0x70,
+  0x90, 0xac, 0xc9, 0xba, 0x9c, 0x7c, 0x9b, 0xb9, 0xcb, 0xad, 0x90, 0x70,
+  0x53, 0x35, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x21, 0x37, 0x4d,
+  0x61, 0x77, 0x91, 0xa7, 0xbb, 0xca, 0xb5, 0x9f, 0x89, 0x72, 0x5b, 0x45,
+  0x3d, 0x3d, 0x3d, 0x3c, 0x32, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0d, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x11, 0x0d, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x2b, 0x47, 0x5d, 0x60, 0x5c, 0x5e, 0x64, 0x64,
+  0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x88, 0xa8, 0xc7, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x05, 0x21, 0x41, 0x60, 0x84, 0xa4,
+  0xc3, 0xd3, 0xb4, 0x94, 0x70, 0x50, 0x31, 0x19, 0x18, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd7, 0xb8, 0x98,
+  0x74, 0x5c, 0x5c, 0x5d, 0x63, 0x6b, 0x8c, 0xac, 0xcb, 0xcb, 0xac, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x36, 0x54,
+  0x72, 0x90, 0xae, 0xcc, 0xb5, 0x97, 0x89, 0xa7, 0xc5, 0xbb, 0x9e, 0x7c,
+  0x60, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x2d, 0x4b, 0x69, 0x8b, 0xa8, 0xc6, 0xd2, 0xbc, 0xb0, 0xb7, 0xbe,
+  0xa0, 0x84, 0x62, 0x60, 0x7c, 0x9e, 0xbc, 0xb9, 0xb0, 0xb9, 0xcf, 0xc8,
+  0xa9, 0x8c, 0x6b, 0x4c, 0x2e, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x21, 0x3c, 0x57, 0x72, 0x8e, 0xa9, 0xc3, 0xc3, 0xa8, 0x92,
+  0x9c, 0xb7, 0xd0, 0xb6, 0x9b, 0x7c, 0x63, 0x49, 0x2e, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x29, 0x47, 0x63, 0x84, 0xa0,
+  0xbc, 0xc4, 0xa8, 0x98, 0xa8, 0xc3, 0xc0, 0xa2, 0x86, 0x65, 0x47, 0x29,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x34, 0x4d, 0x64, 0x78, 0x91,
+  0xa7, 0xbe, 0xce, 0xb3, 0x9e, 0x89, 0x6f, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x5b, 0x4b, 0x32, 0x15, 0x00, 0x00, 0x00, 0x13, 0x21, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x1e, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x7c, 0x7c, 0x78, 0x78, 0x77, 0x74, 0x74,
+  0x70, 0x70, 0x70, 0x73, 0x8e, 0xac, 0xca, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x01, 0x21, 0x41, 0x60, 0x84, 0xa4, 0xc3, 0xd3,
+  0xb4, 0x94, 0x70, 0x50, 0x31, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd9, 0xba, 0x9d, 0x86, 0x7c,
+  0x7c, 0x7c, 0x84, 0x8c, 0x94, 0xae, 0xcd, 0xcb, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x49, 0x67, 0x86,
+  0xa3, 0xc0, 0xc2, 0xab, 0xa5, 0xb5, 0xce, 0xb0, 0x92, 0x73, 0x55, 0x38,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24,
+  0x42, 0x60, 0x7c, 0x9e, 0xbd, 0xdc, 0xd7, 0xcf, 0xd3, 0xb5, 0x97, 0x75,
+  0x58, 0x57, 0x74, 0x95, 0xb4, 0xd2, 0xcf, 0xd5, 0xdc, 0xbe, 0xa0, 0x84,
+  0x62, 0x44, 0x25, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x32, 0x4c, 0x67, 0x84, 0x9f, 0xb9, 0xd0, 0xb4, 0x99, 0x7a, 0x8b, 0xa7,
+  0xc2, 0xc7, 0xac, 0x91, 0x75, 0x59, 0x3e, 0x23, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3b, 0x57, 0x74, 0x94, 0xb1, 0xce,
+  0xc0, 0xb8, 0xc0, 0xd3, 0xb5, 0x98, 0x78, 0x5a, 0x3d, 0x1f, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3c, 0x5c, 0x7a, 0x94, 0xa7, 0xbe, 0xd4,
+  0xc7, 0xa8, 0x88, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x77,
+  0x5b, 0x3c, 0x1c, 0x00, 0x00, 0x13, 0x2c, 0x3e, 0x44, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x44, 0x3b, 0x26, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x94, 0xa0, 0x9c, 0x9c, 0x98, 0x98, 0x98, 0x94, 0x94,
+  0x94, 0x94, 0xa2, 0xb9, 0xd5, 0xc6, 0xa8, 0x89, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x01, 0x21, 0x41, 0x60, 0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94,
+  0x70, 0x50, 0x31, 0x15, 0x15, 0x15, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x1d,
+  0x3d, 0x5c, 0x7c, 0x9c, 0xbb, 0xd9, 0xc9, 0xb3, 0xa1, 0xa0, 0xa0, 0xa0,
+  0xa4, 0xa9, 0xb1, 0xc1, 0xd9, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x3d, 0x5b, 0x78, 0x98, 0xb5,
+  0xd3, 0xc8, 0xc4, 0xce, 0xc3, 0xa5, 0x88, 0x68, 0x4a, 0x2d, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x38, 0x58,
+  0x75, 0x95, 0xb4, 0xd2, 0xef, 0xe7, 0xc9, 0xab, 0x8d, 0x6c, 0x4f, 0x4e,
+  0x6c, 0x8c, 0xa9, 0xc8, 0xe6, 0xef, 0xd3, 0xb5, 0x97, 0x75, 0x58, 0x3a,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x42, 0x5e,
+  0x77, 0x95, 0xb0, 0xcb, 0xc0, 0xa5, 0x89, 0x6c, 0x7a, 0x97, 0xb4, 0xce,
+  0xbd, 0xa2, 0x88, 0x6a, 0x50, 0x34, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x2e, 0x4b, 0x69, 0x88, 0xa5, 0xc2, 0xdd, 0xd7,
+  0xdd, 0xc9, 0xab, 0x8d, 0x6c, 0x50, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xd4, 0xeb, 0xce, 0xb3,
+  0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x02, 0x21, 0x3e, 0x59, 0x64, 0x65, 0x77, 0x98, 0xb8, 0xd7,
+  0xbc, 0x9e, 0x7c, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa7, 0xc4, 0xcf,
+  0xb0, 0x90, 0x70, 0x64, 0x64, 0x53, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50,
+  0x70, 0x94, 0xb4, 0xbc, 0xbc, 0xb8, 0xb8, 0xb7, 0xb4, 0xb4, 0xb4, 0xb4,
+  0xbc, 0xcf, 0xcd, 0xb8, 0x9e, 0x7c, 0x60, 0x42, 0x23, 0x05, 0x00, 0x00,
+  0x01, 0x21, 0x41, 0x60, 0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94, 0x70, 0x50,
+  0x35, 0x35, 0x35, 0x34, 0x2d, 0x1b, 0x03, 0x00, 0x00, 0x18, 0x37, 0x55,
+  0x73, 0x92, 0xad, 0xc6, 0xd5, 0xcb, 0xc0, 0xc0, 0xc0, 0xc0, 0xb9, 0xa9,
+  0xa0, 0xad, 0xc7, 0xcb, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x32, 0x50, 0x6c, 0x8d, 0xab, 0xc8, 0xcf,
+  0xcf, 0xcf, 0xb7, 0x99, 0x7a, 0x5d, 0x3f, 0x22, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x4e, 0x6c, 0x8c,
+  0xa9, 0xc8, 0xcf, 0xcf, 0xc0, 0xa2, 0x84, 0x63, 0x45, 0x44, 0x62, 0x84,
+  0xa1, 0xbf, 0xcf, 0xcf, 0xc9, 0xab, 0x8d, 0x6c, 0x4f, 0x31, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1e, 0x38, 0x54, 0x6e, 0x8b, 0xa5,
+  0xc0, 0xcc, 0xb0, 0x95, 0x77, 0x5d, 0x6b, 0x89, 0xa3, 0xbf, 0xcd, 0xb2,
+  0x97, 0x7a, 0x60, 0x45, 0x2a, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x22, 0x3f, 0x5d, 0x78, 0x99, 0xb5, 0xd3, 0xf0, 0xdc, 0xbe,
+  0xa0, 0x84, 0x63, 0x45, 0x27, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x3d, 0x5c, 0x7c, 0xa0, 0xc0, 0xcf, 0xcf, 0xcf, 0xcb, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x05, 0x25, 0x44, 0x64, 0x88, 0x88, 0x90, 0xa5, 0xc0, 0xbc, 0xaa, 0x91,
+  0x73, 0x57, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x05, 0x23, 0x41, 0x5f, 0x7c, 0x99, 0xb0, 0xc1, 0xb9, 0x9f,
+  0x8c, 0x88, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94,
+  0xa8, 0xac, 0xb0, 0xb0, 0xb4, 0xb4, 0xb8, 0xb8, 0xb8, 0xb8, 0xbc, 0xb8,
+  0xb1, 0xa2, 0x8b, 0x70, 0x55, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x21,
+  0x41, 0x60, 0x84, 0xa4, 0xc3, 0xd3, 0xb4, 0x94, 0x70, 0x54, 0x54, 0x54,
+  0x54, 0x54, 0x48, 0x30, 0x14, 0x00, 0x00, 0x0f, 0x2d, 0x49, 0x65, 0x84,
+  0x99, 0xac, 0xb6, 0xba, 0xba, 0xb7, 0xb0, 0xa7, 0x9c, 0x8e, 0x7c, 0x9e,
+  0xb0, 0xb0, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x27, 0x45, 0x62, 0x84, 0xa0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xac, 0x8e, 0x70, 0x52, 0x34, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x25, 0x44, 0x63, 0x84, 0xa1, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x98, 0x78, 0x5a, 0x3c, 0x3b, 0x59, 0x77, 0x97, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xa2, 0x84, 0x63, 0x45, 0x27, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x2e, 0x49, 0x64, 0x7c, 0x9c, 0xb0, 0xb0, 0xb0,
+  0xa2, 0x86, 0x69, 0x4c, 0x5b, 0x77, 0x94, 0xb0, 0xb0, 0xb0, 0xa8, 0x8e,
+  0x70, 0x56, 0x3b, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1d, 0x27,
+  0x29, 0x33, 0x50, 0x6c, 0x8d, 0xa9, 0xc8, 0xe6, 0xd0, 0xb2, 0x95, 0x75,
+  0x58, 0x3a, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d,
+  0x5c, 0x7c, 0xa0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x25,
+  0x44, 0x64, 0x88, 0xa8, 0xad, 0xbc, 0xb6, 0xa0, 0x91, 0x7a, 0x63, 0x49,
+  0x2d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x35, 0x50, 0x6a, 0x84, 0x95, 0xa5, 0xbd, 0xb6, 0xab, 0xa0,
+  0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x31, 0x50, 0x70, 0x88, 0x8b, 0x8c,
+  0x90, 0x90, 0x94, 0x94, 0x98, 0x98, 0x98, 0x98, 0x9c, 0x98, 0x94, 0x88,
+  0x72, 0x5b, 0x44, 0x2a, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x21, 0x41, 0x60,
+  0x84, 0xa0, 0xc0, 0xd6, 0xb7, 0x9b, 0x7c, 0x74, 0x74, 0x74, 0x74, 0x73,
+  0x5a, 0x3b, 0x1c, 0x00, 0x00, 0x02, 0x1e, 0x39, 0x53, 0x6a, 0x7c, 0x8e,
+  0x98, 0x9c, 0x9c, 0x98, 0x92, 0x89, 0x7c, 0x70, 0x77, 0x90, 0x90, 0x90,
+  0x90, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x3a, 0x57, 0x74, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84,
+  0x64, 0x46, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x3b, 0x59, 0x77, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x6e, 0x50, 0x32, 0x31, 0x4f, 0x6c, 0x8e, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x78, 0x5a, 0x3c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x38, 0x58, 0x75, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x73,
+  0x59, 0x3d, 0x4b, 0x67, 0x86, 0x90, 0x90, 0x90, 0x90, 0x90, 0x84, 0x65,
+  0x47, 0x28, 0x08, 0x00, 0x00, 0x00, 0x05, 0x20, 0x37, 0x46, 0x48, 0x48,
+  0x48, 0x62, 0x84, 0xa4, 0xc3, 0xe3, 0xc5, 0xa8, 0x8b, 0x6b, 0x4c, 0x30,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c,
+  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90, 0x90, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x05, 0x25, 0x44, 0x64,
+  0x88, 0xa8, 0xc7, 0xcb, 0xac, 0x8c, 0x73, 0x63, 0x4d, 0x37, 0x1d, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x25, 0x3d, 0x53, 0x69, 0x78, 0x94, 0xb4, 0xd2, 0xc0, 0xa0, 0x7c, 0x5c,
+  0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x2c, 0x49, 0x60, 0x64, 0x68, 0x69, 0x6c, 0x70,
+  0x70, 0x70, 0x74, 0x74, 0x74, 0x74, 0x78, 0x75, 0x72, 0x69, 0x59, 0x45,
+  0x2f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3d, 0x5c, 0x7c, 0x9d,
+  0xbc, 0xdb, 0xc5, 0xad, 0x9d, 0x98, 0x98, 0x98, 0x98, 0x7c, 0x5c, 0x3d,
+  0x1d, 0x00, 0x00, 0x00, 0x0e, 0x26, 0x3d, 0x53, 0x63, 0x70, 0x74, 0x78,
+  0x78, 0x74, 0x70, 0x69, 0x5f, 0x54, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x61, 0x45, 0x26, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x2e, 0x4c, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x57, 0x3b,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x31, 0x4e, 0x67, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x61, 0x47, 0x29, 0x28, 0x45, 0x61, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x69, 0x50, 0x32, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x36, 0x54, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x64, 0x49, 0x2d,
+  0x3d, 0x57, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x45, 0x26,
+  0x07, 0x00, 0x00, 0x00, 0x11, 0x30, 0x4c, 0x63, 0x68, 0x68, 0x68, 0x6c,
+  0x86, 0xa4, 0xc4, 0xd7, 0xbb, 0x9d, 0x7c, 0x60, 0x42, 0x24, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3a, 0x57, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0xa8,
+  0xad, 0xbc, 0xb6, 0xa0, 0x91, 0x7a, 0x63, 0x49, 0x2d, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x19, 0x35, 0x50,
+  0x6a, 0x84, 0x95, 0xa5, 0xbd, 0xb6, 0xab, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x1d, 0x34, 0x42, 0x44, 0x48, 0x4b, 0x4c, 0x50, 0x50, 0x53,
+  0x54, 0x54, 0x54, 0x57, 0x58, 0x58, 0x54, 0x4b, 0x3e, 0x2d, 0x18, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x57, 0x74, 0x94, 0xb0, 0xc6,
+  0xd5, 0xc7, 0xba, 0xb8, 0xb8, 0xb8, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x26, 0x38, 0x46, 0x50, 0x54, 0x58, 0x58, 0x54,
+  0x52, 0x4b, 0x41, 0x3c, 0x4b, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x34,
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x21, 0x3a,
+  0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x41, 0x2b, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x22, 0x3a, 0x4a, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x34,
+  0x1c, 0x1b, 0x34, 0x47, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4b, 0x3c,
+  0x25, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x28, 0x3f,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x49, 0x37, 0x1e, 0x2b, 0x41,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x47, 0x34, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x8c, 0x8c, 0x8c, 0x8c, 0x99, 0xb0,
+  0xcc, 0xc9, 0xac, 0x90, 0x72, 0x55, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x41, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c, 0x4c,
+  0x41, 0x2b, 0x10, 0x00, 0x05, 0x25, 0x44, 0x64, 0x88, 0x88, 0x90, 0xa5,
+  0xc0, 0xbc, 0xaa, 0x91, 0x73, 0x57, 0x38, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x05, 0x23, 0x41, 0x5f, 0x7c, 0x99,
+  0xb0, 0xc1, 0xb9, 0x9f, 0x8c, 0x88, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x19, 0x23, 0x25, 0x29, 0x2c, 0x2d, 0x31, 0x31, 0x34, 0x35, 0x35,
+  0x35, 0x38, 0x39, 0x38, 0x34, 0x2d, 0x22, 0x13, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x2e, 0x4b, 0x67, 0x84, 0x99, 0xac, 0xb6, 0xba,
+  0xb8, 0xb8, 0xb7, 0xb4, 0xa0, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x1d, 0x29, 0x32, 0x36, 0x39, 0x39, 0x36, 0x33, 0x2c,
+  0x23, 0x22, 0x2c, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x20, 0x2b, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x20, 0x2b, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07, 0x07,
+  0x1c, 0x29, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2c, 0x22, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x24, 0x2c, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2a, 0x1e, 0x0a, 0x15, 0x25, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x29, 0x1c, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0x35, 0x54, 0x74, 0x98, 0xac, 0xac, 0xac, 0xb5, 0xc6, 0xce, 0xb6,
+  0x9d, 0x84, 0x63, 0x47, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x25, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
+  0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x25, 0x15,
+  0x00, 0x00, 0x02, 0x21, 0x3e, 0x59, 0x64, 0x65, 0x77, 0x98, 0xb8, 0xd7,
+  0xbc, 0x9e, 0x7c, 0x5f, 0x40, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x89, 0xa7, 0xc4, 0xcf,
+  0xb0, 0x90, 0x70, 0x64, 0x64, 0x53, 0x37, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x06, 0x09, 0x0c, 0x0d, 0x11, 0x11, 0x14, 0x15, 0x15, 0x15, 0x18,
+  0x19, 0x19, 0x15, 0x0e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x20, 0x3c, 0x54, 0x6c, 0x84, 0x90, 0x98, 0x9c, 0x98, 0x98,
+  0x98, 0x94, 0x92, 0x7c, 0x5c, 0x3d, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x13, 0x17, 0x19, 0x19, 0x17, 0x14, 0x0d, 0x05, 0x05,
+  0x0c, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0b, 0x02, 0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35,
+  0x54, 0x74, 0x98, 0xb8, 0xc5, 0xc7, 0xc7, 0xc1, 0xb4, 0xa2, 0x8b, 0x6f,
+  0x55, 0x39, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+  0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x2c, 0x3e, 0x44, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x44, 0x3b, 0x26, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x28, 0x3f, 0x53, 0x63, 0x70, 0x74, 0x78, 0x74, 0x74, 0x74, 0x70,
+  0x70, 0x6c, 0x57, 0x3a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74,
+  0x98, 0xa4, 0xa6, 0xa8, 0xa8, 0xa2, 0x98, 0x89, 0x72, 0x5b, 0x42, 0x29,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0x21, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00,
+  0x09, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x1e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x26, 0x39, 0x47, 0x50, 0x54, 0x58, 0x54, 0x54, 0x54, 0x52, 0x50, 0x4c,
+  0x41, 0x2b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x34, 0x54, 0x72, 0x7c, 0x84,
+  0x88, 0x88, 0x88, 0x84, 0x78, 0x6c, 0x5b, 0x45, 0x2f, 0x16, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29,
+  0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1d,
+  0x29, 0x32, 0x36, 0x39, 0x36, 0x35, 0x35, 0x33, 0x31, 0x2d, 0x25, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x2b, 0x45, 0x59, 0x5d, 0x60, 0x64, 0x64,
+  0x64, 0x62, 0x5b, 0x50, 0x40, 0x2e, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68,
+  0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x13,
+  0x17, 0x19, 0x17, 0x15, 0x15, 0x14, 0x11, 0x0d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3f, 0x41, 0x44, 0x44, 0x44, 0x43,
+  0x3c, 0x32, 0x25, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60,
+  0x41, 0x21, 0x01, 0x00, 0x00, 0x00, 0x09, 0x29, 0x48, 0x68, 0x8c, 0xac,
+  0xcb, 0xcf, 0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x12, 0x1c, 0x1f, 0x22, 0x25, 0x25, 0x25, 0x24, 0x1e, 0x15,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7,
+  0xc3, 0xa4, 0x84, 0x60, 0x41, 0x29, 0x25, 0x19, 0x05, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4, 0x84, 0x60, 0x41, 0x21,
+  0x01, 0x00, 0x0a, 0x1d, 0x27, 0x29, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf,
+  0xb0, 0x90, 0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x05, 0x05, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc3, 0xa4,
+  0x84, 0x60, 0x48, 0x48, 0x44, 0x31, 0x19, 0x00, 0x00, 0x15, 0x35, 0x54,
+  0x74, 0x98, 0xb8, 0xc0, 0xc0, 0xa4, 0x84, 0x60, 0x41, 0x21, 0x01, 0x04,
+  0x1f, 0x37, 0x46, 0x48, 0x48, 0x68, 0x8c, 0xac, 0xcb, 0xcf, 0xb0, 0x90,
+  0x6c, 0x4c, 0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x15, 0x35, 0x54, 0x74, 0x98, 0xb8, 0xd7, 0xc4, 0xa4, 0x86, 0x6b,
+  0x68, 0x68, 0x5e, 0x44, 0x25, 0x07, 0x00, 0x15, 0x35, 0x54, 0x74, 0x98,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x84, 0x60, 0x41, 0x21, 0x01, 0x0e, 0x2d, 0x4b,
+  0x63, 0x68, 0x68, 0x70, 0x90, 0xad, 0xcc, 0xcf, 0xb0, 0x90, 0x6c, 0x4c,
+  0x2d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x35, 0x54, 0x74, 0x95, 0xb4, 0xd4, 0xcc, 0xb0, 0x99, 0x8c, 0x8c, 0x8c,
+  0x68, 0x48, 0x29, 0x09, 0x00, 0x15, 0x34, 0x54, 0x72, 0x7c, 0x7c, 0x7c,
+  0x7c, 0x7c, 0x7c, 0x60, 0x40, 0x21, 0x01, 0x11, 0x31, 0x50, 0x70, 0x8c,
+  0x8c, 0x8e, 0x9f, 0xb9, 0xd5, 0xcb, 0xac, 0x8c, 0x6c, 0x4c, 0x2d, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x30, 0x50,
+  0x6e, 0x90, 0xac, 0xc8, 0xdd, 0xc6, 0xb4, 0xac, 0xac, 0x8c, 0x68, 0x48,
+  0x29, 0x09, 0x00, 0x0e, 0x2b, 0x45, 0x59, 0x5c, 0x5c, 0x5c, 0x5c, 0x5c,
+  0x5c, 0x50, 0x37, 0x1a, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xac, 0xac,
+  0xb7, 0xcc, 0xd8, 0xc0, 0xa3, 0x88, 0x65, 0x47, 0x28, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x47, 0x63, 0x84,
+  0x9c, 0xb2, 0xc0, 0xc6, 0xc7, 0xc7, 0xac, 0x8c, 0x68, 0x48, 0x29, 0x09,
+  0x00, 0x00, 0x18, 0x2d, 0x3b, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d, 0x35,
+  0x23, 0x0b, 0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xb4, 0xc7, 0xc7, 0xc4,
+  0xbc, 0xac, 0x94, 0x77, 0x5b, 0x3e, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x39, 0x54, 0x6c, 0x86, 0x97,
+  0xa2, 0xa8, 0xa8, 0xa8, 0xa8, 0x8c, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00,
+  0x01, 0x12, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x18, 0x0a, 0x00,
+  0x00, 0x11, 0x31, 0x50, 0x70, 0x94, 0xa8, 0xa8, 0xa8, 0xa5, 0xa0, 0x92,
+  0x7c, 0x67, 0x4c, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x28, 0x3f, 0x56, 0x6a, 0x78, 0x84, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x68, 0x48, 0x29, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x31, 0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x7c, 0x74, 0x64, 0x50,
+  0x3a, 0x20, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x29, 0x3e, 0x4e, 0x5a, 0x60, 0x64, 0x64, 0x64,
+  0x64, 0x64, 0x5b, 0x42, 0x24, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x49,
+  0x60, 0x64, 0x64, 0x64, 0x64, 0x64, 0x60, 0x57, 0x4a, 0x38, 0x23, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x12, 0x23, 0x32, 0x3c, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x40, 0x2f, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x34, 0x42, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x40, 0x3a, 0x2e, 0x1e, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x14, 0x1e, 0x23, 0x25, 0x25, 0x25, 0x25, 0x25, 0x22, 0x15,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x23, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0x21, 0x1b, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const SdfGlyph sdfFontGlyphs[] = {
+  { 0, 0, 0, 0, 0, 0, 614 },
+  { 0, 0, 15, 31, -3, 3, 573 },
+  { 15, 0, 20, 17, -4, 3, 819 },
+  { 35, 0, 32, 31, -4, 3, 1495 },
+  { 67, 0, 28, 38, -4, 0, 1288 },
+  { 95, 0, 35, 32, -4, 3, 1761 },
+  { 130, 0, 31, 32, -4, 3, 1474 },
+  { 161, 0, 14, 17, -4, 3, 430 },
+  { 175, 0, 19, 43, -4, -1, 665 },
+  { 194, 0, 19, 43, -5, -1, 665 },
+  { 213, 0, 24, 24, -4, 3, 1013 },
+  { 237, 0, 25, 24, -4, 7, 1105 },
+  { 262, 0, 15, 17, -4, 21, 491 },
+  { 277, 0, 23, 14, -4, 12, 962 },
+  { 0, 43, 15, 13, -4, 21, 491 },
+  { 15, 43, 24, 31, -4, 3, 962 },
+  { 39, 43, 28, 32, -3, 3, 1372 },
+  { 67, 43, 20, 31, -4, 3, 829 },
+  { 87, 43, 26, 31, -4, 3, 1208 },
+  { 113, 43, 27, 32, -4, 3, 1249 },
+  { 140, 43, 29, 31, -4, 3, 1331 },
+  { 169, 43, 27, 32, -4, 3, 1228 },
+  { 196, 43, 27, 32, -3, 3, 1290 },
+  { 223, 43, 26, 31, -4, 3, 1146 },
+  { 249, 43, 29, 32, -4, 3, 1372 },
+  { 278, 43, 27, 32, -4, 3, 1290 },
+  { 0, 75, 15, 25, -4, 9, 491 },
+  { 15, 75, 15, 29, -4, 9, 491 },
+  { 30, 75, 24, 25, -4, 9, 1044 },
+  { 54, 75, 22, 20, -3, 9, 1003 },
+  { 76, 75, 23, 25, -3, 9, 1044 },
+  { 99, 75, 26, 31, -4, 3, 1187 },
+  { 125, 75, 31, 32, -3, 3, 1576 },
+  { 156, 75, 33, 31, -5, 3, 1454 },
+  { 189, 75, 29, 31, -3, 3, 1454 },
+  { 218, 75, 27, 32, -3, 3, 1269 },
+  { 245, 75, 29, 31, -3, 3, 1474 },
+  { 274, 75, 27, 31, -3, 3, 1300 },
+  { 0, 107, 27, 31, -3, 3, 1280 },
+  { 27, 107, 29, 32, -3, 3, 1433 },
+  { 56, 107, 29, 31, -3, 3, 1495 },
+  { 85, 107, 21, 31, -4, 3, 860 },
+  { 106, 107, 21, 32, -4, 3, 942 },
+  { 127, 107, 29, 31, -3, 3, 1384 },
+  { 156, 107, 27, 31, -3, 3, 1259 },
+  { 183, 107, 34, 31, -3, 3, 1843 },
+  { 217, 107, 29, 31, -3, 3, 1495 },
+  { 246, 107, 30, 32, -3, 3, 1495 },
+  { 276, 107, 29, 31, -3, 3, 1454 },
+  { 0, 139, 30, 37, -3, 3, 1495 },
+  { 30, 139, 30, 31, -3, 3, 1474 },
+  { 60, 139, 29, 32, -4, 3, 1372 },
+  { 89, 139, 28, 31, -4, 3, 1269 },
+  { 117, 139, 30, 32, -3, 3, 1536 },
+  { 147, 139, 33, 31, -5, 3, 1454 },
+  { 180, 139, 41, 31, -5, 3, 2007 },
+  { 221, 139, 31, 31, -5, 3, 1351 },
+  { 252, 139, 32, 31, -5, 3, 1372 },
+  { 0, 176, 27, 31, -4, 3, 1249 },
+  { 27, 176, 19, 41, -3, 0, 737 },
+  { 46, 176, 24, 31, -4, 3, 962 },
+  { 70, 176, 18, 41, -4, 0, 737 },
+  { 88, 176, 25, 19, -4, 3, 1044 },
+  { 113, 176, 23, 14, -4, 27, 962 },
+  { 136, 176, 16, 14, -4, 3, 512 },
+  { 152, 176, 26, 27, -4, 8, 1218 },
+  { 178, 176, 26, 31, -3, 3, 1269 },
+  { 204, 176, 24, 26, -3, 9, 1126 },
+  { 228, 176, 26, 32, -3, 3, 1290 },
+  { 254, 176, 25, 27, -3, 8, 1228 },
+  { 279, 176, 24, 31, -4, 3, 921 },
+  { 0, 217, 26, 31, -3, 9, 1269 },
+  { 26, 217, 26, 31, -3, 3, 1290 },
+  { 52, 217, 17, 31, -4, 3, 655 },
+  { 69, 217, 19, 37, -7, 3, 614 },
+  { 88, 217, 27, 31, -3, 3, 1228 },
+  { 115, 217, 18, 32, -3, 3, 696 },
+  { 133, 217, 36, 26, -3, 8, 1894 },
+  { 169, 217, 26, 26, -3, 8, 1290 },
+  { 195, 217, 26, 27, -3, 8, 1290 },
+  { 221, 217, 26, 32, -3, 8, 1290 },
+  { 247, 217, 26, 31, -3, 9, 1269 },
+  { 273, 217, 22, 26, -3, 8, 942 },
+  { 0, 254, 26, 26, -4, 9, 1187 },
+  { 26, 254, 22, 30, -4, 5, 901 },
+  { 48, 254, 26, 26, -3, 9, 1310 },
+  { 74, 254, 28, 25, -5, 9, 1187 },
+  { 102, 254, 38, 25, -5, 9, 1802 },
+  { 140, 254, 27, 25, -5, 9, 1126 },
+  { 167, 254, 28, 31, -5, 9, 1167 },
+  { 195, 254, 25, 25, -4, 9, 1095 },
+  { 220, 254, 20, 41, -4, 0, 757 },
+  { 240, 254, 15, 37, -3, 3, 614 },
+  { 255, 254, 20, 41, -4, 0, 757 },
+  { 275, 254, 24, 16, -4, 11, 1026 },
+};
+
+static const SdfFontData sdfFont = {
+  32, 4, 30, 2467,
+  310, 295, sdfFontAtlas,
+  32, 95, sdfFontGlyphs,
+};
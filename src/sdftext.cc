@@ -0,0 +1,142 @@
+#include "sdftext.hh"
+
+#include "sdfatlas.h"
+
+static inline const SdfGlyph& sdfGlyph(uint8_t c) {
+  int index = c - sdfFont.firstChar;
+  if (index < 0 || index >= sdfFont.numChars)
+    index = '?' - sdfFont.firstChar;
+  return sdfFont.glyphs[index];
+}
+
+void warmUpSdfText() {
+  volatile uint8_t sink = 0;
+  size_t size = sdfFont.atlasWidth * sdfFont.atlasHeight;
+  for (size_t i = 0; i < size; i += 4096) {
+    sink += sdfFont.atlas[i];
+  }
+  (void)sink;
+}
+
+void measureSdfText(const char *text, int pixelSize, int *w, int *h) {
+  // advances in 16.16 destination pixels
+  int64_t pen = 0;
+  for (const uint8_t *p = reinterpret_cast<const uint8_t*>(text); *p; ++p) {
+    pen += static_cast<int64_t>(sdfGlyph(*p).advance) * pixelSize * 1024 / sdfFont.baseSize;
+  }
+  *w = static_cast<int>((pen + 0xffff) >> 16);
+  *h = (sdfFont.height64 * pixelSize + sdfFont.baseSize * 64 - 1) / (sdfFont.baseSize * 64);
+}
+
+// Bilinear sample of a glyph cell at 16.16 cell coordinates, 8.8 result.
+// Samples outside the cell read as far outside the glyph.
+static inline int sampleCell(const SdfGlyph &g, int32_t s, int32_t t) {
+  if (s < 0 || t < 0) return 0;
+  int ix = s >> 16;
+  int iy = t >> 16;
+  if (ix >= g.w - 1 || iy >= g.h - 1) return 0;
+  int fx = (s >> 8) & 0xff;
+  int fy = (t >> 8) & 0xff;
+  const uint8_t *p = sdfFont.atlas + (g.y + iy) * sdfFont.atlasWidth + g.x + ix;
+  int top = (p[0] << 8) + (p[1] - p[0]) * fx;
+  int bottom = (p[sdfFont.atlasWidth] << 8) + (p[sdfFont.atlasWidth + 1] - p[sdfFont.atlasWidth]) * fx;
+  return top + (((bottom - top) * fy) >> 8);
+}
+
+static inline uint32_t blendPixel(uint32_t dst, uint32_t src, unsigned alpha) {
+  unsigned a = alpha + (alpha >> 7);
+  uint32_t rb = (((src & 0xff00ff) * a + (dst & 0xff00ff) * (256 - a)) >> 8) & 0xff00ff;
+  uint32_t ag = (((src >> 8) & 0xff00ff) * a + ((dst >> 8) & 0xff00ff) * (256 - a)) & 0xff00ff00;
+  return rb | ag;
+}
+
+void drawSdfText(VideoSurface *target, const char *text, int x, int y,
+    int pixelSize, int rotation, SDL_Color color) {
+  if (pixelSize <= 0)
+    return;
+  rotation &= 3;
+  int w, h;
+  measureSdfText(text, pixelSize, &w, &h);
+  LockedSurface ls;
+  if (target->lock(&ls))
+    return;
+
+  uint32_t pixel = target->mapRGBA(color.r, color.g, color.b, 255);
+  // atlas texels per destination pixel, 16.16
+  int32_t step = sdfFont.baseSize * 65536 / pixelSize;
+  // distance field units to coverage, see the alpha computation below
+  int32_t sharpness = 255 * sdfFont.spread * pixelSize * 256 / (127 * sdfFont.baseSize);
+
+  // text space (u, v) moves by these for one pixel to the right and down
+  static const int du[4][2] = { { 1, 0 }, { 0, -1 }, { -1, 0 }, { 0, 1 } };
+  static const int dv[4][2] = { { 0, 1 }, { 1, 0 }, { 0, -1 }, { -1, 0 } };
+  // text space position of the top left target pixel of the box
+  int u0 = rotation == 1 || rotation == 2 ? w - 1 : 0;
+  int v0 = rotation == 2 || rotation == 3 ? h - 1 : 0;
+  int boxW = rotation & 1 ? h : w;
+  int boxH = rotation & 1 ? w : h;
+
+  uint8_t alpha[256];
+  int64_t pen = 0;
+  for (const uint8_t *p = reinterpret_cast<const uint8_t*>(text); *p; ++p) {
+    const SdfGlyph &g(sdfGlyph(*p));
+    int64_t advance = static_cast<int64_t>(g.advance) * pixelSize * 1024 / sdfFont.baseSize;
+    if (!g.w) {
+      pen += advance;
+      continue;
+    }
+    // glyph cell in text space, 16.16
+    int32_t gx = static_cast<int32_t>(pen) + g.left * pixelSize * 65536 / sdfFont.baseSize;
+    int32_t gy = g.top * pixelSize * 65536 / sdfFont.baseSize;
+    int cu0 = gx >> 16, cv0 = gy >> 16;
+    int cu1 = (gx + g.w * pixelSize * 65536 / sdfFont.baseSize + 0xffff) >> 16;
+    int cv1 = (gy + g.h * pixelSize * 65536 / sdfFont.baseSize + 0xffff) >> 16;
+    pen += advance;
+
+    // the cell's rectangle on the target
+    int tx0, ty0, tx1, ty1;
+    switch (rotation) {
+      case 0: tx0 = cu0; tx1 = cu1; ty0 = cv0; ty1 = cv1; break;
+      case 1: tx0 = cv0; tx1 = cv1; ty0 = w - cu1; ty1 = w - cu0; break;
+      case 2: tx0 = w - cu1; tx1 = w - cu0; ty0 = h - cv1; ty1 = h - cv0; break;
+      default: tx0 = h - cv1; tx1 = h - cv0; ty0 = cu0; ty1 = cu1; break;
+    }
+    if (tx0 < 0) tx0 = 0;
+    if (ty0 < 0) ty0 = 0;
+    if (tx1 > boxW) tx1 = boxW;
+    if (ty1 > boxH) ty1 = boxH;
+    if (x + tx0 < 0) tx0 = -x;
+    if (y + ty0 < 0) ty0 = -y;
+    if (x + tx1 > ls.w) tx1 = ls.w - x;
+    if (y + ty1 > ls.h) ty1 = ls.h - y;
+
+    for (int ty = ty0; ty < ty1; ++ty) {
+      uint32_t *row = reinterpret_cast<uint32_t*>(ls.pixels + (y + ty) * ls.pitch) + x;
+      for (int start = tx0; start < tx1; start += sizeof(alpha)) {
+        int end = start + static_cast<int>(sizeof(alpha));
+        if (end > tx1) end = tx1;
+        int u = u0 + du[rotation][0] * start + du[rotation][1] * ty;
+        int v = v0 + dv[rotation][0] * start + dv[rotation][1] * ty;
+        // pixel centers mapped back into the cell
+        int32_t s = static_cast<int32_t>((static_cast<int64_t>((u << 16) + 0x8000 - gx) * step) >> 16) - 0x8000;
+        int32_t t = static_cast<int32_t>((static_cast<int64_t>((v << 16) + 0x8000 - gy) * step) >> 16) - 0x8000;
+        int32_t ds = du[rotation][0] * step;
+        int32_t dt = dv[rotation][0] * step;
+
+        // coverage first, a plain arithmetic loop, then the blend
+        for (int i = 0; i < end - start; ++i) {
+          int d = sampleCell(g, s, t) - (128 << 8);
+          int a = 128 + ((d * sharpness) >> 16);
+          alpha[i] = a < 0 ? 0 : a > 255 ? 255 : a;
+          s += ds;
+          t += dt;
+        }
+        uint32_t *dst = row + start;
+        for (int i = 0; i < end - start; ++i) {
+          if (alpha[i]) dst[i] = blendPixel(dst[i], pixel, alpha[i]);
+        }
+      }
+    }
+  }
+  target->unlock();
+}
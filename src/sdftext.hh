@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+
+// Layout of the signed distance field atlas tools/sdfbake writes into
+// sdfatlas.h. Cells are in base size pixels relative to the pen position
+// and the top of the line, advances in 1/64 base pixels.
+struct SdfGlyph {
+  uint16_t x, y;
+  uint8_t w, h;
+  int8_t left, top;
+  uint16_t advance;
+};
+
+struct SdfFontData {
+  int baseSize;
+  // distance in base pixels that maps to the full 0..255 range either way
+  int spread;
+  int ascent;
+  int height64;
+  int atlasWidth, atlasHeight;
+  const uint8_t *atlas;
+  int firstChar, numChars;
+  const SdfGlyph *glyphs;
+};
+
+// Text of any pixel size from the one distance field atlas, drawn straight
+// onto a 32 bit surface. The rotation is in quarter turns counterclockwise
+// (1 reads upwards, like a label on a Y axis); x, y is the top left
+// corner of the rotated text box and w, h are measured before rotation.
+void measureSdfText(const char *text, int pixelSize, int *w, int *h);
+void drawSdfText(VideoSurface *target, const char *text, int x, int y,
+    int pixelSize, int rotation, SDL_Color color);
+// faults in the atlas pages ahead of the first use
+void warmUpSdfText();
@@ -1,7 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <strings.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #include "sdlcompat.hh"
+#include "framepool.hh"
+#include "scopestats.hh"
+#include "timing.hh"
 
 #ifdef USE_SDL2
 
@@ -16,6 +25,7 @@ VideoSurface::~VideoSurface() {
 }
 
 void VideoSurface::update() {
+  SCOPE_STAT("update", "px", texture ? width * height : 0);
   if (texture) {
     void *ptr = nullptr;
     int bytePitch = 0;
@@ -37,13 +47,27 @@ void VideoSurface::update() {
   }
 }
 
+void VideoSurface::resize(int w, int h) {
+  width = w;
+  height = h;
+  SDL_Rect clip {
+    .x = 0,
+    .y = 0,
+    .w = w,
+    .h = h,
+  };
+  SDL_SetClipRect(surface, &clip);
+}
+
 void VideoSurface::fill(uint32_t color) {
+  SCOPE_STAT("fill", "px", width * height);
   SDL_FillRect(surface, nullptr, color);
 }
 
 void VideoSurface::fill(int x, int y, int w, int h, uint32_t color) {
   if (w <= 0 || h <= 0)
     return;
+  SCOPE_STAT("fill", "px", w * h);
   SDL_Rect r {
     .x = static_cast<Sint16>(x),
     .y = static_cast<Sint16>(y),
@@ -58,14 +82,41 @@ void VideoSurface::unlock() {
 }
 
 void VideoSurface::blitOn(VideoSurface *target, int x, int y) {
+  SCOPE_STAT("blitOn", "px", width * height);
+  SDL_Rect src {
+    .x = 0,
+    .y = 0,
+    .w = width,
+    .h = height,
+  };
   SDL_Rect rect {
     .x = x,
     .y = y,
   };
-  SDL_BlitSurface(surface, nullptr, target->surface, &rect);
+  SDL_BlitSurface(surface, &src, target->surface, &rect);
+}
+
+void VideoSurface::blitOn(VideoSurface *target, int x, int y, int sx, int sy, int sw, int sh) {
+  SCOPE_STAT("blitOn", "px", sw * sh);
+  SDL_Rect src {
+    .x = static_cast<Sint16>(sx),
+    .y = static_cast<Sint16>(sy),
+    .w = static_cast<Uint16>(sw),
+    .h = static_cast<Uint16>(sh),
+  };
+  SDL_Rect rect {
+    .x = static_cast<Sint16>(x),
+    .y = static_cast<Sint16>(y),
+  };
+  SDL_BlitSurface(surface, &src, target->surface, &rect);
+}
+
+void VideoSurface::setBlending(bool enabled) {
+  SDL_SetSurfaceBlendMode(surface, enabled ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
 }
 
 int VideoSurface::lock(LockedSurface *locked) {
+  SCOPE_STAT("lock", "B", width * height * 4);
   locked->pixels = nullptr;
   locked->w = width;
   locked->h = height;
@@ -84,9 +135,13 @@ Video::Video(int width, int height, int rotation): rotation(rotation) {
   renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
   screen = createSurface(width, height, true);
   SDL_SetTextureBlendMode(screen->texture, SDL_BLENDMODE_NONE);
+  pool = new SurfacePool(this);
+  arena = new FrameArena();
 }
 
 Video::~Video() {
+  delete pool;
+  delete arena;
   delete screen;
   screen = nullptr;
 }
@@ -101,14 +156,17 @@ VideoSurface* Video::createSurface(int width, int height, bool scr) {
   return new VideoSurface(this, surface, texture, width, height);
 }
 
+#ifndef BAKED_FONT
 VideoSurface* Video::drawText(TTF_Font *font, const char *str, SDL_Color color) {
   SDL_Surface *textSurface = TTF_RenderText_Blended(font, str, color);
   int w = textSurface->w;
   int h = textSurface->h;
   return new VideoSurface(this, textSurface, nullptr, w, h);
 }
+#endif
 
 void Video::present() {
+  SCOPE_STAT("present", "px", screen->width * screen->height);
   screen->update();
   SDL_RenderClear(renderer);
   if (rotation) {
@@ -123,21 +181,69 @@ void Video::present() {
     SDL_RenderCopy(renderer, screen->texture, nullptr, nullptr);
   }
   SDL_RenderPresent(renderer);
+  pool->endFrame();
+  arena->reset();
 }
 
 int keyCodeFromEvent(const SDL_Event &event) {
   return static_cast<int>(event.key.keysym.scancode);
 }
 
+uint64_t eventMicros(const SDL_Event &event) {
+  // SDL_GetTicks may run on another clock, go by the age of the event
+  uint64_t now = monotonicMicros();
+  uint32_t age = SDL_GetTicks() - event.common.timestamp;
+  return now - age * 1000ULL;
+}
+
+const char* keyNameFromCode(int code) {
+  return SDL_GetKeyName(SDL_GetKeyFromScancode(static_cast<SDL_Scancode>(code)));
+}
+
+int keyCodeFromName(const char *name) {
+  SDL_Scancode code = SDL_GetScancodeFromKey(SDL_GetKeyFromName(name));
+  return code == SDL_SCANCODE_UNKNOWN ? -1 : static_cast<int>(code);
+}
+
+int joystickId(SDL_Joystick *joy, int index) {
+  return static_cast<int>(SDL_JoystickInstanceID(joy));
+}
+
+int joystickIdAt(int index) {
+  return static_cast<int>(SDL_JoystickGetDeviceInstanceID(index));
+}
+
+const char* joystickName(SDL_Joystick *joy, int index) {
+  return SDL_JoystickName(joy);
+}
+
+int waitEventTimeout(SDL_Event *event, int ms) {
+  return SDL_WaitEventTimeout(event, ms);
+}
+
 #else
 
-VideoSurface::VideoSurface(SDL_Surface *surface): surface(surface) {
+VideoSurface::VideoSurface(SDL_Surface *surface): surface(surface),
+    width(surface ? surface->w : 0), height(surface ? surface->h : 0) {
 
 }
 
+void VideoSurface::resize(int w, int h) {
+  width = w;
+  height = h;
+  SDL_Rect clip {
+    .x = 0,
+    .y = 0,
+    .w = static_cast<Uint16>(w),
+    .h = static_cast<Uint16>(h),
+  };
+  SDL_SetClipRect(surface, &clip);
+}
+
 void VideoSurface::fill(int x, int y, int w, int h, uint32_t color) {
   if (w <= 0 || h <= 0)
     return;
+  SCOPE_STAT("fill", "px", w * h);
   SDL_Rect r {
     .x = static_cast<Sint16>(x),
     .y = static_cast<Sint16>(y),
@@ -148,15 +254,17 @@ void VideoSurface::fill(int x, int y, int w, int h, uint32_t color) {
 }
 
 void VideoSurface::fill(uint32_t color) {
+  SCOPE_STAT("fill", "px", width * height);
   SDL_FillRect(surface, nullptr, color);
 }
 
 int VideoSurface::lock(LockedSurface *locked) {
+  SCOPE_STAT("lock", "B", width * height * 4);
   int result = SDL_LockSurface(surface);
   if (result)
     return result;
-  locked->w = surface->w;
-  locked->h = surface->h;
+  locked->w = width;
+  locked->h = height;
   locked->pitch = surface->pitch;
   locked->pixels = static_cast<uint8_t*>(surface->pixels);
   return 0;
@@ -167,11 +275,37 @@ void VideoSurface::unlock() {
 }
 
 void VideoSurface::blitOn(VideoSurface *target, int x, int y) {
+  SCOPE_STAT("blitOn", "px", width * height);
+  SDL_Rect src {
+    .x = 0,
+    .y = 0,
+    .w = static_cast<Uint16>(width),
+    .h = static_cast<Uint16>(height),
+  };
+  SDL_Rect rect {
+    .x = static_cast<Sint16>(x),
+    .y = static_cast<Sint16>(y),
+  };
+  SDL_BlitSurface(surface, &src, target->surface, &rect);
+}
+
+void VideoSurface::blitOn(VideoSurface *target, int x, int y, int sx, int sy, int sw, int sh) {
+  SCOPE_STAT("blitOn", "px", sw * sh);
+  SDL_Rect src {
+    .x = static_cast<Sint16>(sx),
+    .y = static_cast<Sint16>(sy),
+    .w = static_cast<Uint16>(sw),
+    .h = static_cast<Uint16>(sh),
+  };
   SDL_Rect rect {
     .x = static_cast<Sint16>(x),
     .y = static_cast<Sint16>(y),
   };
-  SDL_BlitSurface(surface, nullptr, target->surface, &rect);
+  SDL_BlitSurface(surface, &src, target->surface, &rect);
+}
+
+void VideoSurface::setBlending(bool enabled) {
+  SDL_SetAlpha(surface, enabled ? SDL_SRCALPHA : 0, SDL_ALPHA_OPAQUE);
 }
 
 VideoSurface::~VideoSurface() {
@@ -180,36 +314,225 @@ VideoSurface::~VideoSurface() {
 
 Video::Video(int w, int h) {
   screen = new VideoSurface(SDL_SetVideoMode(w, h, 32, 0));
+  pool = new SurfacePool(this);
+  arena = new FrameArena();
 }
 
 Video::~Video() {
+  delete pool;
+  delete arena;
   delete screen;
   screen = nullptr;
 }
 
 VideoSurface* Video::createSurface(int w, int h) {
-  SDL_Surface *s = SDL_CreateRGBSurface(0, w, h, 32,
-      screen->surface->format->Rmask,
-      screen->surface->format->Gmask,
-      screen->surface->format->Bmask,
-      screen->surface->format->Amask);
-  SDL_Surface *withAlpha = SDL_DisplayFormatAlpha(s);
-  SDL_FreeSurface(s);
-  return new VideoSurface(withAlpha);
+  // create the surface directly in the format SDL_DisplayFormatAlpha
+  // would convert it to, saving an allocation and a conversion
+  SDL_PixelFormat *format = screen->surface->format;
+  Uint32 rmask = 0x00ff0000, gmask = 0x0000ff00, bmask = 0x000000ff, amask = 0xff000000;
+  if (format->BytesPerPixel == 4) {
+    rmask = format->Rmask;
+    gmask = format->Gmask;
+    bmask = format->Bmask;
+    amask = ~(rmask | gmask | bmask);
+  } else if (format->Rmask == 0x1f) {
+    rmask = 0x000000ff;
+    bmask = 0x00ff0000;
+  }
+  SDL_Surface *s = SDL_CreateRGBSurface(SDL_SWSURFACE, w, h, 32, rmask, gmask, bmask, amask);
+  SDL_SetAlpha(s, SDL_SRCALPHA, SDL_ALPHA_OPAQUE);
+  return new VideoSurface(s);
 }
 
+#ifndef BAKED_FONT
 VideoSurface* Video::drawText(TTF_Font *font, const char *str, SDL_Color color) {
   return new VideoSurface(TTF_RenderText_Blended(font, str, color));
 }
+#endif
 
 void Video::present() {
+  SCOPE_STAT("present", "px", screen->width * screen->height);
   SDL_Flip(screen->surface);
+  pool->endFrame();
+  arena->reset();
 }
 
 int keyCodeFromEvent(const SDL_Event &event) {
   return static_cast<int>(event.key.keysym.sym);
 }
 
+uint64_t eventMicros(const SDL_Event &event) {
+  return monotonicMicros();
+}
+
+const char* keyNameFromCode(int code) {
+  return SDL_GetKeyName(static_cast<SDLKey>(code));
+}
+
+int keyCodeFromName(const char *name) {
+  // SDL1 has no reverse lookup
+  for (int code = 1; code < NUM_SCANCODES; ++code) {
+    if (!strcasecmp(SDL_GetKeyName(static_cast<SDLKey>(code)), name))
+      return code;
+  }
+  return -1;
+}
+
+int joystickId(SDL_Joystick *joy, int index) {
+  return index;
+}
+
+int joystickIdAt(int index) {
+  return index;
+}
+
+const char* joystickName(SDL_Joystick *joy, int index) {
+  return SDL_JoystickName(index);
+}
+
+int waitEventTimeout(SDL_Event *event, int ms) {
+  Uint32 start = SDL_GetTicks();
+  while (!SDL_PollEvent(event)) {
+    if (static_cast<int>(SDL_GetTicks() - start) >= ms)
+      return 0;
+    SDL_Delay(1);
+  }
+  return 1;
+}
+
 #endif
 
+// Every surface here is 32 bits per pixel, so the primitives below only
+// need the 32 bit fill. Four pixels per store where there's SIMD.
+static inline void memset32(uint32_t *dst, uint32_t value, int count) {
+#if defined(__SSE2__)
+  __m128i v = _mm_set1_epi32(value);
+  for (; count >= 4; count -= 4, dst += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+  }
+#elif defined(__ARM_NEON)
+  uint32x4_t v = vdupq_n_u32(value);
+  for (; count >= 4; count -= 4, dst += 4) {
+    vst1q_u32(dst, v);
+  }
+#endif
+  while (count-- > 0) *dst++ = value;
+}
+
+static bool lockPixels(SDL_Surface *surface, int w, int h, LockedSurface *ls) {
+  if (SDL_LockSurface(surface) < 0)
+    return false;
+  ls->pixels = static_cast<uint8_t*>(surface->pixels);
+  ls->pitch = surface->pitch;
+  ls->w = w;
+  ls->h = h;
+  return true;
+}
+
+// to the surface size like SDL_FillRect with the default clip, false if
+// nothing is left
+static inline bool clipRect(int sw, int sh, int &x, int &y, int &w, int &h) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > sw) w = sw - x;
+  if (y + h > sh) h = sh - y;
+  return w > 0 && h > 0;
+}
+
+// pixel counts for SCOPE_STAT, only evaluated in SCOPE_STATS builds
+static inline int clippedArea(int sw, int sh, int x, int y, int w, int h) {
+  return clipRect(sw, sh, x, y, w, h) ? w * h : 0;
+}
+
+static inline int outlineArea(int sw, int sh, int x, int y, int w, int h) {
+  if (w <= 0 || h <= 0)
+    return 0;
+  return clippedArea(sw, sh, x, y, w, 1) + (h > 1 ? clippedArea(sw, sh, x, y + h - 1, w, 1) : 0) +
+      clippedArea(sw, sh, x, y + 1, 1, h - 2) + (w > 1 ? clippedArea(sw, sh, x + w - 1, y + 1, 1, h - 2) : 0);
+}
+
+static inline int clippedArea(int sw, int sh, const SurfaceRect *rects, int count, bool outline) {
+  int area = 0;
+  for (int i = 0; i < count; ++i) {
+    const SurfaceRect &r(rects[i]);
+    area += outline ? outlineArea(sw, sh, r.x, r.y, r.w, r.h) : clippedArea(sw, sh, r.x, r.y, r.w, r.h);
+  }
+  return area;
+}
+
+static void fillPixels(const LockedSurface &ls, int x, int y, int w, int h, uint32_t color) {
+  if (!clipRect(ls.w, ls.h, x, y, w, h))
+    return;
+  uint8_t *row = ls.pixels + y * ls.pitch + x * 4;
+  if (w == 1) {
+    for (; h--; row += ls.pitch) *reinterpret_cast<uint32_t*>(row) = color;
+    return;
+  }
+  for (; h--; row += ls.pitch) {
+    memset32(reinterpret_cast<uint32_t*>(row), color, w);
+  }
+}
+
+// the same pixels as the four fill() calls it replaces
+static void strokePixels(const LockedSurface &ls, int x, int y, int w, int h, uint32_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  fillPixels(ls, x, y, w, 1, color);
+  if (h > 1) fillPixels(ls, x, y + h - 1, w, 1, color);
+  fillPixels(ls, x, y + 1, 1, h - 2, color);
+  if (w > 1) fillPixels(ls, x + w - 1, y + 1, 1, h - 2, color);
+}
+
+void VideoSurface::hLine(int x, int y, int w, uint32_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void VideoSurface::vLine(int x, int y, int h, uint32_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void VideoSurface::fillRect(int x, int y, int w, int h, uint32_t color) {
+  SCOPE_STAT("fillRect", "px", clippedArea(width, height, x, y, w, h));
+  LockedSurface ls;
+  if (!lockPixels(surface, width, height, &ls))
+    return;
+  fillPixels(ls, x, y, w, h, color);
+  SDL_UnlockSurface(surface);
+}
+
+void VideoSurface::strokeRect(int x, int y, int w, int h, uint32_t color) {
+  SCOPE_STAT("strokeRect", "px", outlineArea(width, height, x, y, w, h));
+  LockedSurface ls;
+  if (!lockPixels(surface, width, height, &ls))
+    return;
+  strokePixels(ls, x, y, w, h, color);
+  SDL_UnlockSurface(surface);
+}
+
+void VideoSurface::fillRects(const SurfaceRect *rects, int count, uint32_t color) {
+  SCOPE_STAT("fillRects", "px", clippedArea(width, height, rects, count, false));
+  LockedSurface ls;
+  if (!count || !lockPixels(surface, width, height, &ls))
+    return;
+  for (int i = 0; i < count; ++i) {
+    fillPixels(ls, rects[i].x, rects[i].y, rects[i].w, rects[i].h, color);
+  }
+  SDL_UnlockSurface(surface);
+}
 
+void VideoSurface::strokeRects(const SurfaceRect *rects, int count, uint32_t color) {
+  SCOPE_STAT("strokeRects", "px", clippedArea(width, height, rects, count, true));
+  LockedSurface ls;
+  if (!count || !lockPixels(surface, width, height, &ls))
+    return;
+  for (int i = 0; i < count; ++i) {
+    strokePixels(ls, rects[i].x, rects[i].y, rects[i].w, rects[i].h, color);
+  }
+  SDL_UnlockSurface(surface);
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
+
+class SurfacePool;
+class FrameArena;
 
 struct LockedSurface {
   uint8_t *pixels;
@@ -9,9 +13,15 @@ struct LockedSurface {
   int pitch;
 };
 
+struct SurfaceRect {
+  int x, y, w, h;
+};
+
 #ifdef USE_SDL2
 #include <SDL2/SDL.h>
+#ifndef BAKED_FONT
 #include <SDL2/SDL_ttf.h>
+#endif
 
 class Video;
 
@@ -22,8 +32,10 @@ class VideoSurface {
   Video *video;
 protected:
   friend Video;
+  friend class SurfacePool;
   VideoSurface(Video *video, SDL_Surface *surface, SDL_Texture *texture, int w, int h);
   void update();
+  void resize(int w, int h);
 public:
   ~VideoSurface();
 
@@ -32,9 +44,22 @@ public:
 
   void fill(uint32_t color);
   void fill(int x, int y, int w, int h, uint32_t color);
+  // direct pixel writes for the outline heavy parts of the display, no
+  // per call SDL_FillRect setup; color is in the surface format
+  void hLine(int x, int y, int w, uint32_t color);
+  void vLine(int x, int y, int h, uint32_t color);
+  void fillRect(int x, int y, int w, int h, uint32_t color);
+  void strokeRect(int x, int y, int w, int h, uint32_t color);
+  void fillRects(const SurfaceRect *rects, int count, uint32_t color);
+  void strokeRects(const SurfaceRect *rects, int count, uint32_t color);
   int lock(LockedSurface *locked);
   void unlock();
   void blitOn(VideoSurface *target, int x, int y);
+  void blitOn(VideoSurface *target, int x, int y, int sx, int sy, int sw, int sh);
+  void setBlending(bool enabled);
+  inline uint32_t mapRGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return SDL_MapRGBA(surface->format, r, g, b, a);
+  }
 };
 
 
@@ -46,6 +71,8 @@ class Video {
   SDL_Window *window;
   SDL_Renderer *renderer;
   VideoSurface *screen;
+  SurfacePool *pool;
+  FrameArena *arena;
 
   VideoSurface* createSurface(int w, int h, bool texture);
 public:
@@ -55,44 +82,74 @@ public:
   inline VideoSurface* getScreen() { return screen; }
   void present();
 
+  // borrowed until the next present(), never delete these
+  VideoSurface* scratchSurface(int w, int h);
+  void* frameAlloc(size_t size);
+  inline SurfacePool* getPool() { return pool; }
+  inline FrameArena* getArena() { return arena; }
+
   inline VideoSurface* createSurface(int w, int h) {
     return createSurface(w, h, false);
   }
 
+#ifndef BAKED_FONT
   VideoSurface* drawText(TTF_Font *font, const char *str, SDL_Color color);
+#endif
   inline VideoSurface* adapt(SDL_Surface *surface) {
     return surface ? new VideoSurface(this, surface, nullptr, surface->w, surface->h) : nullptr;
   }
 };
 
 #define NUM_SCANCODES (static_cast<int>(SDL_NUM_SCANCODES))
+#define SCREENSHOT_KEY (static_cast<int>(SDL_SCANCODE_PRINTSCREEN))
+#define FLIGHT_DUMP_KEY (static_cast<int>(SDL_SCANCODE_PAUSE))
 
 #else
 #include <SDL/SDL.h>
+#ifndef BAKED_FONT
 #include <SDL/SDL_ttf.h>
+#endif
 
 class Video;
 
 class VideoSurface {
   friend Video;
+  friend class SurfacePool;
   SDL_Surface *surface;
+  int width, height;
 protected:
   VideoSurface(SDL_Surface *surface);
+  void resize(int w, int h);
 public:
   ~VideoSurface();
 
-  inline int getWidth() { return surface->w; }
-  inline int getHeight() { return surface->h; }
+  inline int getWidth() { return width; }
+  inline int getHeight() { return height; }
 
   void fill(uint32_t color);
   void fill(int x, int y, int w, int h, uint32_t color);
+  // direct pixel writes for the outline heavy parts of the display, no
+  // per call SDL_FillRect setup; color is in the surface format
+  void hLine(int x, int y, int w, uint32_t color);
+  void vLine(int x, int y, int h, uint32_t color);
+  void fillRect(int x, int y, int w, int h, uint32_t color);
+  void strokeRect(int x, int y, int w, int h, uint32_t color);
+  void fillRects(const SurfaceRect *rects, int count, uint32_t color);
+  void strokeRects(const SurfaceRect *rects, int count, uint32_t color);
   int lock(LockedSurface *locked);
   void unlock();
   void blitOn(VideoSurface *target, int x, int y);
+  void blitOn(VideoSurface *target, int x, int y, int sx, int sy, int sw, int sh);
+  void setBlending(bool enabled);
+  inline uint32_t mapRGBA(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return SDL_MapRGBA(surface->format, r, g, b, a);
+  }
 };
 
 class Video {
   VideoSurface *screen;
+  SurfacePool *pool;
+  FrameArena *arena;
 public:
   Video(int width, int height);
   ~Video();
@@ -100,15 +157,39 @@ public:
   inline VideoSurface* getScreen() { return screen; }
   void present();
 
+  // borrowed until the next present(), never delete these
+  VideoSurface* scratchSurface(int w, int h);
+  void* frameAlloc(size_t size);
+  inline SurfacePool* getPool() { return pool; }
+  inline FrameArena* getArena() { return arena; }
+
   VideoSurface* createSurface(int w, int h);
+#ifndef BAKED_FONT
   VideoSurface* drawText(TTF_Font *font, const char *str, SDL_Color color);
+#endif
   inline VideoSurface* adapt(SDL_Surface *surface) {
     return surface ? new VideoSurface(surface) : nullptr;
   }
 };
 
 #define NUM_SCANCODES (static_cast<int>(SDLK_LAST))
+#define SCREENSHOT_KEY (static_cast<int>(SDLK_PRINT))
+#define FLIGHT_DUMP_KEY (static_cast<int>(SDLK_PAUSE))
 
 #endif
 
 int keyCodeFromEvent(const SDL_Event &event);
+// CLOCK_MONOTONIC microseconds when SDL queued the event (millisecond
+// precision); SDL1 events carry no timestamp, so that's just now
+uint64_t eventMicros(const SDL_Event &event);
+const char* keyNameFromCode(int code);
+// the other way around, case insensitive, -1 if there's no such key
+int keyCodeFromName(const char *name);
+// SDL2: instance id (what events report in `which`), SDL1: device index
+int joystickId(SDL_Joystick *joy, int index);
+// the same id for a device index without opening it
+int joystickIdAt(int index);
+const char* joystickName(SDL_Joystick *joy, int index);
+// 1 when an event arrived within ms milliseconds, SDL1 has no such call
+// and gets a poll and sleep loop
+int waitEventTimeout(SDL_Event *event, int ms);
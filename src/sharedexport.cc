@@ -0,0 +1,98 @@
+#include "sharedexport.hh"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "timing.hh"
+
+SharedStateWriter::~SharedStateWriter() {
+  close();
+}
+
+// true when the segment is an intester one whose writer has exited
+static bool isStale(const char *segmentName) {
+  int fd = shm_open(segmentName, O_RDONLY, 0);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  void *p = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size >= static_cast<off_t>(sizeof(SharedState))) {
+    p = mmap(nullptr, sizeof(SharedState), PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (p == MAP_FAILED)
+    return false;
+  const SharedState *other = static_cast<const SharedState*>(p);
+  bool stale = false;
+  if (__atomic_load_n(&other->magic, __ATOMIC_ACQUIRE) == SHARED_STATE_MAGIC) {
+    pid_t pid = other->writerPid;
+    stale = pid > 0 && kill(pid, 0) < 0 && errno == ESRCH;
+    if (!stale) fprintf(stderr, "%s is in use by process %d\n", segmentName, static_cast<int>(pid));
+  } else {
+    fprintf(stderr, "%s exists and isn't an intester state segment\n", segmentName);
+  }
+  munmap(p, sizeof(SharedState));
+  return stale;
+}
+
+bool SharedStateWriter::open(const char *segmentName) {
+  // never take over a segment another instance is publishing in
+  int fd = shm_open(segmentName, O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0 && errno == EEXIST && isStale(segmentName)) {
+    shm_unlink(segmentName);
+    fd = shm_open(segmentName, O_CREAT | O_EXCL | O_RDWR, 0644);
+  }
+  if (fd < 0) {
+    perror("Can't create the shared memory segment");
+    return false;
+  }
+  if (ftruncate(fd, sizeof(SharedState)) < 0) {
+    perror("Can't size the shared memory segment");
+    ::close(fd);
+    shm_unlink(segmentName);
+    return false;
+  }
+  void *p = mmap(nullptr, sizeof(SharedState), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) {
+    perror("Can't map the shared memory segment");
+    shm_unlink(segmentName);
+    return false;
+  }
+  state = static_cast<SharedState*>(p);
+  snprintf(name, sizeof(name), "%s", segmentName);
+  memset(state, 0, sizeof(SharedState));
+  state->version = SHARED_STATE_VERSION;
+  state->size = sizeof(SharedState);
+  state->writerPid = getpid();
+  // readers check the magic last
+  __atomic_store_n(&state->magic, SHARED_STATE_MAGIC, __ATOMIC_RELEASE);
+  return true;
+}
+
+void SharedStateWriter::close() {
+  if (!state)
+    return;
+  munmap(state, sizeof(SharedState));
+  shm_unlink(name);
+  state = nullptr;
+}
+
+SharedState* SharedStateWriter::begin() {
+  uint32_t seq = state->seq;
+  __atomic_store_n(&state->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  return state;
+}
+
+void SharedStateWriter::end() {
+  ++state->frame;
+  state->timestampNanos = monotonicNanos();
+  __atomic_store_n(&state->seq, state->seq + 1, __ATOMIC_RELEASE);
+}
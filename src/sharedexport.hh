@@ -0,0 +1,22 @@
+#pragma once
+
+#include "sharedstate.hh"
+
+// Writer side of the --shm segment
+class SharedStateWriter {
+  SharedState *state;
+  char name[64];
+public:
+  SharedStateWriter(): state(nullptr) {}
+  ~SharedStateWriter();
+
+  // name is a POSIX shared memory name like "/intester"
+  bool open(const char *name);
+  void close();
+  inline bool isOpen() { return state != nullptr; }
+
+  // seq goes odd, the state may be written until end()
+  SharedState* begin();
+  // stamps the frame and makes the state readable again
+  void end();
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <sched.h>
+#include <stdint.h>
+
+// Layout of the shared memory segment intester publishes with --shm, for
+// other processes on the device. Plain data only, no SDL, so readers can
+// include it as is. The writer bumps seq to odd before changing anything
+// and to even after; readers copy the state and retry while seq was odd
+// or changed meanwhile (see sharedStateSnapshot), so the writer never
+// waits for them.
+const uint32_t SHARED_STATE_MAGIC = 0x53544e49; // "INTS"
+const uint32_t SHARED_STATE_VERSION = 1;
+
+const int SHARED_MAX_DEVICES = 4;
+const int SHARED_MAX_BUTTONS = 256;
+const int SHARED_MAX_AXES = 256;
+const int SHARED_KEY_BITS = 512;
+
+struct SharedAxis {
+  int32_t value;
+  uint32_t minNonzeroAbsolute;
+  uint32_t maxAbsolute;
+  uint32_t distinctValues;
+  uint32_t missingCodes;
+  // resting center and RMS noise, restSamples is 0 until the axis rested
+  int32_t restCenter;
+  float rmsNoise;
+  uint32_t restSamples;
+};
+
+struct SharedDevice {
+  char name[64];
+  int32_t id;
+  int32_t numButtons;
+  int32_t numAxes;
+  int32_t numHats;
+  int32_t hat;
+  uint64_t buttons[SHARED_MAX_BUTTONS / 64];
+  SharedAxis axes[SHARED_MAX_AXES];
+};
+
+struct SharedState {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  uint32_t seq;
+  // repaints published so far and CLOCK_MONOTONIC of the latest
+  uint64_t frame;
+  uint64_t timestampNanos;
+  // SDL2 scancodes or SDL1 keysyms
+  uint64_t keys[SHARED_KEY_BITS / 64];
+  int32_t numDevices;
+  // of the intester that created the segment
+  int32_t writerPid;
+  SharedDevice devices[SHARED_MAX_DEVICES];
+};
+
+inline bool sharedBit(const uint64_t *bits, int index) {
+  return (bits[index >> 6] >> (index & 63)) & 1;
+}
+
+// copies a consistent state, false if the writer kept it busy for
+// maxRetries attempts
+inline bool sharedStateSnapshot(const SharedState *shared, SharedState *out, int maxRetries = 100) {
+  for (int i = 0; i < maxRetries; ++i) {
+    // let the writer finish instead of spinning against it
+    if (i) sched_yield();
+    uint32_t before = __atomic_load_n(&shared->seq, __ATOMIC_ACQUIRE);
+    if (before & 1) continue;
+    __builtin_memcpy(out, shared, sizeof(SharedState));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&shared->seq, __ATOMIC_RELAXED) == before)
+      return true;
+  }
+  return false;
+}
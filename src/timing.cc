@@ -0,0 +1,39 @@
+#include "timing.hh"
+
+#include <stdio.h>
+
+StartupProfile::StartupProfile(): numPhases(0) {
+  origin = last = monotonicNanos();
+}
+
+void StartupProfile::add(const char *name, uint64_t start, uint64_t end, bool overlapped) {
+  if (numPhases >= MAX_PHASES)
+    return;
+  Phase &p(phases[numPhases++]);
+  p.name = name;
+  p.start = start;
+  p.end = end;
+  p.overlapped = overlapped;
+}
+
+void StartupProfile::mark(const char *name) {
+  uint64_t now = monotonicNanos();
+  add(name, last, now, false);
+  last = now;
+}
+
+void StartupProfile::span(const char *name, uint64_t start, uint64_t end) {
+  add(name, start, end, true);
+}
+
+void StartupProfile::print() {
+  printf("Startup breakdown (ms):\n");
+  for (int i = 0; i < numPhases; ++i) {
+    const Phase &p(phases[i]);
+    printf("  %-24s %8.2f   %8.2f - %8.2f%s\n", p.name,
+        (p.end - p.start) / 1e6, (p.start - origin) / 1e6, (p.end - origin) / 1e6,
+        p.overlapped ? "  (worker)" : "");
+  }
+  printf("Time to first frame: %.2f ms\n", (last - origin) / 1e6);
+  fflush(stdout);
+}
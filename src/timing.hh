@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+inline uint64_t monotonicNanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+inline uint64_t monotonicMicros() {
+  return monotonicNanos() / 1000;
+}
+
+// Timestamps of the startup phases, printed as a breakdown once the first
+// frame is up. Phases on the main thread run back to back, each ending at
+// its mark; spans of other threads are added with their own start and end.
+class StartupProfile {
+  static const int MAX_PHASES = 16;
+
+  struct Phase {
+    const char *name;
+    uint64_t start, end;
+    bool overlapped;
+  };
+
+  Phase phases[MAX_PHASES];
+  int numPhases;
+  uint64_t origin, last;
+
+  void add(const char *name, uint64_t start, uint64_t end, bool overlapped);
+public:
+  StartupProfile();
+
+  inline uint64_t getOrigin() { return origin; }
+  void mark(const char *name);
+  void span(const char *name, uint64_t start, uint64_t end);
+  void print();
+};
@@ -0,0 +1,165 @@
+#include "trace.hh"
+
+#include <mutex>
+#include <stdio.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+bool traceEnabled = false;
+
+namespace {
+
+const int RING_SIZE = 65536;
+
+struct TraceEvent {
+  const char *name;
+  uint64_t ts;
+  uint64_t dur;
+  uint32_t id;
+  int32_t arg;
+  char ph;
+};
+
+struct TraceRing {
+  TraceEvent *events;
+  int count;
+  int tid;
+};
+
+std::mutex fileLock;
+FILE *traceFile = nullptr;
+bool firstEvent = true;
+int pid;
+uint32_t nextFlow = 1, firstPendingFlow = 1;
+
+thread_local TraceRing *ring = nullptr;
+// rings are kept until the trace is closed, threads may end before that
+TraceRing *rings[16];
+int numRings = 0;
+
+void writeEvents(TraceRing *r) {
+  std::lock_guard<std::mutex> lock(fileLock);
+  if (!traceFile)
+    return;
+  for (int i = 0; i < r->count; ++i) {
+    const TraceEvent &e(r->events[i]);
+    fprintf(traceFile, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d",
+        firstEvent ? "" : ",", e.name, e.ph, e.ts / 1000.0, pid, r->tid);
+    firstEvent = false;
+    switch (e.ph) {
+    case 'X':
+      fprintf(traceFile, ",\"dur\":%.3f}", e.dur / 1000.0);
+      break;
+    case 'i':
+      fprintf(traceFile, ",\"s\":\"t\",\"args\":{\"code\":%d}}", e.arg);
+      break;
+    case 's':
+      fprintf(traceFile, ",\"cat\":\"input\",\"id\":%u}", e.id);
+      break;
+    case 'f':
+      fprintf(traceFile, ",\"cat\":\"input\",\"id\":%u,\"bp\":\"e\"}", e.id);
+      break;
+    default:
+      fputc('}', traceFile);
+    }
+  }
+  r->count = 0;
+}
+
+TraceRing* threadRing() {
+  if (!ring) {
+    std::lock_guard<std::mutex> lock(fileLock);
+    if (numRings == sizeof(rings) / sizeof(*rings))
+      return nullptr;
+    ring = new TraceRing;
+    ring->events = new TraceEvent[RING_SIZE];
+    ring->count = 0;
+    ring->tid = syscall(SYS_gettid);
+    rings[numRings++] = ring;
+  }
+  return ring;
+}
+
+inline TraceEvent* append() {
+  TraceRing *r = threadRing();
+  if (!r)
+    return nullptr;
+  if (r->count == RING_SIZE) writeEvents(r);
+  return r->events + r->count++;
+}
+
+}
+
+bool openTrace(const char *path) {
+  traceFile = fopen(path, "w");
+  if (!traceFile) {
+    perror("Can't open the trace file");
+    return false;
+  }
+  pid = getpid();
+  fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", traceFile);
+  // allocate the ring of the render thread now rather than on its first event
+  threadRing();
+  traceEnabled = true;
+  return true;
+}
+
+void closeTrace() {
+  if (!traceFile)
+    return;
+  traceEnabled = false;
+  for (int i = 0; i < numRings; ++i) {
+    writeEvents(rings[i]);
+  }
+  fputs("\n]}\n", traceFile);
+  fclose(traceFile);
+  traceFile = nullptr;
+  for (int i = 0; i < numRings; ++i) {
+    delete[] rings[i]->events;
+    delete rings[i];
+  }
+  numRings = 0;
+}
+
+void traceInstant(const char *name, uint64_t ts, int arg) {
+  TraceEvent *e = append();
+  if (!e)
+    return;
+  e->name = name;
+  e->ts = ts;
+  e->arg = arg;
+  e->ph = 'i';
+}
+
+void traceSpan(const char *name, uint64_t start, uint64_t end) {
+  TraceEvent *e = append();
+  if (!e)
+    return;
+  e->name = name;
+  e->ts = start;
+  e->dur = end - start;
+  e->ph = 'X';
+}
+
+void traceInput(const char *name, uint64_t ts, int arg) {
+  traceInstant(name, ts, arg);
+  TraceEvent *e = append();
+  if (!e)
+    return;
+  e->name = "input";
+  e->ts = ts;
+  e->id = nextFlow++;
+  e->ph = 's';
+}
+
+void traceFrameShown(uint64_t ts) {
+  for (; firstPendingFlow != nextFlow; ++firstPendingFlow) {
+    TraceEvent *e = append();
+    if (!e)
+      return;
+    e->name = "input";
+    e->ts = ts;
+    e->id = firstPendingFlow;
+    e->ph = 'f';
+  }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+// Chrome trace-event (Perfetto loads it too) recording for --trace FILE.
+// Events go into a preallocated ring of the calling thread and are only
+// turned into JSON when the ring fills up or the trace is closed. Names
+// must be string literals or otherwise outlive the trace.
+bool openTrace(const char *path);
+void closeTrace();
+
+extern bool traceEnabled;
+
+// timestamps are monotonicNanos()
+void traceInstant(const char *name, uint64_t ts, int arg);
+void traceSpan(const char *name, uint64_t start, uint64_t end);
+// an input event, the start of an arrow to the frame that shows it
+void traceInput(const char *name, uint64_t ts, int arg);
+// ends the arrows of every input traced since the previous frame
+void traceFrameShown(uint64_t ts);
@@ -0,0 +1,98 @@
+#include "trail.hh"
+#include "timing.hh"
+
+#include <math.h>
+#include <string.h>
+
+TrailBuffer::TrailBuffer(int w, int h): width(w), height(h),
+    x0(w), y0(h), x1(0), y1(0), px0(w), py0(h), px1(0), py1(0), lastDecay(0) {
+  levels = new uint16_t[w * h];
+  memset(levels, 0, sizeof(uint16_t) * w * h);
+}
+
+TrailBuffer::~TrailBuffer() {
+  delete[] levels;
+}
+
+void TrailBuffer::plot(int x, int y, uint32_t amount) {
+  int ix = x >> 8, iy = y >> 8;
+  if (ix < 0 || iy < 0 || ix >= width - 1 || iy >= height - 1)
+    return;
+  // decay() isn't called while nothing is lit, without this the first
+  // point after a pause would fade by the whole idle time at once
+  if (y0 >= y1)
+    lastDecay = monotonicMicros();
+  // bilinear weights of the four pixels around the point, sum to 65536
+  uint32_t fx = x & 0xff, fy = y & 0xff;
+  add(ix, iy, amount * ((256 - fx) * (256 - fy)) >> 16);
+  add(ix + 1, iy, amount * (fx * (256 - fy)) >> 16);
+  add(ix, iy + 1, amount * ((256 - fx) * fy) >> 16);
+  add(ix + 1, iy + 1, amount * (fx * fy) >> 16);
+  if (ix < x0) x0 = ix;
+  if (iy < y0) y0 = iy;
+  if (ix + 2 > x1) x1 = ix + 2;
+  if (iy + 2 > y1) y1 = iy + 2;
+}
+
+void TrailBuffer::decay(uint64_t nowMicros, int halfLife) {
+  if (y0 >= y1 || halfLife <= 0) {
+    lastDecay = nowMicros;
+    return;
+  }
+  double elapsed = (nowMicros - lastDecay) / 1000.0;
+  uint32_t scaled = static_cast<uint32_t>(65536.0 * exp2(-elapsed / halfLife));
+  // too little time for a step, let it add up
+  if (scaled >= 0xffff)
+    return;
+  uint16_t factor = scaled;
+  lastDecay = nowMicros;
+
+  int w = x1 - x0;
+  int top = y1, bottom = y0;
+  for (int y = y0; y < y1; ++y) {
+    uint16_t *row = levels + y * width + x0;
+    // plain multiply-shift loop, left simple so the compiler vectorizes it
+    uint16_t lit = 0;
+    for (int x = 0; x < w; ++x) {
+      uint16_t v = (static_cast<uint32_t>(row[x]) * factor) >> 16;
+      row[x] = v;
+      lit |= v;
+    }
+    if (lit) {
+      if (y < top) top = y;
+      bottom = y + 1;
+    }
+  }
+  if (top < bottom) {
+    y0 = top;
+    y1 = bottom;
+  } else {
+    x0 = width;
+    y0 = height;
+    x1 = y1 = 0;
+  }
+}
+
+void TrailBuffer::render(VideoSurface *target, const uint32_t *palette) {
+  // repaint what's lit now and what was lit last time
+  int rx0 = x0 < px0 ? x0 : px0, ry0 = y0 < py0 ? y0 : py0;
+  int rx1 = x1 > px1 ? x1 : px1, ry1 = y1 > py1 ? y1 : py1;
+  px0 = x0;
+  py0 = y0;
+  px1 = x1;
+  py1 = y1;
+  if (ry0 >= ry1)
+    return;
+
+  LockedSurface locked;
+  if (target->lock(&locked))
+    return;
+  for (int y = ry0; y < ry1; ++y) {
+    const uint16_t *src = levels + y * width;
+    uint32_t *dst = reinterpret_cast<uint32_t*>(locked.pixels + y * locked.pitch);
+    for (int x = rx0; x < rx1; ++x) {
+      dst[x] = palette[src[x] >> 8];
+    }
+  }
+  target->unlock();
+}
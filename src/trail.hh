@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "sdlcompat.hh"
+
+// Persistence buffer behind an axis box: positions are splatted in with
+// sub-pixel precision and the levels decay toward black with a half-life.
+// Decay and repaint only cover the bounding box of what is still lit.
+class TrailBuffer {
+  uint16_t *levels;
+  int width, height;
+  // box of the nonzero levels, x1 and y1 exclusive, empty if y0 >= y1
+  int x0, y0, x1, y1;
+  // box painted by the previous render, its pixels may have gone dark
+  int px0, py0, px1, py1;
+  uint64_t lastDecay;
+
+  inline void add(int x, int y, uint32_t amount) {
+    uint32_t v = levels[y * width + x] + amount;
+    levels[y * width + x] = v > 0xffff ? 0xffff : v;
+  }
+public:
+  TrailBuffer(int w, int h);
+  ~TrailBuffer();
+
+  inline bool isEmpty() {
+    return y0 >= y1 && py0 >= py1;
+  }
+  // x and y are in 1/256 pixels, amount is the level added at full weight
+  void plot(int x, int y, uint32_t amount);
+  // halfLife is in milliseconds
+  void decay(uint64_t nowMicros, int halfLife);
+  // palette maps the top 8 bits of a level to a pixel of the target
+  void render(VideoSurface *target, const uint32_t *palette);
+};
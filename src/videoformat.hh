@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+// Layout of the --record files, shared with tools/videodecode. Native byte
+// order, a file is meant to be decoded on the machine it came from or one
+// with the same endianness.
+//
+// After the file header every frame is a VideoFrameHeader followed by
+// numTiles changed tiles. A tile is its uint16 column and row and a uint16
+// run count, then the runs: a byte holding the run length minus one and
+// the 32 bit pixel, covering the tile row by row. Edge tiles are clipped
+// to the screen.
+
+const char VIDEO_MAGIC[8] = { 'I', 'N', 'T', 'V', 'I', 'D', '1', 0 };
+const int VIDEO_TILE_SIZE = 16;
+
+struct VideoFileHeader {
+  char magic[8];
+  uint32_t width;
+  uint32_t height;
+  uint16_t tileSize;
+  // where the 8 bit channels sit in a pixel
+  uint8_t redShift;
+  uint8_t greenShift;
+  uint8_t blueShift;
+  uint8_t reserved[3];
+};
+
+struct VideoFrameHeader {
+  // CLOCK_MONOTONIC at presentation
+  uint64_t micros;
+  uint32_t numTiles;
+  // size of the tile data following the header
+  uint32_t bytes;
+};
@@ -0,0 +1,177 @@
+// Rasterizes the embedded RussoOne font at the sizes intester uses into
+// alpha coverage atlases with glyph metrics and kerning pairs, written as
+// a header like src/font.h. Metrics follow SDL_ttf so the baked text
+// lines up with what TTF_RenderText_Blended produced.
+//
+// usage: fontbake <output.h> <point size>...
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "../src/font.h"
+
+const int FIRST_CHAR = 32;
+const int LAST_CHAR = 255;
+const int NUM_CHARS = LAST_CHAR - FIRST_CHAR + 1;
+
+struct Glyph {
+  int x, y, w, h;
+  int left, top;
+  int advance;
+  std::vector<unsigned char> coverage;
+};
+
+struct Kerning {
+  int left, right, amount;
+};
+
+static int ceil26_6(long v) {
+  return static_cast<int>((v + 63) >> 6);
+}
+
+static void writeBytes(FILE *out, const unsigned char *data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    fprintf(out, "%s0x%02x", i ? (i % 12 ? ", " : ",\n  ") : "\n  ", data[i]);
+  }
+  fprintf(out, "\n");
+}
+
+static bool bake(FT_Face face, int size, FILE *out) {
+  if (FT_Set_Char_Size(face, 0, size * 64, 0, 0)) {
+    fprintf(stderr, "Cannot set size %d\n", size);
+    return false;
+  }
+  FT_Fixed scale = face->size->metrics.y_scale;
+  int ascent = ceil26_6(FT_MulFix(face->ascender, scale));
+  int descent = ceil26_6(FT_MulFix(face->descender, scale));
+  int height = ascent - descent + 1;
+
+  std::vector<Glyph> glyphs(NUM_CHARS);
+  int maxGlyphWidth = 0;
+  for (int c = FIRST_CHAR; c <= LAST_CHAR; ++c) {
+    Glyph &g(glyphs[c - FIRST_CHAR]);
+    FT_UInt index = FT_Get_Char_Index(face, c);
+    if (FT_Load_Glyph(face, index, FT_LOAD_DEFAULT) ||
+        FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL)) {
+      fprintf(stderr, "Cannot render character %d\n", c);
+      return false;
+    }
+    FT_GlyphSlot slot = face->glyph;
+    g.w = slot->bitmap.width;
+    g.h = slot->bitmap.rows;
+    g.left = slot->bitmap_left;
+    g.top = ascent - slot->bitmap_top;
+    g.advance = ceil26_6(slot->metrics.horiAdvance);
+    g.coverage.resize(g.w * g.h);
+    for (int y = 0; y < g.h; ++y) {
+      memcpy(&g.coverage[y * g.w], slot->bitmap.buffer + y * slot->bitmap.pitch, g.w);
+    }
+    if (g.w > maxGlyphWidth) maxGlyphWidth = g.w;
+  }
+
+  // shelf packing in character order into a roughly square atlas
+  long area = 0;
+  for (const Glyph &g : glyphs) {
+    area += g.w * height;
+  }
+  int atlasWidth = maxGlyphWidth;
+  while (static_cast<long>(atlasWidth) * atlasWidth < area)
+    ++atlasWidth;
+  int x = 0, y = 0, shelf = 0;
+  for (Glyph &g : glyphs) {
+    if (x + g.w > atlasWidth) {
+      x = 0;
+      y += shelf;
+      shelf = 0;
+    }
+    g.x = x;
+    g.y = y;
+    x += g.w;
+    if (g.h > shelf) shelf = g.h;
+  }
+  int atlasHeight = y + shelf;
+  std::vector<unsigned char> atlas(atlasWidth * atlasHeight);
+  for (Glyph &g : glyphs) {
+    for (int row = 0; row < g.h; ++row) {
+      memcpy(&atlas[(g.y + row) * atlasWidth + g.x], &g.coverage[row * g.w], g.w);
+    }
+  }
+
+  std::vector<Kerning> kerning;
+  if (FT_HAS_KERNING(face)) {
+    for (int l = FIRST_CHAR; l <= LAST_CHAR; ++l) {
+      FT_UInt li = FT_Get_Char_Index(face, l);
+      for (int r = FIRST_CHAR; r <= LAST_CHAR; ++r) {
+        FT_Vector delta;
+        FT_Get_Kerning(face, li, FT_Get_Char_Index(face, r), FT_KERNING_DEFAULT, &delta);
+        int amount = static_cast<int>(delta.x >> 6);
+        if (amount) kerning.push_back(Kerning { l, r, amount });
+      }
+    }
+  }
+
+  fprintf(out, "static const uint8_t bakedFont%dAtlas[] = {", size);
+  writeBytes(out, atlas.data(), atlas.size());
+  fprintf(out, "};\n\n");
+  fprintf(out, "static const BakedGlyph bakedFont%dGlyphs[] = {\n", size);
+  for (const Glyph &g : glyphs) {
+    fprintf(out, "  { %d, %d, %d, %d, %d, %d, %d },\n", g.x, g.y, g.w, g.h, g.left, g.top, g.advance);
+  }
+  fprintf(out, "};\n\n");
+  fprintf(out, "static const BakedKerning bakedFont%dKerning[] = {\n", size);
+  for (const Kerning &k : kerning) {
+    fprintf(out, "  { %d, %d, %d },\n", k.left, k.right, k.amount);
+  }
+  if (kerning.empty()) fprintf(out, "  { 0, 0, 0 },\n");
+  fprintf(out, "};\n\n");
+  fprintf(out, "static const BakedFont bakedFont%d = {\n", size);
+  fprintf(out, "  %d, %d, %d,\n", size, ascent, height);
+  fprintf(out, "  %d, %d, bakedFont%dAtlas,\n", atlasWidth, atlasHeight, size);
+  fprintf(out, "  %d, %d, bakedFont%dGlyphs,\n", FIRST_CHAR, NUM_CHARS, size);
+  fprintf(out, "  %d, bakedFont%dKerning,\n", static_cast<int>(kerning.size()), size);
+  fprintf(out, "};\n\n");
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <output.h> <point size>...\n", argv[0]);
+    return 1;
+  }
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) ||
+      FT_New_Memory_Face(library, RussoOne_Regular_ttf, RussoOne_Regular_ttf_len, 0, &face)) {
+    fprintf(stderr, "Cannot load the embedded font\n");
+    return 2;
+  }
+  FILE *out = fopen(argv[1], "w");
+  if (!out) {
+    perror("Cannot open output");
+    return 3;
+  }
+  fprintf(out, "// Generated by tools/fontbake from RussoOne_Regular_ttf, do not edit.\n\n");
+  std::vector<int> sizes;
+  for (int i = 2; i < argc; ++i) {
+    int size = atoi(argv[i]);
+    if (!bake(face, size, out)) {
+      fclose(out);
+      return 4;
+    }
+    sizes.push_back(size);
+  }
+  fprintf(out, "static const BakedFont *bakedFonts[] = {\n");
+  for (int size : sizes) {
+    fprintf(out, "  &bakedFont%d,\n", size);
+  }
+  fprintf(out, "};\n");
+  fclose(out);
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}
@@ -0,0 +1,224 @@
+// Generates a signed distance field atlas of the embedded RussoOne font,
+// written as a header like src/font.h. Glyphs are rendered at 8x the base
+// size, thresholded, and the exact Euclidean distance transform of the
+// high resolution image is sampled at the base resolution.
+//
+// Only ASCII is baked, anything else is drawn as a question mark.
+//
+// usage: sdfbake <output.h> [base size] [spread]
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include "../src/font.h"
+
+const int FIRST_CHAR = 32;
+const int LAST_CHAR = 126;
+const int NUM_CHARS = LAST_CHAR - FIRST_CHAR + 1;
+const int OVERSAMPLE = 8;
+const float INF = 1e20f;
+
+struct Glyph {
+  int x, y, w, h;
+  int left, top;
+  int advance;
+  std::vector<unsigned char> field;
+};
+
+// Felzenszwalb & Huttenlocher 1D squared distance transform
+static void edt1d(const float *f, float *d, int n, int *v, float *z) {
+  int k = 0;
+  v[0] = 0;
+  z[0] = -INF;
+  z[1] = INF;
+  for (int q = 1; q < n; ++q) {
+    float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    while (s <= z[k]) {
+      --k;
+      s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = INF;
+  }
+  k = 0;
+  for (int q = 0; q < n; ++q) {
+    while (z[k + 1] < q) ++k;
+    d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+  }
+}
+
+// squared distance of every pixel to the nearest pixel where inside == target
+static std::vector<float> edt(const std::vector<bool> &inside, int w, int h, bool target) {
+  std::vector<float> grid(w * h);
+  for (int i = 0; i < w * h; ++i) {
+    grid[i] = inside[i] == target ? 0 : INF;
+  }
+  int n = w > h ? w : h;
+  std::vector<float> f(n), d(n), z(n + 1);
+  std::vector<int> v(n);
+  for (int x = 0; x < w; ++x) {
+    for (int y = 0; y < h; ++y) f[y] = grid[y * w + x];
+    edt1d(f.data(), d.data(), h, v.data(), z.data());
+    for (int y = 0; y < h; ++y) grid[y * w + x] = d[y];
+  }
+  for (int y = 0; y < h; ++y) {
+    edt1d(&grid[y * w], d.data(), w, v.data(), z.data());
+    memcpy(&grid[y * w], d.data(), w * sizeof(float));
+  }
+  return grid;
+}
+
+static int floorDiv(int a, int b) {
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static bool bakeGlyph(FT_Face face, int c, int ascent, int spread, Glyph &g) {
+  FT_UInt index = FT_Get_Char_Index(face, c);
+  if (FT_Load_Glyph(face, index, FT_LOAD_NO_HINTING) ||
+      FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL)) {
+    return false;
+  }
+  FT_GlyphSlot slot = face->glyph;
+  // linear advance is 16.16 at the oversampled size, keep 1/64 base pixels
+  g.advance = static_cast<int>(slot->linearHoriAdvance * 64 / 65536 / OVERSAMPLE);
+  int bw = slot->bitmap.width;
+  int bh = slot->bitmap.rows;
+  if (!bw || !bh) {
+    g.w = g.h = 0;
+    g.left = g.top = 0;
+    return true;
+  }
+  // the cell is aligned to the base grid relative to the pen and line top
+  int hiTop = ascent * OVERSAMPLE - slot->bitmap_top;
+  int x0 = floorDiv(slot->bitmap_left, OVERSAMPLE) - spread;
+  int y0 = floorDiv(hiTop, OVERSAMPLE) - spread;
+  int x1 = floorDiv(slot->bitmap_left + bw + OVERSAMPLE - 1, OVERSAMPLE) + spread;
+  int y1 = floorDiv(hiTop + bh + OVERSAMPLE - 1, OVERSAMPLE) + spread;
+  g.left = x0;
+  g.top = y0;
+  g.w = x1 - x0;
+  g.h = y1 - y0;
+
+  int hw = g.w * OVERSAMPLE;
+  int hh = g.h * OVERSAMPLE;
+  std::vector<bool> inside(hw * hh, false);
+  int ox = slot->bitmap_left - x0 * OVERSAMPLE;
+  int oy = hiTop - y0 * OVERSAMPLE;
+  for (int y = 0; y < bh; ++y) {
+    const unsigned char *row = slot->bitmap.buffer + y * slot->bitmap.pitch;
+    for (int x = 0; x < bw; ++x) {
+      inside[(oy + y) * hw + ox + x] = row[x] >= 128;
+    }
+  }
+  std::vector<float> toInside = edt(inside, hw, hh, true);
+  std::vector<float> toOutside = edt(inside, hw, hh, false);
+
+  g.field.resize(g.w * g.h);
+  for (int y = 0; y < g.h; ++y) {
+    for (int x = 0; x < g.w; ++x) {
+      int hi = (y * OVERSAMPLE + OVERSAMPLE / 2) * hw + x * OVERSAMPLE + OVERSAMPLE / 2;
+      float dist = (sqrtf(toOutside[hi]) - sqrtf(toInside[hi])) / OVERSAMPLE;
+      // 128 is the edge, spread base pixels either way span the range
+      int value = static_cast<int>(lroundf(128 + dist * 127 / spread));
+      g.field[y * g.w + x] = value < 0 ? 0 : value > 255 ? 255 : value;
+    }
+  }
+  return true;
+}
+
+static void writeBytes(FILE *out, const unsigned char *data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    fprintf(out, "%s0x%02x", i ? (i % 12 ? ", " : ",\n  ") : "\n  ", data[i]);
+  }
+  fprintf(out, "\n");
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <output.h> [base size] [spread]\n", argv[0]);
+    return 1;
+  }
+  int base = argc > 2 ? atoi(argv[2]) : 32;
+  int spread = argc > 3 ? atoi(argv[3]) : 4;
+
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) ||
+      FT_New_Memory_Face(library, RussoOne_Regular_ttf, RussoOne_Regular_ttf_len, 0, &face)) {
+    fprintf(stderr, "Cannot load the embedded font\n");
+    return 2;
+  }
+  FT_Set_Pixel_Sizes(face, 0, base * OVERSAMPLE);
+  // unhinted metrics in 1/64 base pixels
+  int ascent64 = static_cast<int>(static_cast<long>(face->ascender) * base * 64 / face->units_per_EM);
+  int height64 = static_cast<int>(static_cast<long>(face->ascender - face->descender) * base * 64 / face->units_per_EM);
+  int ascent = (ascent64 + 63) / 64;
+
+  std::vector<Glyph> glyphs(NUM_CHARS);
+  int maxWidth = 0;
+  long area = 0;
+  for (int c = FIRST_CHAR; c <= LAST_CHAR; ++c) {
+    Glyph &g(glyphs[c - FIRST_CHAR]);
+    if (!bakeGlyph(face, c, ascent, spread, g)) {
+      fprintf(stderr, "Cannot render character %d\n", c);
+      return 3;
+    }
+    if (g.w > maxWidth) maxWidth = g.w;
+    area += g.w * (base + 2 * spread);
+  }
+
+  int atlasWidth = maxWidth;
+  while (static_cast<long>(atlasWidth) * atlasWidth < area)
+    ++atlasWidth;
+  int x = 0, y = 0, shelf = 0;
+  for (Glyph &g : glyphs) {
+    if (x + g.w > atlasWidth) {
+      x = 0;
+      y += shelf;
+      shelf = 0;
+    }
+    g.x = x;
+    g.y = y;
+    x += g.w;
+    if (g.h > shelf) shelf = g.h;
+  }
+  int atlasHeight = y + shelf;
+  std::vector<unsigned char> atlas(atlasWidth * atlasHeight, 0);
+  for (Glyph &g : glyphs) {
+    for (int row = 0; row < g.h; ++row) {
+      memcpy(&atlas[(g.y + row) * atlasWidth + g.x], &g.field[row * g.w], g.w);
+    }
+  }
+
+  FILE *out = fopen(argv[1], "w");
+  if (!out) {
+    perror("Cannot open output");
+    return 4;
+  }
+  fprintf(out, "// Generated by tools/sdfbake from RussoOne_Regular_ttf, do not edit.\n\n");
+  fprintf(out, "static const uint8_t sdfFontAtlas[] = {");
+  writeBytes(out, atlas.data(), atlas.size());
+  fprintf(out, "};\n\n");
+  fprintf(out, "static const SdfGlyph sdfFontGlyphs[] = {\n");
+  for (const Glyph &g : glyphs) {
+    fprintf(out, "  { %d, %d, %d, %d, %d, %d, %d },\n", g.x, g.y, g.w, g.h, g.left, g.top, g.advance);
+  }
+  fprintf(out, "};\n\n");
+  fprintf(out, "static const SdfFontData sdfFont = {\n");
+  fprintf(out, "  %d, %d, %d, %d,\n", base, spread, ascent, height64);
+  fprintf(out, "  %d, %d, sdfFontAtlas,\n", atlasWidth, atlasHeight);
+  fprintf(out, "  %d, %d, sdfFontGlyphs,\n", FIRST_CHAR, NUM_CHARS);
+  fprintf(out, "};\n");
+  fclose(out);
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}
@@ -0,0 +1,67 @@
+// Prints the input state intester publishes with --shm NAME.
+//
+// usage: shmdump [name] [interval ms]
+//   without an interval the state is printed once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "shmreader.hh"
+
+static SharedState state;
+
+static void dump() {
+  printf("frame %llu at %.3f s\n", static_cast<unsigned long long>(state.frame),
+      state.timestampNanos / 1e9);
+  printf("keys:");
+  for (int k = 0; k < SHARED_KEY_BITS; ++k) {
+    if (sharedBit(state.keys, k)) printf(" %d", k);
+  }
+  printf("\n");
+  for (int i = 0; i < state.numDevices && i < SHARED_MAX_DEVICES; ++i) {
+    const SharedDevice &d(state.devices[i]);
+    printf("device %d: %.64s\n", d.id, d.name);
+    printf("  buttons:");
+    for (int b = 0; b < d.numButtons && b < SHARED_MAX_BUTTONS; ++b) {
+      if (sharedBit(d.buttons, b)) printf(" %d", b);
+    }
+    printf("\n");
+    if (d.numHats) printf("  hat: %d\n", d.hat);
+    for (int a = 0; a < d.numAxes && a < SHARED_MAX_AXES; ++a) {
+      const SharedAxis &axis(d.axes[a]);
+      printf("  axis %d: %6d  range %u..%u  %u distinct, %u missing", a, axis.value,
+          axis.minNonzeroAbsolute == ~0U ? 0 : axis.minNonzeroAbsolute, axis.maxAbsolute,
+          axis.distinctValues, axis.missingCodes);
+      if (axis.restSamples) printf("  rest %d noise %.2f", axis.restCenter, axis.rmsNoise);
+      printf("\n");
+    }
+  }
+  fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+  const char *name = argc > 1 ? argv[1] : "/intester";
+  int interval = argc > 2 ? atoi(argv[2]) : 0;
+
+  SharedStateReader reader;
+  if (!reader.open(name)) {
+    fprintf(stderr, "Can't open %s, is intester running with --shm %s?\n", name, name);
+    return 1;
+  }
+  uint64_t lastFrame = ~0ULL;
+  do {
+    if (!reader.read(&state)) {
+      // the writer was busy, try again on the next tick
+      if (!interval) {
+        fprintf(stderr, "No consistent state\n");
+        return 2;
+      }
+    } else if (state.frame != lastFrame) {
+      dump();
+      lastFrame = state.frame;
+    }
+    if (interval) usleep(interval * 1000);
+  } while (interval);
+  return 0;
+}
@@ -0,0 +1,45 @@
+#include "shmreader.hh"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SharedStateReader::~SharedStateReader() {
+  close();
+}
+
+bool SharedStateReader::open(const char *name) {
+  int fd = shm_open(name, O_RDONLY, 0);
+  if (fd < 0)
+    return false;
+  struct stat st;
+  if (fstat(fd, &st) < 0 || st.st_size < static_cast<off_t>(sizeof(SharedState))) {
+    ::close(fd);
+    return false;
+  }
+  void *p = mmap(nullptr, sizeof(SharedState), PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED)
+    return false;
+  shared = static_cast<const SharedState*>(p);
+  if (__atomic_load_n(&shared->magic, __ATOMIC_ACQUIRE) != SHARED_STATE_MAGIC ||
+      shared->version != SHARED_STATE_VERSION || shared->size != sizeof(SharedState)) {
+    fprintf(stderr, "%s isn't an intester state segment of this version\n", name);
+    close();
+    return false;
+  }
+  return true;
+}
+
+void SharedStateReader::close() {
+  if (!shared)
+    return;
+  munmap(const_cast<SharedState*>(shared), sizeof(SharedState));
+  shared = nullptr;
+}
+
+bool SharedStateReader::read(SharedState *out) {
+  return shared && sharedStateSnapshot(shared, out);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+// Reader library for the segment intester publishes with --shm. Link
+// intester_shm and include this; the layout is in src/sharedstate.hh.
+
+#include "../src/sharedstate.hh"
+
+class SharedStateReader {
+  const SharedState *shared;
+public:
+  SharedStateReader(): shared(nullptr) {}
+  ~SharedStateReader();
+
+  // false if intester isn't running with this name or the layout differs
+  bool open(const char *name);
+  void close();
+  // a consistent copy of the current state, never blocks intester
+  bool read(SharedState *out);
+};
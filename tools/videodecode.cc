@@ -0,0 +1,109 @@
+// Decodes an intester --record file into numbered PPM frames and prints
+// each frame's presentation time relative to the first one.
+//
+// usage: videodecode <recording> <output dir>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../src/videoformat.hh"
+
+static bool applyTiles(const VideoFileHeader &file, const uint8_t *data, const uint8_t *end,
+    uint32_t numTiles, uint32_t *canvas) {
+  int tileSize = file.tileSize;
+  for (uint32_t i = 0; i < numTiles; ++i) {
+    uint16_t tile[3];
+    if (end - data < 6)
+      return false;
+    memcpy(tile, data, sizeof(tile));
+    data += 6;
+    int width = file.width, height = file.height;
+    int x0 = tile[0] * tileSize;
+    int y0 = tile[1] * tileSize;
+    if (x0 >= width || y0 >= height)
+      return false;
+    int w = width - x0 < tileSize ? width - x0 : tileSize;
+    int h = height - y0 < tileSize ? height - y0 : tileSize;
+    int x = 0, y = 0;
+    for (int run = 0; run < tile[2]; ++run) {
+      if (end - data < 5)
+        return false;
+      int length = *data + 1;
+      uint32_t pixel;
+      memcpy(&pixel, data + 1, 4);
+      data += 5;
+      while (length--) {
+        if (y >= h)
+          return false;
+        canvas[(y0 + y) * width + x0 + x] = pixel;
+        if (++x == w) {
+          x = 0;
+          ++y;
+        }
+      }
+    }
+  }
+  return data == end;
+}
+
+static bool writeFrame(const char *path, const VideoFileHeader &file, const uint32_t *canvas) {
+  FILE *out = fopen(path, "wb");
+  if (!out)
+    return false;
+  fprintf(out, "P6\n%u %u\n255\n", file.width, file.height);
+  std::vector<uint8_t> row(file.width * 3);
+  for (uint32_t y = 0; y < file.height; ++y) {
+    for (uint32_t x = 0; x < file.width; ++x) {
+      uint32_t p = canvas[y * file.width + x];
+      row[x * 3] = p >> file.redShift;
+      row[x * 3 + 1] = p >> file.greenShift;
+      row[x * 3 + 2] = p >> file.blueShift;
+    }
+    fwrite(row.data(), 1, row.size(), out);
+  }
+  return fclose(out) == 0;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s <recording> <output dir>\n", argv[0]);
+    return 1;
+  }
+  FILE *in = fopen(argv[1], "rb");
+  if (!in) {
+    perror("Cannot open recording");
+    return 2;
+  }
+  VideoFileHeader file;
+  if (fread(&file, sizeof(file), 1, in) != 1 || memcmp(file.magic, VIDEO_MAGIC, sizeof(file.magic)) ||
+      !file.tileSize || file.width > 16384 || file.height > 16384) {
+    fprintf(stderr, "Not an intester recording\n");
+    return 3;
+  }
+  std::vector<uint32_t> canvas(static_cast<size_t>(file.width) * file.height);
+  std::vector<uint8_t> data;
+  VideoFrameHeader frame;
+  uint64_t firstMicros = 0;
+  int count = 0;
+  while (fread(&frame, sizeof(frame), 1, in) == 1) {
+    data.resize(frame.bytes);
+    if (fread(data.data(), 1, frame.bytes, in) != frame.bytes ||
+        !applyTiles(file, data.data(), data.data() + frame.bytes, frame.numTiles, canvas.data())) {
+      fprintf(stderr, "Frame %d is truncated or corrupt\n", count);
+      return 4;
+    }
+    if (!count) firstMicros = frame.micros;
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/frame_%06d.ppm", argv[2], count);
+    if (!writeFrame(path, file, canvas.data())) {
+      perror("Cannot write frame");
+      return 5;
+    }
+    printf("%s %.3f ms, %u tiles\n", path, (frame.micros - firstMicros) / 1000.0, frame.numTiles);
+    ++count;
+  }
+  fclose(in);
+  return 0;
+}